@@ -113,11 +113,14 @@ QString getBakeMapping(const AssetUtils::AssetHash& hash, const QString& relativ
 
 const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
+// the ovens keep the results of their bakes here, so that restarts don't bake unchanged assets again
+static const QString BAKE_CACHE_SUBDIR = "bake-cache";
+
 void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, _resourcesDirectory.absoluteFilePath(BAKE_CACHE_SUBDIR));
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -24,10 +24,12 @@ static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             const QString& bakeCacheDirectory) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _bakeCacheDirectory(bakeCacheDirectory)
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -70,6 +72,7 @@ void BakeAssetTask::run() {
         "-i", tempAssetPath,
         "-o", tempOutputDir,
         "-t", extension,
+        "--bake-cache", _bakeCacheDirectory,
     };
 
     _ovenProcess.reset(new QProcess());
@@ -338,6 +338,13 @@ void AudioMixer::sendStatsPacket() {
     mixStats["3_active_to_skippped"] = (int)(_stats.activeToSkipped / (float)_numStatFrames);
     mixStats["3_active_to_inactive"] = (int)(_stats.activeToInactive / (float)_numStatFrames);
 
+    // mixes whose encoded payload was shared with a listener that heard the identical mix
+    int totalEncodedMixes = _stats.encodes + _stats.sharedEncodes;
+    float sharedEncodePercentage = (totalEncodedMixes > 0) ? (float(_stats.sharedEncodes) / totalEncodedMixes) * 100.0f : 0.0f;
+    mixStats["%_shared_encodes"] = QString::number(sharedEncodePercentage, 'f', 2);
+    mixStats["4_encodes"] = (int)(_stats.encodes / (float)_numStatFrames);
+    mixStats["4_shared_encodes"] = (int)(_stats.sharedEncodes / (float)_numStatFrames);
+
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
@@ -91,16 +91,11 @@ public:
 
     void setupCodec(CodecPluginPointer codec, const QString& codecName);
     void cleanupCodec();
-    void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) {
-        if (_encoder) {
-            _encoder->encode(decodedBuffer, encodedBuffer);
-        } else {
-            encodedBuffer = decodedBuffer;
-        }
-        // once you have encoded, you need to flush eventually.
-        _shouldFlushEncoder = true;
-    }
-    void encodeFrameOfZeros(QByteArray& encodedZeros);
+    // the outbound encoder is driven by AudioMixerSlave, which batches encodes across listeners
+    CodecPlugin* getCodecPlugin() const { return _codec.get(); }
+    Encoder* getEncoder() const { return _encoder; }
+    // once you have encoded, you need to flush eventually (by encoding a frame of zeros)
+    void setShouldFlushEncoder(bool shouldFlushEncoder) { _shouldFlushEncoder = shouldFlushEncoder; }
     bool shouldFlushEncoder() { return _shouldFlushEncoder; }
 
     QString getCodecName() { return _selectedCodecName; }
@@ -12,6 +12,9 @@
 #include "AudioMixerSlave.h"
 
 #include <algorithm>
+#include <tuple>
+
+#include <QtCore/QHash>
 
 #include <glm/glm.hpp>
 #include <glm/gtx/norm.hpp>
@@ -29,6 +32,7 @@
 #include <StDev.h>
 #include <UUID.h>
 
+#include "AudioLogging.h"
 #include "AudioRingBuffer.h"
 #include "AudioMixer.h"
 #include "AudioMixerClientData.h"
@@ -43,7 +47,7 @@ using MixableStreamsVector = AudioMixerClientData::MixableStreamsVector;
 
 // packet helpers
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec);
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
+void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, const char* buffer, int size);
 void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
 void sendMutePacket(const SharedNodePointer& node, AudioMixerClientData&);
 void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
@@ -99,19 +103,10 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
         // mix the audio
         bool mixHasAudio = prepareMix(node);
 
-        // send audio packet
+        // queue audio packet, it is encoded and sent with the rest of this slave's listeners in finishMix
         if (mixHasAudio || data->shouldFlushEncoder()) {
-            QByteArray encodedBuffer;
-            if (mixHasAudio) {
-                // encode the audio
-                QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
-                data->encode(decodedBuffer, encodedBuffer);
-            } else {
-                // time to flush (resets shouldFlush until the next encode)
-                data->encodeFrameOfZeros(encodedBuffer);
-            }
-
-            sendMixPacket(node, *data, encodedBuffer);
+            // if there is no audio it is time to flush (resets shouldFlush until the next encode)
+            queueMix(node, *data, !mixHasAudio);
         } else {
             ++stats.sumListenersSilent;
             sendSilentPacket(node, *data);
@@ -128,6 +123,133 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
     }
 }
 
+void AudioMixerSlave::queueMix(const SharedNodePointer& node, AudioMixerClientData& data, bool isFrameOfZeros) {
+    if (_numPendingMixes == (int)_pendingMixes.size()) {
+        _pendingMixes.emplace_back();
+    }
+
+    PendingMix& pendingMix = _pendingMixes[_numPendingMixes++];
+    pendingMix.node = node;
+    pendingMix.data = &data;
+    pendingMix.isFrameOfZeros = isFrameOfZeros;
+    if (!isFrameOfZeros) {
+        memcpy(pendingMix.samples, _bufferSamples, AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+    }
+}
+
+const char* AudioMixerSlave::getDecodedBuffer(const PendingMix& pendingMix) {
+    static const int16_t ZEROS[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO] = {};
+    return reinterpret_cast<const char*>(pendingMix.isFrameOfZeros ? ZEROS : pendingMix.samples);
+}
+
+void AudioMixerSlave::finishMix() {
+    const int DECODED_SIZE = AudioConstants::NETWORK_FRAME_BYTES_STEREO;
+
+    // order the queued mixes by codec, so that each codec encodes its listeners in one batch,
+    // and by a hash of the encoder input, so that identical mixes are adjacent
+    // listeners without an encoder (no codec negotiated) are passed through as raw PCM
+    _encodeOrder.clear();
+    for (int i = 0; i < _numPendingMixes; ++i) {
+        const PendingMix& pendingMix = _pendingMixes[i];
+        Encoder* encoder = pendingMix.data->getEncoder();
+
+        PendingEncode pendingEncode;
+        pendingEncode.codec = encoder ? pendingMix.data->getCodecPlugin() : nullptr;
+        // a stateful encoder must see every frame of its own stream, so it never shares a payload
+        pendingEncode.isShareable = !encoder || encoder->isStateless();
+        // the limiter is stateful per listener, so the hash is taken after limiting, on the actual encoder input
+        pendingEncode.hash = pendingEncode.isShareable ? qHashBits(getDecodedBuffer(pendingMix), DECODED_SIZE) : 0;
+        pendingEncode.index = i;
+        _encodeOrder.push_back(pendingEncode);
+    }
+    std::sort(_encodeOrder.begin(), _encodeOrder.end(), [](const PendingEncode& a, const PendingEncode& b) {
+        if (a.codec != b.codec) {
+            return std::less<CodecPlugin*>()(a.codec, b.codec);
+        }
+        return std::tie(a.isShareable, a.hash, a.index) < std::tie(b.isShareable, b.hash, b.index);
+    });
+
+    // build the batch, encoding bit-identical mixes of a stateless codec only once
+    _encodeBatch.clear();
+    _encodeBatchCodecs.clear();
+    const PendingEncode* previousEncode = nullptr;
+    for (PendingEncode& pendingEncode : _encodeOrder) {
+        PendingMix& pendingMix = _pendingMixes[pendingEncode.index];
+        const char* decodedBuffer = getDecodedBuffer(pendingMix);
+
+        if (previousEncode && pendingEncode.isShareable && previousEncode->isShareable &&
+            previousEncode->codec == pendingEncode.codec && previousEncode->hash == pendingEncode.hash &&
+            memcmp(_encodeBatch[previousEncode->batchIndex].decodedBuffer, decodedBuffer, DECODED_SIZE) == 0) {
+            pendingEncode.batchIndex = previousEncode->batchIndex;
+            ++stats.sharedEncodes;
+            continue;
+        }
+
+        Encoder* encoder = pendingEncode.codec ? pendingMix.data->getEncoder() : nullptr;
+        int maxEncodedSize = encoder ? encoder->getMaxEncodedSize(DECODED_SIZE) : DECODED_SIZE;
+        if ((int)pendingMix.encodedBuffer.size() < maxEncodedSize) {
+            pendingMix.encodedBuffer.resize(maxEncodedSize);
+        }
+
+        EncodeBatchEntry entry;
+        entry.encoder = encoder;
+        entry.decodedBuffer = decodedBuffer;
+        entry.decodedSize = DECODED_SIZE;
+        entry.encodedBuffer = pendingMix.encodedBuffer.data();
+        entry.encodedCapacity = (int)pendingMix.encodedBuffer.size();
+        entry.encodedSize = -1;
+
+        pendingEncode.batchIndex = (int)_encodeBatch.size();
+        _encodeBatch.push_back(entry);
+        _encodeBatchCodecs.push_back(pendingEncode.codec);
+        previousEncode = &pendingEncode;
+        ++stats.encodes;
+    }
+
+    // encode each run of listeners sharing a codec
+    int batchSize = (int)_encodeBatch.size();
+    int runStart = 0;
+    while (runStart < batchSize) {
+        CodecPlugin* codec = _encodeBatchCodecs[runStart];
+        int runEnd = runStart + 1;
+        while (runEnd < batchSize && _encodeBatchCodecs[runEnd] == codec) {
+            ++runEnd;
+        }
+
+        if (codec) {
+            codec->encodeBatch(&_encodeBatch[runStart], runEnd - runStart);
+        } else {
+            for (int i = runStart; i < runEnd; ++i) {
+                EncodeBatchEntry& entry = _encodeBatch[i];
+                memcpy(entry.encodedBuffer, entry.decodedBuffer, entry.decodedSize);
+                entry.encodedSize = entry.decodedSize;
+            }
+        }
+        runStart = runEnd;
+    }
+
+    // send, fanning shared payloads out to every listener that produced the same mix
+    for (const PendingEncode& pendingEncode : _encodeOrder) {
+        PendingMix& pendingMix = _pendingMixes[pendingEncode.index];
+        const EncodeBatchEntry& entry = _encodeBatch[pendingEncode.batchIndex];
+
+        if (entry.encodedSize >= 0) {
+            // once you have encoded, you need to flush eventually
+            pendingMix.data->setShouldFlushEncoder(!pendingMix.isFrameOfZeros);
+            sendMixPacket(pendingMix.node, *pendingMix.data, entry.encodedBuffer, entry.encodedSize);
+        } else {
+            qCWarning(audio) << "Failed to encode mix for" << pendingMix.node->getUUID();
+            sendSilentPacket(pendingMix.node, *pendingMix.data);
+        }
+    }
+
+    // release the nodes until the next frame
+    for (int i = 0; i < _numPendingMixes; ++i) {
+        _pendingMixes[i].node.reset();
+        _pendingMixes[i].data = nullptr;
+    }
+    _numPendingMixes = 0;
+}
 
 template <class Container, class Predicate>
 void erase_if(Container& cont, Predicate&& pred) {
@@ -608,7 +730,7 @@ std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 s
     return audioPacket;
 }
 
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer) {
+void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, const char* buffer, int size) {
     const int MIX_PACKET_SIZE =
         sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE + AudioConstants::NETWORK_FRAME_BYTES_STEREO;
     quint16 sequence = data.getOutgoingSequenceNumber();
@@ -616,7 +738,7 @@ void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QB
     auto mixPacket = createAudioPacket(PacketType::MixedAudio, MIX_PACKET_SIZE, sequence, codec);
 
     // pack samples
-    mixPacket->write(buffer.constData(), buffer.size());
+    mixPacket->write(buffer, size);
 
     // send packet
     DependencyManager::get<NodeList>()->sendPacket(std::move(mixPacket), *node);
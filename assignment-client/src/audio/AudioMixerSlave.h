@@ -47,9 +47,12 @@ public:
     void configureMix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain);
 
     // mix and broadcast non-ignored streams to the node (requires configuration using configureMix, above)
-    // returns true if a mixed packet was sent to the node
+    // mixes with audio are queued, and encoded and sent by finishMix
     void mix(const SharedNodePointer& node);
 
+    // encode and send the mixes queued this frame, batching encodes per codec
+    void finishMix();
+
     AudioMixerStats stats;
 
 private:
@@ -68,10 +71,34 @@ private:
 
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
+    struct PendingMix {
+        SharedNodePointer node;
+        AudioMixerClientData* data { nullptr };
+        bool isFrameOfZeros { false };
+        int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+        std::vector<char> encodedBuffer;
+    };
+    struct PendingEncode {
+        CodecPlugin* codec { nullptr }; // nullptr for raw PCM
+        bool isShareable { false };
+        uint hash { 0 };
+        int index { 0 }; // into _pendingMixes
+        int batchIndex { 0 }; // into _encodeBatch, shared by identical mixes
+    };
+    void queueMix(const SharedNodePointer& node, AudioMixerClientData& data, bool isFrameOfZeros);
+    static const char* getDecodedBuffer(const PendingMix& pendingMix);
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // encoding buffers, only ever grown so that steady state encoding does not allocate
+    std::vector<PendingMix> _pendingMixes;
+    int _numPendingMixes { 0 };
+    std::vector<PendingEncode> _encodeOrder;
+    std::vector<EncodeBatchEntry> _encodeBatch;
+    std::vector<CodecPlugin*> _encodeBatchCodecs;
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
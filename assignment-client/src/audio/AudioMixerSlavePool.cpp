@@ -24,6 +24,11 @@ void AudioMixerSlaveThread::run() {
             (this->*_function)(node);
         }
 
+        // finish any work batched across nodes
+        if (_finish) {
+            (this->*_finish)();
+        }
+
         bool stopping = _stop;
         notify(stopping);
         if (stopping) {
@@ -46,6 +51,7 @@ void AudioMixerSlaveThread::wait() {
         _pool._configure(*this);
     }
     _function = _pool._function;
+    _finish = _pool._finish;
 }
 
 void AudioMixerSlaveThread::notify(bool stopping) {
@@ -66,12 +72,14 @@ bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
 
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
     _function = &AudioMixerSlave::processPackets;
+    _finish = nullptr;
     _configure = [](AudioMixerSlave& slave) {};
     run(begin, end);
 }
 
 void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain) {
     _function = &AudioMixerSlave::mix;
+    _finish = &AudioMixerSlave::finishMix;
     _configure = [=](AudioMixerSlave& slave) {
         slave.configureMix(_begin, _end, frame, numToRetain);
     };
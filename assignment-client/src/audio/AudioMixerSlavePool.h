@@ -45,6 +45,7 @@ private:
 
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
+    void (AudioMixerSlave::*_finish)() { nullptr };
     bool _stop { false };
 };
 
@@ -94,6 +95,7 @@ private:
     ConditionVariable _slaveCondition;
     ConditionVariable _poolCondition;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node);
+    void (AudioMixerSlave::*_finish)() { nullptr };
     std::function<void(AudioMixerSlave&)> _configure;
     int _numThreads { 0 };
     int _numStarted { 0 }; // guarded by _mutex
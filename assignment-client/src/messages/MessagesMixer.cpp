@@ -17,10 +17,22 @@
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <TBBHelpers.h>
+#include <UUID.h>
 #include <udt/PacketHeaders.h>
 
+#include "AssignmentClientLogging.h"
+
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
 
+// a subscriber's batch is sent immediately once it grows past this, rather than waiting for the flush window
+const int MAX_OUTBOUND_BATCH_BYTES = 64 * 1024;
+
+// below this many subscribers to flush, fanning out across threads costs more than it saves
+const size_t MIN_BATCHES_FOR_MULTITHREADED_FAN_OUT = 16;
+
 MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(message)
 {
     connect(DependencyManager::get<NodeList>().data(), &NodeList::nodeKilled, this, &MessagesMixer::nodeKilled);
@@ -28,43 +40,152 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
     packetReceiver.registerListener(PacketType::MessagesData, this, "handleMessages");
     packetReceiver.registerListener(PacketType::MessagesSubscribe, this, "handleMessagesSubscribe");
     packetReceiver.registerListener(PacketType::MessagesUnsubscribe, this, "handleMessagesUnsubscribe");
+
+    // by default the flush window closes once the event loop has drained the messages that arrived together
+    _flushTimer.setSingleShot(true);
+    _flushTimer.setInterval(0);
+    connect(&_flushTimer, &QTimer::timeout, this, &MessagesMixer::flushOutboundBatches);
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    for (ChannelID channelID = 0; channelID < (ChannelID)_channels.size(); ++channelID) {
+        removeSubscriber(channelID, killedNode->getUUID());
+    }
+    _outboundBatches.remove(killedNode->getUUID());
+}
+
+MessagesMixer::ChannelID MessagesMixer::getOrCreateChannelID(const QByteArray& channelName) {
+    auto it = _channelIDs.find(channelName);
+    if (it != _channelIDs.end()) {
+        return it.value();
+    }
+
+    ChannelID channelID;
+    if (!_freeChannelIDs.empty()) {
+        channelID = _freeChannelIDs.back();
+        _freeChannelIDs.pop_back();
+    } else {
+        channelID = (ChannelID)_channels.size();
+        _channels.emplace_back();
+    }
+    _channels[channelID].name = channelName;
+    _channelIDs.insert(channelName, channelID);
+    return channelID;
+}
+
+void MessagesMixer::removeSubscriber(ChannelID channelID, const QUuid& subscriberID) {
+    Channel& channel = _channels[channelID];
+    if (!channel.subscribers.remove(subscriberID) || !channel.subscribers.isEmpty()) {
+        return;
     }
+
+    // that was the last subscriber, later messages to the channel count as unsubscribed
+    _channelIDs.remove(channel.name);
+    channel = Channel();
+    _freeChannelIDs.push_back(channelID);
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    QUuid senderID;
-    bool isText;
-    MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+    // a packet list carries one or more messages back to back, each is forwarded verbatim to the channel's subscribers
+    while (receivedMessage->getBytesLeftToRead() > 0) {
+        qint64 messageStart = receivedMessage->getPosition();
+
+        quint16 channelLength;
+        if (receivedMessage->readPrimitive(&channelLength) != sizeof(channelLength) ||
+            receivedMessage->getBytesLeftToRead() < channelLength) {
+            qCWarning(assignment_client) << "Received truncated message from" << senderNode->getUUID();
+            return;
+        }
+        // the channel name is only used for the lookup, while the message is alive
+        QByteArray channelName = receivedMessage->readWithoutCopy(channelLength);
+
+        bool isText;
+        quint32 messageLength;
+        if (receivedMessage->readPrimitive(&isText) != sizeof(isText) ||
+            receivedMessage->readPrimitive(&messageLength) != sizeof(messageLength) ||
+            receivedMessage->getBytesLeftToRead() < (qint64)messageLength + NUM_BYTES_RFC4122_UUID) {
+            qCWarning(assignment_client) << "Received truncated message from" << senderNode->getUUID();
+            return;
+        }
+        receivedMessage->seek(receivedMessage->getPosition() + messageLength + NUM_BYTES_RFC4122_UUID);
+
+        const char* message = receivedMessage->getRawMessage() + messageStart;
+        int messageSize = (int)(receivedMessage->getPosition() - messageStart);
+
+        auto it = _channelIDs.find(channelName);
+        if (it == _channelIDs.end()) {
+            ++_unsubscribedStats.messagesIn;
+            _unsubscribedStats.bytesIn += messageSize;
+            continue;
+        }
+
+        Channel& channel = _channels[it.value()];
+        ++channel.stats.messagesIn;
+        channel.stats.bytesIn += messageSize;
+
+        for (const auto& subscriberID : channel.subscribers) {
+            queueOutboundMessage(subscriberID, message, messageSize);
+        }
+        channel.stats.messagesOut += channel.subscribers.size();
+        channel.stats.bytesOut += (quint64)messageSize * channel.subscribers.size();
+    }
+}
+
+void MessagesMixer::queueOutboundMessage(const QUuid& subscriberID, const char* message, int size) {
+    QByteArray& batch = _outboundBatches[subscriberID];
+    batch.append(message, size);
 
+    if (batch.size() >= MAX_OUTBOUND_BATCH_BYTES) {
+        auto node = DependencyManager::get<NodeList>()->nodeWithUUID(subscriberID);
+        if (node && node->getActiveSocket()) {
+            sendBatch(node, batch);
+        }
+        _outboundBatches.remove(subscriberID);
+    } else if (!_flushTimer.isActive()) {
+        _flushTimer.start();
+    }
+}
+
+void MessagesMixer::sendBatch(const SharedNodePointer& node, const QByteArray& batch) {
+    auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+    packetList->write(batch);
+    DependencyManager::get<NodeList>()->sendPacketList(std::move(packetList), *node);
+}
+
+void MessagesMixer::flushOutboundBatches() {
     auto nodeList = DependencyManager::get<NodeList>();
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+    std::vector<std::pair<SharedNodePointer, QByteArray>> batches;
+    batches.reserve(_outboundBatches.size());
+    for (auto it = _outboundBatches.begin(); it != _outboundBatches.end(); ++it) {
+        auto node = nodeList->nodeWithUUID(it.key());
+        if (node && node->getActiveSocket()) {
+            batches.emplace_back(node, it.value());
+        }
+    }
+    _outboundBatches.clear();
+
+    if (_multithreadedFanOut && batches.size() >= MIN_BATCHES_FOR_MULTITHREADED_FAN_OUT) {
+        // packet lists are built on worker threads, the socket queues their sends to its own thread
+        tbb::parallel_for(size_t(0), batches.size(), [&](size_t i) {
+            sendBatch(batches[i].first, batches[i].second);
+        });
+    } else {
+        for (const auto& batch : batches) {
+            sendBatch(batch.first, batch.second);
+        }
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    QString channel = QString::fromUtf8(message->getMessage());
-    _channelSubscribers[channel] << senderNode->getUUID();
+    ChannelID channelID = getOrCreateChannelID(message->getMessage());
+    _channels[channelID].subscribers << senderNode->getUUID();
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    QString channel = QString::fromUtf8(message->getMessage());
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderNode->getUUID());
+    auto it = _channelIDs.find(message->getMessage());
+    if (it != _channelIDs.end()) {
+        removeSubscriber(it.value(), senderNode->getUUID());
     }
 }
 
@@ -81,10 +202,61 @@ void MessagesMixer::sendStatsPacket() {
     });
 
     statsObject["messages"] = messagesMixerObject;
+
+    // add rates for each channel that saw traffic since the last stats packet
+    quint64 now = usecTimestampNow();
+    float elapsedSeconds = _lastStatsTime > 0 ? (float)(now - _lastStatsTime) / USECS_PER_SECOND : 1.0f;
+    _lastStatsTime = now;
+
+    auto statsForChannel = [&](const ChannelStats& stats) {
+        QJsonObject channelStats;
+        channelStats["messages_in_per_second"] = stats.messagesIn / elapsedSeconds;
+        channelStats["messages_out_per_second"] = stats.messagesOut / elapsedSeconds;
+        channelStats["inbound_kbps"] = (stats.bytesIn * BITS_IN_BYTE) / (elapsedSeconds * BYTES_PER_KILOBYTE);
+        channelStats["outbound_kbps"] = (stats.bytesOut * BITS_IN_BYTE) / (elapsedSeconds * BYTES_PER_KILOBYTE);
+        return channelStats;
+    };
+
+    QJsonObject channelsObject;
+    for (auto& channel : _channels) {
+        if (channel.stats.messagesIn > 0) {
+            QJsonObject channelStats = statsForChannel(channel.stats);
+            channelStats["subscribers"] = channel.subscribers.size();
+            channelsObject[QString::fromUtf8(channel.name)] = channelStats;
+        }
+        channel.stats = ChannelStats();
+    }
+    statsObject["channels"] = channelsObject;
+    statsObject["unsubscribed_channels"] = statsForChannel(_unsubscribedStats);
+    _unsubscribedStats = ChannelStats();
+
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
+void MessagesMixer::domainSettingsRequestComplete() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    const QString MESSAGES_MIXER_SETTINGS_KEY = "messages_mixer";
+    QJsonObject messagesMixerGroupObject =
+        nodeList->getDomainHandler().getSettingsObject()[MESSAGES_MIXER_SETTINGS_KEY].toObject();
+
+    const QString FLUSH_INTERVAL_KEY = "flush_interval";
+    bool ok;
+    int flushInterval = messagesMixerGroupObject[FLUSH_INTERVAL_KEY].toString().toInt(&ok);
+    if (ok && flushInterval >= 0) {
+        _flushTimer.setInterval(flushInterval);
+    }
+
+    const QString MULTITHREADED_FAN_OUT_KEY = "multithreaded_fan_out";
+    _multithreadedFanOut = messagesMixerGroupObject[MULTITHREADED_FAN_OUT_KEY].toBool();
+
+    qCDebug(assignment_client) << "Messages mixer flushing every" << _flushTimer.interval() << "ms,"
+        << (_multithreadedFanOut ? "multithreaded" : "single threaded") << "fan out";
+}
+
 void MessagesMixer::run() {
+    DomainHandler& domainHandler = DependencyManager::get<NodeList>()->getDomainHandler();
+    connect(&domainHandler, &DomainHandler::settingsReceived, this, &MessagesMixer::domainSettingsRequestComplete);
+
     ThreadedAssignment::commonInit(MESSAGES_MIXER_LOGGING_NAME, NodeType::MessagesMixer);
     auto nodeList = DependencyManager::get<NodeList>();
     nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
@@ -15,6 +15,10 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <vector>
+
+#include <QtCore/QTimer>
+
 #include <ThreadedAssignment.h>
 
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
@@ -32,9 +36,43 @@ private slots:
     void handleMessages(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
+    void domainSettingsRequestComplete();
+    void flushOutboundBatches();
 
 private:
-    QHash<QString,QSet<QUuid>> _channelSubscribers;
+    // channels are interned on subscribe, and looked up by their UTF-8 name as it arrives on the wire; a channel is
+    // removed with its last subscriber, and its ID is reused by the next channel created
+    using ChannelID = uint32_t;
+
+    struct ChannelStats {
+        quint64 messagesIn { 0 };
+        quint64 bytesIn { 0 };
+        quint64 messagesOut { 0 };
+        quint64 bytesOut { 0 };
+    };
+
+    struct Channel {
+        QByteArray name;
+        QSet<QUuid> subscribers;
+        ChannelStats stats;
+    };
+
+    ChannelID getOrCreateChannelID(const QByteArray& channelName);
+    void removeSubscriber(ChannelID channelID, const QUuid& subscriberID);
+    void queueOutboundMessage(const QUuid& subscriberID, const char* message, int size);
+    void sendBatch(const SharedNodePointer& node, const QByteArray& batch);
+
+    QHash<QByteArray, ChannelID> _channelIDs;
+    std::vector<Channel> _channels; // slots of removed channels have no subscribers
+    std::vector<ChannelID> _freeChannelIDs;
+    ChannelStats _unsubscribedStats; // messages sent to channels nobody has subscribed to
+
+    // messages destined for each subscriber, sent as a single packet list when the flush window closes
+    QHash<QUuid, QByteArray> _outboundBatches;
+    QTimer _flushTimer;
+    bool _multithreadedFanOut { false };
+
+    quint64 _lastStatsTime { 0 };
 };
 
 #endif // hifi_MessagesMixer_h
@@ -17,6 +17,10 @@ macro(TARGET_BULLET)
         list(APPEND BULLET_LIBRARIES ${LIB_DIR}/libBulletSoftBody.a)
     else()
         find_package(Bullet REQUIRED)
+        # our bullet3 port is built with BULLET2_MULTITHREADING, which requires its users to agree on BT_THREADSAFE.
+        # Android links the prebuilt bullet above instead of our port, and nothing says it was built multithreaded, so
+        # BT_THREADSAFE stays undefined there to match it, and PhysicsEngine steps on one thread.
+        target_compile_definitions(${TARGET_NAME} PRIVATE BT_THREADSAFE=1)
    endif()
     # perform the system include hack for OS X to ignore warnings
     if (APPLE)
@@ -7,10 +7,13 @@ $(document).ready(function(){
 
     var uuid = qs("uuid");
 
-    $.getJSON("/nodes/" + uuid + ".json", function(json){
+    // without a node UUID we show the stats for the domain-server itself
+    var statsURL = uuid ? "/nodes/" + uuid + ".json" : "/stats.json";
+
+    $.getJSON(statsURL, function(json){
 
       // update the table header with the right node type
-      $('#stats-lead h3').html(json.node_type + " stats (" + uuid + ")");
+      $('#stats-lead h3').html(json.node_type + " stats" + (uuid ? " (" + uuid + ")" : ""));
 
       delete json.node_type;
 
@@ -14,22 +14,35 @@
 #include <openssl/err.h>
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
+#include <algorithm>
 #include <random>
 
 #include <QDataStream>
 
 #include <AccountManager.h>
 #include <Assignment.h>
+#include <PortableHighResolutionClock.h>
 
 #include "DomainServer.h"
 #include "DomainServerNodeData.h"
+#include "UserSignatureVerifier.h"
 
 using SharedAssignmentPointer = QSharedPointer<Assignment>;
 
+const int PUBLIC_KEY_PREFETCH_INTERVAL_MSECS = 60 * 1000;
+const quint64 MAX_PREFETCHED_PUBLIC_KEY_AGE_USECS = 10 * 60 * USECS_PER_SECOND;
+const size_t NUM_CONNECT_LATENCY_SAMPLES = 1024;
+
 DomainGatekeeper::DomainGatekeeper(DomainServer* server) :
     _server(server)
 {
     initLocalIDManagement();
+
+    // keep public keys fresh for users that are already here, so that a reconnect doesn't wait on the API
+    connect(&_publicKeyPrefetchTimer, &QTimer::timeout, this, &DomainGatekeeper::prefetchUserPublicKeys);
+    _publicKeyPrefetchTimer.start(PUBLIC_KEY_PREFETCH_INTERVAL_MSECS);
+
+    _connectLatencies.reserve(NUM_CONNECT_LATENCY_SAMPLES);
 }
 
 void DomainGatekeeper::addPendingAssignedNode(const QUuid& nodeUUID, const QUuid& assignmentUUID,
@@ -104,13 +117,26 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             }
         }
 
-        node = processAgentConnectRequest(nodeConnection, username, usernameSignature);
+        if (!username.isEmpty() && !usernameSignature.isEmpty()
+            && !_connectionTokenHash.value(username.toLower()).isNull()) {
+            // the user is attempting to prove their identity, the signature check happens in the verification pool
+            // and this connect request is finished once its result comes back
+            verifyUserSignature(nodeConnection, username, usernameSignature, message->getFirstPacketReceiveTime());
+            return;
+        }
+
+        node = processAgentConnectRequest(nodeConnection, username, false);
     }
 
+    finishConnectRequest(node, nodeConnection, username, message->getFirstPacketReceiveTime());
+}
+
+void DomainGatekeeper::finishConnectRequest(const SharedNodePointer& node, const NodeConnectionData& nodeConnection,
+                                            const QString& username, qint64 requestReceiveTime) {
     if (node) {
         // set the sending sock addr and node interest set on this node
         DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-        nodeData->setSendingSockAddr(message->getSenderSockAddr());
+        nodeData->setSendingSockAddr(nodeConnection.senderSockAddr);
 
         // guard against patched agents asking to hear about other agents
         auto safeInterestSet = nodeConnection.interestList.toSet();
@@ -123,7 +149,7 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
 
         QMetaEnum metaEnum = QMetaEnum::fromType<LimitedNodeList::ConnectReason>();
         qDebug() << "Allowed connection from node" << uuidStringWithoutCurlyBraces(node->getUUID()) 
-            << "on" << message->getSenderSockAddr() 
+            << "on" << nodeConnection.senderSockAddr 
             << "with MAC" << nodeConnection.hardwareAddress 
             << "and machine fingerprint" << nodeConnection.machineFingerprint 
             << "user" << username 
@@ -131,11 +157,25 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             << "previous connection uptime" << nodeConnection.previousConnectionUpTime/USECS_PER_MSEC << "msec"
             << "sysinfo" << nodeConnection.SystemInfo;
 
+        // record how long this node waited on us, for the stats page
+        using namespace std::chrono;
+        qint64 now = duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+        quint64 latency = (quint64)std::max(now - requestReceiveTime, (qint64)0);
+        if (_connectLatencies.size() < NUM_CONNECT_LATENCY_SAMPLES) {
+            _connectLatencies.push_back(latency);
+        } else {
+            _connectLatencies[_nextConnectLatencyIndex] = latency;
+            _nextConnectLatencyIndex = (_nextConnectLatencyIndex + 1) % NUM_CONNECT_LATENCY_SAMPLES;
+        }
+        ++_numAcceptedConnectRequests;
+
         // signal that we just connected a node so the DomainServer can get it a list
         // and broadcast its presence right away
-        emit connectedNode(node, message->getFirstPacketReceiveTime());
+        emit connectedNode(node, requestReceiveTime);
     } else {
-        qDebug() << "Refusing connection from node at" << message->getSenderSockAddr()
+        ++_numRefusedConnectRequests;
+
+        qDebug() << "Refusing connection from node at" << nodeConnection.senderSockAddr
             << "with hardware address" << nodeConnection.hardwareAddress
             << "and machine fingerprint" << nodeConnection.machineFingerprint
             << "sysinfo" << nodeConnection.SystemInfo;
@@ -392,7 +432,7 @@ const QString MAXIMUM_USER_CAPACITY_REDIRECT_LOCATION = "security.maximum_user_c
 
 SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnectionData& nodeConnection,
                                                                const QString& username,
-                                                               const QByteArray& usernameSignature) {
+                                                               bool isUsernameVerified) {
 
     auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
@@ -407,9 +447,10 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
 
     QString verifiedUsername; // if this remains empty, consider this an anonymous connection attempt
     if (!username.isEmpty()) {
-        const QUuid& connectionToken = _connectionTokenHash.value(username.toLower());
-
-        if (usernameSignature.isEmpty() || connectionToken.isNull()) {
+        if (isUsernameVerified) {
+            // they sent us a username and the signature verifies it
+            verifiedUsername = username.toLower();
+        } else {
             // user is attempting to prove their identity to us, but we don't have enough information
             sendConnectionTokenPacket(username, nodeConnection.senderSockAddr);
 
@@ -418,17 +459,6 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
             getGroupMemberships(username); // optimistically get started on group memberships
 #ifdef WANT_DEBUG
             qDebug() << "stalling login because we have no username-signature:" << username;
-#endif
-            return SharedNodePointer();
-        } else if (verifyUserSignature(username, usernameSignature, nodeConnection.senderSockAddr)) {
-            // they sent us a username and the signature verifies it
-            getGroupMemberships(username);
-            verifiedUsername = username.toLower();
-        } else {
-            // they sent us a username, but it didn't check out
-            requestUserPublicKey(username);
-#ifdef WANT_DEBUG
-            qDebug() << "stalling login because signature verification failed:" << username;
 #endif
             return SharedNodePointer();
         }
@@ -558,81 +588,144 @@ void DomainGatekeeper::cleanupICEPeerForNode(const QUuid& nodeID) {
     }
 }
 
-bool DomainGatekeeper::verifyUserSignature(const QString& username,
-                                           const QByteArray& usernameSignature,
-                                           const HifiSockAddr& senderSockAddr) {
+void DomainGatekeeper::verifyUserSignature(const NodeConnectionData& nodeConnection, const QString& username,
+                                           const QByteArray& usernameSignature, qint64 requestReceiveTime) {
     // it's possible this user can be allowed to connect, but we need to check their username signature
     auto lowerUsername = username.toLower();
-    KeyFlagPair publicKeyPair = _userPublicKeys.value(lowerUsername);
 
-    QByteArray publicKeyArray = publicKeyPair.first;
-    bool isOptimisticKey = publicKeyPair.second;
+    if (_usernamesPendingVerification.contains(lowerUsername)) {
+        // we're already checking a signature for this user, they'll hear back once that check is done
+        return;
+    }
 
+    auto it = _userPublicKeys.find(lowerUsername);
     const QUuid& connectionToken = _connectionTokenHash.value(lowerUsername);
 
-    if (!publicKeyArray.isEmpty() && !connectionToken.isNull()) {
-        // if we do have a public key for the user, check for a signature match
+    if (it != _userPublicKeys.end() && !connectionToken.isNull()) {
+        if (it->key) {
+            // if we do have a public key for the user, hand off the check for a signature match
+            QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
+            QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
+                                                                    QCryptographicHash::Sha256);
+
+            auto verificationID = _nextSignatureVerificationID++;
+            _pendingSignatureVerifications.insert(verificationID,
+                                                  { nodeConnection, username, requestReceiveTime, it->isOptimistic });
+            _usernamesPendingVerification.insert(lowerUsername);
+
+            auto verifier = new UserSignatureVerifier(verificationID, it->key, usernameWithToken, usernameSignature);
+            connect(verifier, &UserSignatureVerifier::finished, this, &DomainGatekeeper::handleUserSignatureVerified,
+                    Qt::QueuedConnection);
+            _signatureVerificationPool.start(verifier);
+            return;
+        } else {
+            // we can't let this user in since we couldn't convert their public key to an RSA key we could use
+            qDebug() << "Couldn't convert data to RSA key for" << username << "- denying connection.";
+            sendConnectionDeniedPacket("Couldn't convert data to RSA key.", nodeConnection.senderSockAddr,
+                DomainHandler::ConnectionRefusedReason::LoginError);
+        }
+    } else {
+        qDebug() << "Insufficient data to decrypt username signature - delaying connection.";
+    }
 
-        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
+    requestUserPublicKey(username); // no joy.  maybe next time?
+    finishConnectRequest(SharedNodePointer(), nodeConnection, username, requestReceiveTime);
+}
 
-        // first load up the public key into an RSA struct
-        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
+void DomainGatekeeper::handleUserSignatureVerified(quint64 verificationID, bool isVerified) {
+    auto it = _pendingSignatureVerifications.find(verificationID);
+    if (it == _pendingSignatureVerifications.end()) {
+        return;
+    }
 
-        QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
-        QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
-                                                                QCryptographicHash::Sha256);
-
-        if (rsaPublicKey) {
-            int decryptResult = RSA_verify(NID_sha256,
-                                           reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
-                                           usernameWithToken.size(),
-                                           reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
-                                           usernameSignature.size(),
-                                           rsaPublicKey);
-
-            if (decryptResult == 1) {
-                qDebug() << "Username signature matches for" << username;
-
-                // free up the public key and remove connection token before we return
-                RSA_free(rsaPublicKey);
-                _connectionTokenHash.remove(username);
-
-                return true;
-
-            } else {
-                // we only send back a LoginError if this wasn't an "optimistic" key
-                // (a key that we hoped would work but is probably stale)
-
-                if (!senderSockAddr.isNull() && !isOptimisticKey) {
-                    qDebug() << "Error decrypting username signature for" << username << "- denying connection.";
-                    sendConnectionDeniedPacket("Error decrypting username signature.", senderSockAddr,
-                        DomainHandler::ConnectionRefusedReason::LoginError);
-                } else if (!senderSockAddr.isNull()) {
-                    qDebug() << "Error decrypting username signature for" << username << "with optimisitic key -"
-                        << "re-requesting public key and delaying connection";
-                }
+    PendingSignatureVerification pending = it.value();
+    _pendingSignatureVerifications.erase(it);
 
-                // free up the public key, we don't need it anymore
-                RSA_free(rsaPublicKey);
-            }
+    auto lowerUsername = pending.username.toLower();
+    _usernamesPendingVerification.remove(lowerUsername);
+    ++_numSignatureVerifications;
+
+    SharedNodePointer node;
+
+    if (isVerified) {
+        qDebug() << "Username signature matches for" << pending.username;
 
+        // remove the connection token now that it has been used
+        _connectionTokenHash.remove(lowerUsername);
+
+        getGroupMemberships(pending.username);
+        node = processAgentConnectRequest(pending.nodeConnection, pending.username, true);
+    } else {
+        // we only send back a LoginError if this wasn't an "optimistic" key
+        // (a key that we hoped would work but is probably stale)
+        if (!pending.isOptimisticKey) {
+            qDebug() << "Error decrypting username signature for" << pending.username << "- denying connection.";
+            sendConnectionDeniedPacket("Error decrypting username signature.", pending.nodeConnection.senderSockAddr,
+                DomainHandler::ConnectionRefusedReason::LoginError);
         } else {
+            qDebug() << "Error decrypting username signature for" << pending.username << "with optimisitic key -"
+                << "re-requesting public key and delaying connection";
+        }
 
-            // we can't let this user in since we couldn't convert their public key to an RSA key we could use
-            if (!senderSockAddr.isNull()) {
-                qDebug() << "Couldn't convert data to RSA key for" << username << "- denying connection.";
-                sendConnectionDeniedPacket("Couldn't convert data to RSA key.", senderSockAddr,
-                    DomainHandler::ConnectionRefusedReason::LoginError);
-            }
+        // they sent us a username, but it didn't check out
+        requestUserPublicKey(pending.username);
+#ifdef WANT_DEBUG
+        qDebug() << "stalling login because signature verification failed:" << pending.username;
+#endif
+    }
+
+    finishConnectRequest(node, pending.nodeConnection, pending.username, pending.requestReceiveTime);
+}
+
+void DomainGatekeeper::prefetchUserPublicKeys() {
+    auto now = usecTimestampNow();
+
+    // make sure we have recent public keys for the users already in the domain
+    // so that a burst of reconnects can be checked without a round trip to the API
+    DependencyManager::get<LimitedNodeList>()->eachNode([this, now](const SharedNodePointer& node) {
+        auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+        if (!nodeData || nodeData->getUsername().isEmpty()) {
+            return;
         }
-    } else {
-        if (!senderSockAddr.isNull()) {
-            qDebug() << "Insufficient data to decrypt username signature - delaying connection.";
+
+        auto it = _userPublicKeys.find(nodeData->getUsername().toLower());
+        if (it == _userPublicKeys.end() || now - it->receivedTimestamp > MAX_PREFETCHED_PUBLIC_KEY_AGE_USECS) {
+            ++_numPublicKeyPrefetches;
+            requestUserPublicKey(nodeData->getUsername(), true);
         }
+    });
+}
+
+QJsonObject DomainGatekeeper::getStatsJSONObject() const {
+    QJsonObject statsObject;
+
+    statsObject["accepted_connect_requests"] = (double)_numAcceptedConnectRequests;
+    statsObject["refused_connect_requests"] = (double)_numRefusedConnectRequests;
+    statsObject["signature_verifications"] = (double)_numSignatureVerifications;
+    statsObject["pending_signature_verifications"] = _pendingSignatureVerifications.size();
+    statsObject["cached_public_keys"] = _userPublicKeys.size();
+    statsObject["in_flight_public_key_requests"] = _inFlightPublicKeyRequests.size();
+    statsObject["public_key_prefetches"] = (double)_numPublicKeyPrefetches;
+
+    // percentiles of the recent connect request latencies, from receiving the request to accepting the node
+    QJsonObject latencyObject;
+    if (!_connectLatencies.empty()) {
+        auto sortedLatencies = _connectLatencies;
+        std::sort(sortedLatencies.begin(), sortedLatencies.end());
+
+        auto percentile = [&sortedLatencies](float fraction) {
+            size_t index = (size_t)(fraction * (float)(sortedLatencies.size() - 1) + 0.5f);
+            return (double)sortedLatencies[index];
+        };
+        latencyObject["p50"] = percentile(0.5f);
+        latencyObject["p90"] = percentile(0.9f);
+        latencyObject["p99"] = percentile(0.99f);
+        latencyObject["max"] = (double)sortedLatencies.back();
     }
+    latencyObject["samples"] = (int)_connectLatencies.size();
+    statsObject["connect_request_latency_usecs"] = latencyObject;
 
-    requestUserPublicKey(username); // no joy.  maybe next time?
-    return false;
+    return statsObject;
 }
 
 bool DomainGatekeeper::isWithinMaxCapacity() {
@@ -708,11 +801,17 @@ void DomainGatekeeper::publicKeyJSONCallback(QNetworkReply* requestReply) {
 
         qDebug().nospace() << "Extracted " << (isOptimisticKey ? "optimistic " : " ") << "public key for " << username.toLower();
 
-        _userPublicKeys[username.toLower()] =
-            {
-                QByteArray::fromBase64(jsonObject[JSON_DATA_KEY].toObject()[JSON_PUBLIC_KEY_KEY].toString().toUtf8()),
-                isOptimisticKey
-            };
+        QByteArray publicKeyArray =
+            QByteArray::fromBase64(jsonObject[JSON_DATA_KEY].toObject()[JSON_PUBLIC_KEY_KEY].toString().toUtf8());
+
+        // load up the public key into an RSA struct once, so connect requests don't have to
+        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
+        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
+
+        UserPublicKey& userPublicKey = _userPublicKeys[username.toLower()];
+        userPublicKey.key = rsaPublicKey ? std::shared_ptr<RSA>(rsaPublicKey, RSA_free) : std::shared_ptr<RSA>();
+        userPublicKey.isOptimistic = isOptimisticKey;
+        userPublicKey.receivedTimestamp = usecTimestampNow();
     }
 }
 
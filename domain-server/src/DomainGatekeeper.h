@@ -14,10 +14,15 @@
 #ifndef hifi_DomainGatekeeper_h
 #define hifi_DomainGatekeeper_h
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <QtCore/QJsonObject>
 #include <QtCore/QObject>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
 #include <QtNetwork/QNetworkReply>
 
 #include <DomainHandler.h>
@@ -26,6 +31,8 @@
 #include <Node.h>
 #include <UUIDHasher.h>
 
+#include <openssl/rsa.h>
+
 #include "NodeConnectionData.h"
 #include "PendingAssignedNodeData.h"
 
@@ -45,6 +52,8 @@ public:
     Node::LocalID findOrCreateLocalID(const QUuid& uuid);
 
     static void sendProtocolMismatchConnectionDenial(const HifiSockAddr& senderSockAddr);
+
+    QJsonObject getStatsJSONObject() const;
 public slots:
     void processConnectRequestPacket(QSharedPointer<ReceivedMessage> message);
     void processICEPingPacket(QSharedPointer<ReceivedMessage> message);
@@ -71,16 +80,20 @@ public slots:
 
 private slots:
     void handlePeerPingTimeout();
+    void handleUserSignatureVerified(quint64 verificationID, bool isVerified);
+    void prefetchUserPublicKeys();
 private:
     SharedNodePointer processAssignmentConnectRequest(const NodeConnectionData& nodeConnection,
                                                       const PendingAssignedNodeData& pendingAssignment);
     SharedNodePointer processAgentConnectRequest(const NodeConnectionData& nodeConnection,
                                                  const QString& username,
-                                                 const QByteArray& usernameSignature);
+                                                 bool isUsernameVerified);
     SharedNodePointer addVerifiedNodeFromConnectRequest(const NodeConnectionData& nodeConnection);
-    
-    bool verifyUserSignature(const QString& username, const QByteArray& usernameSignature,
-                             const HifiSockAddr& senderSockAddr);
+    void finishConnectRequest(const SharedNodePointer& node, const NodeConnectionData& nodeConnection,
+                              const QString& username, qint64 requestReceiveTime);
+
+    void verifyUserSignature(const NodeConnectionData& nodeConnection, const QString& username,
+                             const QByteArray& usernameSignature, qint64 requestReceiveTime);
     bool isWithinMaxCapacity();
     
     bool shouldAllowConnectionFromNode(const QString& username, const QByteArray& usernameSignature,
@@ -113,13 +126,40 @@ private:
     // we don't send back user signature decryption errors for those keys so that there isn't a thrasing of key re-generation
     // and connection refusal
 
-    using KeyFlagPair = QPair<QByteArray, bool>;
+    struct UserPublicKey {
+        std::shared_ptr<RSA> key; // parsed once when it arrives, null if it could not be converted to an RSA key
+        bool isOptimistic { false };
+        quint64 receivedTimestamp { 0 };
+    };
 
-    QHash<QString, KeyFlagPair> _userPublicKeys; // keep track of keys and flag them as optimistic or not
+    QHash<QString, UserPublicKey> _userPublicKeys; // keep track of keys and flag them as optimistic or not
     QHash<QString, bool> _inFlightPublicKeyRequests; // keep track of keys we've asked for (and if it was optimistic)
     QSet<QString> _domainOwnerFriends; // keep track of friends of the domain owner
     QSet<QString> _inFlightGroupMembershipsRequests; // keep track of which we've already asked for
 
+    // connect requests waiting on a username signature check in the verification pool
+    struct PendingSignatureVerification {
+        NodeConnectionData nodeConnection;
+        QString username;
+        qint64 requestReceiveTime;
+        bool isOptimisticKey;
+    };
+
+    QThreadPool _signatureVerificationPool;
+    QHash<quint64, PendingSignatureVerification> _pendingSignatureVerifications;
+    QSet<QString> _usernamesPendingVerification;
+    quint64 _nextSignatureVerificationID { 0 };
+    quint64 _numSignatureVerifications { 0 };
+
+    QTimer _publicKeyPrefetchTimer;
+    quint64 _numPublicKeyPrefetches { 0 };
+
+    // time from receiving a connect request to accepting the node, for the most recent connections
+    std::vector<quint64> _connectLatencies;
+    size_t _nextConnectLatencyIndex { 0 };
+    quint64 _numAcceptedConnectRequests { 0 };
+    quint64 _numRefusedConnectRequests { 0 };
+
     NodePermissions setPermissionsForUser(bool isLocalUser, QString verifiedUsername, const QHostAddress& senderAddress, 
                                           const QString& hardwareAddress, const QUuid& machineFingerprint);
 
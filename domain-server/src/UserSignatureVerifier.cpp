@@ -0,0 +1,34 @@
+//
+//  UserSignatureVerifier.cpp
+//  domain-server/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "UserSignatureVerifier.h"
+
+#include <openssl/objects.h>
+
+UserSignatureVerifier::UserSignatureVerifier(quint64 verificationID, std::shared_ptr<RSA> publicKey,
+                                             QByteArray usernameWithTokenHash, QByteArray usernameSignature) :
+    _verificationID(verificationID),
+    _publicKey(std::move(publicKey)),
+    _usernameWithTokenHash(std::move(usernameWithTokenHash)),
+    _usernameSignature(std::move(usernameSignature))
+{
+
+}
+
+void UserSignatureVerifier::run() {
+    int verificationResult = RSA_verify(NID_sha256,
+                                        reinterpret_cast<const unsigned char*>(_usernameWithTokenHash.constData()),
+                                        _usernameWithTokenHash.size(),
+                                        reinterpret_cast<const unsigned char*>(_usernameSignature.constData()),
+                                        _usernameSignature.size(),
+                                        _publicKey.get());
+
+    emit finished(_verificationID, verificationResult == 1);
+}
@@ -0,0 +1,41 @@
+//
+//  UserSignatureVerifier.h
+//  domain-server/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_UserSignatureVerifier_h
+#define hifi_UserSignatureVerifier_h
+
+#include <memory>
+
+#include <QtCore/QObject>
+#include <QtCore/QRunnable>
+
+#include <openssl/rsa.h>
+
+// Checks a connecting user's username signature against their public key off of the domain-server's main thread.
+// The result is signalled back with the ID the gatekeeper gave this verification.
+class UserSignatureVerifier : public QObject, public QRunnable {
+    Q_OBJECT
+public:
+    UserSignatureVerifier(quint64 verificationID, std::shared_ptr<RSA> publicKey,
+                          QByteArray usernameWithTokenHash, QByteArray usernameSignature);
+
+    virtual void run() override;
+
+signals:
+    void finished(quint64 verificationID, bool isVerified);
+
+private:
+    quint64 _verificationID;
+    std::shared_ptr<RSA> _publicKey;
+    QByteArray _usernameWithTokenHash;
+    QByteArray _usernameSignature;
+};
+
+#endif // hifi_UserSignatureVerifier_h
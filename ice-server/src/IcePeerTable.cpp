@@ -0,0 +1,236 @@
+//
+//  IcePeerTable.cpp
+//  ice-server/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "IcePeerTable.h"
+
+#include <algorithm>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDebug>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+#include "IceServer.h"
+
+// one wheel slot per sweep, with enough slots to cover the silence threshold
+const quint64 TICK_USECS = CLEAR_INACTIVE_PEERS_INTERVAL_MSECS * USECS_PER_MSEC;
+const quint64 PEER_SILENCE_THRESHOLD_USECS = PEER_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC;
+const size_t NUM_WHEEL_SLOTS = PEER_SILENCE_THRESHOLD_MSECS / CLEAR_INACTIVE_PEERS_INTERVAL_MSECS + 2;
+
+IcePeerTable::IcePeerTable() {
+    for (auto& shard : _shards) {
+        shard.wheel.resize(NUM_WHEEL_SLOTS);
+    }
+    _lastSweptTick = usecTimestampNow() / TICK_USECS;
+}
+
+IcePeerTable::Shard& IcePeerTable::shardForDomain(const QUuid& domainID) {
+    return _shards[qHash(domainID) % NUM_SHARDS];
+}
+
+const IcePeerTable::Shard& IcePeerTable::shardForDomain(const QUuid& domainID) const {
+    return _shards[qHash(domainID) % NUM_SHARDS];
+}
+
+void IcePeerTable::touch(Shard& shard, const QUuid& domainID, Record& record, quint64 now) {
+    record.lastActiveMicrostamp = now;
+
+    // schedule the record on the first sweep after it could have gone silent, at most once per tick
+    quint64 expiryTick = (now + PEER_SILENCE_THRESHOLD_USECS) / TICK_USECS + 1;
+    if (expiryTick != record.expiryTick) {
+        record.expiryTick = expiryTick;
+        shard.wheel[expiryTick % NUM_WHEEL_SLOTS].push_back(domainID);
+    }
+}
+
+void IcePeerTable::updatePeer(Shard& shard, const QUuid& domainID, Record& record, const HifiSockAddr& publicSocket,
+                              const HifiSockAddr& localSocket, const HifiSockAddr& senderSockAddr) {
+    if (!record.peer) {
+        // if we don't have this sender we need to create them now
+        record.peer = QSharedPointer<NetworkPeer>::create(domainID, publicSocket, localSocket);
+
+        // heartbeats are verified on worker threads, but peers live on the ice-server thread
+        record.peer->moveToThread(QCoreApplication::instance()->thread());
+
+        qDebug() << "Added a new network peer" << *record.peer;
+    } else {
+        // we already had the peer so just potentially update their sockets
+        record.peer->setPublicSocket(publicSocket);
+        record.peer->setLocalSocket(localSocket);
+    }
+
+    // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
+    record.peer->activateMatchingOrNewSymmetricSocket(senderSockAddr);
+
+    // update our last heard microstamp for this network peer to now
+    quint64 now = usecTimestampNow();
+    record.peer->setLastHeardMicrostamp(now);
+    touch(shard, domainID, record, now);
+}
+
+IcePeerTable::HeartbeatResult IcePeerTable::processHeartbeat(const QUuid& domainID, const HifiSockAddr& publicSocket,
+                                                             const HifiSockAddr& localSocket, const QByteArray& plaintext,
+                                                             const QByteArray& signature, const HifiSockAddr& senderSockAddr) {
+    auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
+    Shard& shard = shardForDomain(domainID);
+
+    RSAPointer publicKey;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.records.find(domainID);
+        if (it == shard.records.end()) {
+            it = shard.records.insert(domainID, Record());
+            touch(shard, domainID, it.value(), usecTimestampNow());
+        }
+        Record& record = it.value();
+
+        // make sure we're not already waiting for a public key for this domain-server
+        if (record.isPublicKeyPending) {
+            return HeartbeatResult::Denied;
+        }
+
+        // check if we have a public key for this domain ID - if we do not then the caller fires off the request for it
+        if (!record.publicKey) {
+            record.isPublicKeyPending = true;
+            return HeartbeatResult::DeniedNeedsPublicKey;
+        }
+
+        if (record.verifiedSignature == signature && record.verifiedPlaintextHash == hashedPlaintext) {
+            ++_numCachedVerifications;
+            updatePeer(shard, domainID, record, publicSocket, localSocket, senderSockAddr);
+            return HeartbeatResult::Verified;
+        }
+
+        publicKey = record.publicKey;
+    }
+
+    // attempt to verify the signature for this heartbeat, without holding the shard
+    ++_numVerifications;
+    int verificationResult = RSA_verify(NID_sha256,
+                                        reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
+                                        hashedPlaintext.size(),
+                                        reinterpret_cast<const unsigned char*>(signature.constData()),
+                                        signature.size(),
+                                        publicKey.get());
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.records.find(domainID);
+    if (it == shard.records.end()) {
+        return HeartbeatResult::Denied;
+    }
+    Record& record = it.value();
+
+    if (verificationResult == 1 && record.publicKey == publicKey) {
+        // this is the only success case
+        record.verifiedPlaintextHash = hashedPlaintext;
+        record.verifiedSignature = signature;
+        updatePeer(shard, domainID, record, publicSocket, localSocket, senderSockAddr);
+        return HeartbeatResult::Verified;
+    }
+
+    // we could not verify this heartbeat (stale public key, bad actor)
+    // the caller asks the metaverse API for the right public key, unless another heartbeat already did
+    qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
+    if (record.isPublicKeyPending) {
+        return HeartbeatResult::Denied;
+    }
+    record.isPublicKeyPending = true;
+    return HeartbeatResult::DeniedNeedsPublicKey;
+}
+
+SharedNetworkPeer IcePeerTable::findPeer(const QUuid& domainID) const {
+    const Shard& shard = shardForDomain(domainID);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.records.find(domainID);
+    return it != shard.records.end() ? it->peer : SharedNetworkPeer();
+}
+
+void IcePeerTable::setPublicKey(const QUuid& domainID, RSAPointer publicKey) {
+    Shard& shard = shardForDomain(domainID);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.records.find(domainID);
+    if (it == shard.records.end()) {
+        if (!publicKey) {
+            return;
+        }
+        it = shard.records.insert(domainID, Record());
+    }
+    Record& record = it.value();
+
+    record.isPublicKeyPending = false;
+    if (publicKey) {
+        record.publicKey = publicKey;
+        record.verifiedPlaintextHash.clear();
+        record.verifiedSignature.clear();
+    }
+    touch(shard, domainID, record, usecTimestampNow());
+}
+
+void IcePeerTable::clearInactivePeers() {
+    quint64 now = usecTimestampNow();
+    quint64 currentTick = now / TICK_USECS;
+
+    // if sweeps fell behind by more than a turn of the wheel, every slot only needs to be visited once
+    quint64 firstTick = std::max(_lastSweptTick + 1, currentTick >= NUM_WHEEL_SLOTS ? currentTick - NUM_WHEEL_SLOTS + 1 : 0);
+
+    for (auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        for (quint64 tick = firstTick; tick <= currentTick; ++tick) {
+            size_t slot = tick % NUM_WHEEL_SLOTS;
+            std::vector<QUuid> scheduled;
+            scheduled.swap(shard.wheel[slot]);
+
+            for (const auto& domainID : scheduled) {
+                auto it = shard.records.find(domainID);
+                if (it == shard.records.end()) {
+                    continue;
+                }
+                Record& record = it.value();
+
+                if (record.expiryTick > tick) {
+                    // the record was touched after this entry was scheduled, keep it only if it wrapped around to this slot
+                    if (record.expiryTick % NUM_WHEEL_SLOTS == slot) {
+                        shard.wheel[slot].push_back(domainID);
+                    }
+                } else if (record.isPublicKeyPending || (now - record.lastActiveMicrostamp) <= PEER_SILENCE_THRESHOLD_USECS) {
+                    // still waiting on the metaverse API, look again on the next sweep
+                    record.expiryTick = tick + 1;
+                    shard.wheel[record.expiryTick % NUM_WHEEL_SLOTS].push_back(domainID);
+                } else {
+                    if (record.peer) {
+                        qDebug() << "Removing peer from memory for inactivity -" << *record.peer;
+                    }
+
+                    // removing the record also forgets the public key for this domain
+                    shard.records.erase(it);
+                }
+            }
+        }
+    }
+
+    _lastSweptTick = currentTick;
+}
+
+int IcePeerTable::getNumPeers() const {
+    int numPeers = 0;
+    for (const auto& shard : _shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& record : shard.records) {
+            if (record.peer) {
+                ++numPeers;
+            }
+        }
+    }
+    return numPeers;
+}
@@ -0,0 +1,96 @@
+//
+//  IcePeerTable.h
+//  ice-server/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_IcePeerTable_h
+#define hifi_IcePeerTable_h
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QUuid>
+
+#include <openssl/rsa.h>
+
+#include <NetworkPeer.h>
+
+// Heartbeating domains, their public keys and their last verified heartbeat, split across
+// independently locked shards so that heartbeats can be verified on many threads at once.
+// Expiry is tracked with a timing wheel, so a sweep only visits the peers that may have expired.
+class IcePeerTable {
+public:
+    using RSAPointer = std::shared_ptr<RSA>;
+
+    enum class HeartbeatResult {
+        Verified,
+        Denied,
+        DeniedNeedsPublicKey // the caller should request the domain's public key from the metaverse API
+    };
+
+    IcePeerTable();
+
+    // thread-safe, may be called concurrently for any domains
+    HeartbeatResult processHeartbeat(const QUuid& domainID, const HifiSockAddr& publicSocket, const HifiSockAddr& localSocket,
+                                     const QByteArray& plaintext, const QByteArray& signature,
+                                     const HifiSockAddr& senderSockAddr);
+
+    SharedNetworkPeer findPeer(const QUuid& domainID) const;
+
+    // stores the public key for the domain, or clears its pending request if the key could not be retrieved
+    void setPublicKey(const QUuid& domainID, RSAPointer publicKey);
+
+    // removes the peers that have been silent for longer than the silence threshold
+    void clearInactivePeers();
+
+    int getNumPeers() const;
+    quint64 getNumVerifications() const { return _numVerifications; }
+    quint64 getNumCachedVerifications() const { return _numCachedVerifications; }
+
+private:
+    static const int NUM_SHARDS = 64;
+
+    struct Record {
+        SharedNetworkPeer peer;
+        RSAPointer publicKey;
+        bool isPublicKeyPending { false };
+
+        // the last heartbeat verified with publicKey, domain-servers re-send identical signed heartbeats
+        // until their sockets change so this spares us most RSA verifications
+        QByteArray verifiedPlaintextHash;
+        QByteArray verifiedSignature;
+
+        quint64 lastActiveMicrostamp { 0 };
+        quint64 expiryTick { 0 };
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        QHash<QUuid, Record> records;
+        std::vector<std::vector<QUuid>> wheel;
+    };
+
+    Shard& shardForDomain(const QUuid& domainID);
+    const Shard& shardForDomain(const QUuid& domainID) const;
+
+    void touch(Shard& shard, const QUuid& domainID, Record& record, quint64 now);
+    void updatePeer(Shard& shard, const QUuid& domainID, Record& record, const HifiSockAddr& publicSocket,
+                    const HifiSockAddr& localSocket, const HifiSockAddr& senderSockAddr);
+
+    std::array<Shard, NUM_SHARDS> _shards;
+    quint64 _lastSweptTick { 0 };
+
+    std::atomic<quint64> _numVerifications { 0 };
+    std::atomic<quint64> _numCachedVerifications { 0 };
+};
+
+#endif // hifi_IcePeerTable_h
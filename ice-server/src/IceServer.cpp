@@ -24,15 +24,15 @@
 #include <NetworkingConstants.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
+#include <TBBHelpers.h>
 
-const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
-const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
+// heartbeats are batched until the event loop drains, or until this many are waiting
+const size_t MAX_HEARTBEAT_BATCH_SIZE = 4096;
 
 IceServer::IceServer(int argc, char* argv[]) :
     QCoreApplication(argc, argv),
     _id(QUuid::createUuid()),
-    _serverSocket(0, false),
-    _activePeers()
+    _serverSocket(0, false)
 {
     // start the ice-server socket
     qDebug() << "ice-server socket is listening on" << ICE_SERVER_DEFAULT_PORT;
@@ -50,6 +50,16 @@ IceServer::IceServer(int argc, char* argv[]) :
     connect(inactivePeerTimer, &QTimer::timeout, this, &IceServer::clearInactivePeers);
     inactivePeerTimer->start(CLEAR_INACTIVE_PEERS_INTERVAL_MSECS);
 
+    // setup our timer to report how many heartbeats needed an RSA verification
+    QTimer* verificationStatsTimer = new QTimer(this);
+    connect(verificationStatsTimer, &QTimer::timeout, this, &IceServer::printVerificationStats);
+    verificationStatsTimer->start(VERIFICATION_STATS_INTERVAL_MSECS);
+
+    // setup our timer to verify the heartbeats that arrived together
+    _heartbeatBatchTimer.setSingleShot(true);
+    _heartbeatBatchTimer.setInterval(0);
+    connect(&_heartbeatBatchTimer, &QTimer::timeout, this, &IceServer::processHeartbeats);
+
     // handle public keys when they arrive from the QNetworkAccessManager
     auto& networkAccessManager = NetworkAccessManager::getInstance();
     connect(&networkAccessManager, &QNetworkAccessManager::finished, this, &IceServer::publicKeyReplyFinished);
@@ -74,19 +84,13 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
     if (nlPacket->getPayloadSize() >= NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
         
         if (nlPacket->getType() == PacketType::ICEServerHeartbeat) {
-            SharedNetworkPeer peer = addOrUpdateHeartbeatingPeer(*nlPacket);
-            if (peer) {
-                // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
-                peer->activateMatchingOrNewSymmetricSocket(nlPacket->getSenderSockAddr());
-
-                // we have an active and verified heartbeating peer
-                // send them an ACK packet so they know that they are being heard and ready for ICE
-                static auto ackPacket = NLPacket::create(PacketType::ICEServerHeartbeatACK);
-                _serverSocket.writePacket(*ackPacket, nlPacket->getSenderSockAddr());
-            } else {
-                // we couldn't verify this peer - respond back to them so they know they may need to perform keypair re-generation
-                static auto deniedPacket = NLPacket::create(PacketType::ICEServerHeartbeatDenied);
-                _serverSocket.writePacket(*deniedPacket, nlPacket->getSenderSockAddr());
+            // verification dominates heartbeat processing, so heartbeats are verified in batches across threads
+            _pendingHeartbeats.push_back(std::move(nlPacket));
+            if (_pendingHeartbeats.size() >= MAX_HEARTBEAT_BATCH_SIZE) {
+                _heartbeatBatchTimer.stop();
+                processHeartbeats();
+            } else if (!_heartbeatBatchTimer.isActive()) {
+                _heartbeatBatchTimer.start();
             }
         } else if (nlPacket->getType() == PacketType::ICEServerQuery) {
             QDataStream heartbeatStream(nlPacket.get());
@@ -103,7 +107,7 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
             QUuid connectRequestID;
             heartbeatStream >> connectRequestID;
             
-            SharedNetworkPeer matchingPeer = _activePeers.value(connectRequestID);
+            SharedNetworkPeer matchingPeer = _peers.findPeer(connectRequestID);
             
             if (matchingPeer) {
                 
@@ -124,85 +128,51 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
     }
 }
 
-SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
-
-    // pull the UUID, public and private sock addrs for this peer
-    QUuid senderUUID;
-    HifiSockAddr publicSocket, localSocket;
-    QByteArray signature;
-
-    QDataStream heartbeatStream(&packet);
-    heartbeatStream >> senderUUID >> publicSocket >> localSocket;
+void IceServer::processHeartbeats() {
+    std::vector<std::unique_ptr<NLPacket>> heartbeats;
+    heartbeats.swap(_pendingHeartbeats);
 
-    auto signedPlaintext = QByteArray::fromRawData(packet.getPayload(), heartbeatStream.device()->pos());
-    heartbeatStream >> signature;
+    std::vector<IcePeerTable::HeartbeatResult> results(heartbeats.size());
+    std::vector<QUuid> domainIDs(heartbeats.size());
 
-    // make sure this is a verified heartbeat before performing any more processing
-    if (isVerifiedHeartbeat(senderUUID, signedPlaintext, signature)) {
-        // make sure we have this sender in our peer hash
-        SharedNetworkPeer matchingPeer = _activePeers.value(senderUUID);
+    tbb::parallel_for(size_t(0), heartbeats.size(), [&](size_t i) {
+        results[i] = verifyHeartbeat(*heartbeats[i], domainIDs[i]);
+    });
 
-        if (!matchingPeer) {
-            // if we don't have this sender we need to create them now
-            matchingPeer = QSharedPointer<NetworkPeer>::create(senderUUID, publicSocket, localSocket);
-            _activePeers.insert(senderUUID, matchingPeer);
+    // replies and public key requests go out from this thread, which owns the socket and the network access manager
+    for (size_t i = 0; i < heartbeats.size(); ++i) {
+        const HifiSockAddr& senderSockAddr = heartbeats[i]->getSenderSockAddr();
 
-            qDebug() << "Added a new network peer" << *matchingPeer;
+        if (results[i] == IcePeerTable::HeartbeatResult::Verified) {
+            // we have an active and verified heartbeating peer
+            // send them an ACK packet so they know that they are being heard and ready for ICE
+            static auto ackPacket = NLPacket::create(PacketType::ICEServerHeartbeatACK);
+            _serverSocket.writePacket(*ackPacket, senderSockAddr);
         } else {
-            // we already had the peer so just potentially update their sockets
-            matchingPeer->setPublicSocket(publicSocket);
-            matchingPeer->setLocalSocket(localSocket);
-        }
+            if (results[i] == IcePeerTable::HeartbeatResult::DeniedNeedsPublicKey) {
+                // ask the metaverse API for the right public key
+                requestDomainPublicKey(domainIDs[i]);
+            }
 
-        // update our last heard microstamp for this network peer to now
-        matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
-        
-        return matchingPeer;
-    } else {
-        // not verified, return the empty peer object
-        return SharedNetworkPeer();
+            // we couldn't verify this peer - respond back to them so they know they may need to perform keypair re-generation
+            static auto deniedPacket = NLPacket::create(PacketType::ICEServerHeartbeatDenied);
+            _serverSocket.writePacket(*deniedPacket, senderSockAddr);
+        }
     }
 }
 
-bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature) {
-    // make sure we're not already waiting for a public key for this domain-server
-    if (!_pendingPublicKeyRequests.contains(domainID)) {
-        // check if we have a public key for this domain ID - if we do not then fire off the request for it
-        auto it = _domainPublicKeys.find(domainID);
-        if (it != _domainPublicKeys.end()) {
-
-            // attempt to verify the signature for this heartbeat
-            const auto rsaPublicKey = it->second.get();
-
-            if (rsaPublicKey) {
-                auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
-                int verificationResult = RSA_verify(NID_sha256,
-                                                    reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
-                                                    hashedPlaintext.size(),
-                                                    reinterpret_cast<const unsigned char*>(signature.constData()),
-                                                    signature.size(),
-                                                    rsaPublicKey);
-
-                if (verificationResult == 1) {
-                    // this is the only success case - we return true here to indicate that the heartbeat is verified
-                    return true;
-                } else {
-                    qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
-                }
+IcePeerTable::HeartbeatResult IceServer::verifyHeartbeat(NLPacket& packet, QUuid& domainID) {
+    // pull the UUID, public and private sock addrs for this peer
+    HifiSockAddr publicSocket, localSocket;
+    QByteArray signature;
 
-            } else {
-                // we can't let this user in since we couldn't convert their public key to an RSA key we could use
-                qWarning() << "Public key for" << domainID << "is not a usable RSA* public key.";
-                qWarning() << "Re-requesting public key from API";
-            }
-        }
+    QDataStream heartbeatStream(&packet);
+    heartbeatStream >> domainID >> publicSocket >> localSocket;
 
-        // we could not verify this heartbeat (missing public key, could not load public key, bad actor)
-        // ask the metaverse API for the right public key and return false to indicate that this is not verified
-        requestDomainPublicKey(domainID);
-    }
+    auto signedPlaintext = QByteArray::fromRawData(packet.getPayload(), heartbeatStream.device()->pos());
+    heartbeatStream >> signature;
 
-    return false;
+    return _peers.processHeartbeat(domainID, publicSocket, localSocket, signedPlaintext, signature, packet.getSenderSockAddr());
 }
 
 void IceServer::requestDomainPublicKey(const QUuid& domainID) {
@@ -219,15 +189,13 @@ void IceServer::requestDomainPublicKey(const QUuid& domainID) {
 
     qDebug() << "Requesting public key for domain with ID" << domainID;
 
-    // add this to the set of pending public key requests
-    _pendingPublicKeyRequests.insert(domainID);
-
     networkAccessManager.get(publicKeyRequest);
 }
 
 void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
     // get the domain ID from the QNetworkReply attribute
     QUuid domainID = reply->request().attribute(QNetworkRequest::User).toUuid();
+    IcePeerTable::RSAPointer publicKey;
 
     if (reply->error() == QNetworkReply::NoError) {
         // pull out the public key and store it for this domain
@@ -254,7 +222,7 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
                 RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, apiPublicKey.size());
 
                 if (rsaPublicKey) {
-                    _domainPublicKeys[domainID] = { rsaPublicKey, RSA_free };
+                    publicKey = IcePeerTable::RSAPointer(rsaPublicKey, RSA_free);
                 } else {
                     qWarning() << "Could not convert in-memory public key for" << domainID << "to usable RSA public key.";
                     qWarning() << "Public key will be re-requested on next heartbeat.";
@@ -274,8 +242,8 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
         qWarning() << "Error retreiving public key for domain with ID" << domainID << "-" <<  reply->errorString();
     }
 
-    // remove this domain ID from the list of pending public key requests
-    _pendingPublicKeyRequests.remove(domainID);
+    // store the key, if we got one, and clear the pending public key request for this domain
+    _peers.setPublicKey(domainID, publicKey);
 
     reply->deleteLater();
 }
@@ -291,22 +259,21 @@ void IceServer::sendPeerInformationPacket(const NetworkPeer& peer, const HifiSoc
 }
 
 void IceServer::clearInactivePeers() {
-    NetworkPeerHash::iterator peerItem = _activePeers.begin();
-
-    while (peerItem != _activePeers.end()) {
-        SharedNetworkPeer peer = peerItem.value();
-
-        if ((usecTimestampNow() - peer->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
-            qDebug() << "Removing peer from memory for inactivity -" << *peer;
-
-            // if we had a public key for this domain, remove it now
-            _domainPublicKeys.erase(peer->getUUID());
+    _peers.clearInactivePeers();
+}
 
-            // remove the peer object
-            peerItem = _activePeers.erase(peerItem);
-        } else {
-            // we didn't kill this peer, push the iterator forwards
-            ++peerItem;
-        }
+void IceServer::printVerificationStats() {
+    quint64 numVerifications = _peers.getNumVerifications();
+    quint64 numCachedVerifications = _peers.getNumCachedVerifications();
+    if (numVerifications == _lastNumVerifications && numCachedVerifications == _lastNumCachedVerifications) {
+        return;
     }
+
+    qDebug().noquote() << QString("heartbeats verified/s: %1 cached/s: %2 (total verified: %3 cached: %4)")
+        .arg(numVerifications - _lastNumVerifications)
+        .arg(numCachedVerifications - _lastNumCachedVerifications)
+        .arg(numVerifications)
+        .arg(numCachedVerifications);
+    _lastNumVerifications = numVerifications;
+    _lastNumCachedVerifications = numCachedVerifications;
 }
@@ -12,8 +12,11 @@
 #ifndef hifi_IceServer_h
 #define hifi_IceServer_h
 
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QTimer>
 #include <QUdpSocket>
 
 #include <openssl/rsa.h>
@@ -26,36 +29,42 @@
 #include <NLPacket.h>
 #include <udt/Socket.h>
 
+#include "IcePeerTable.h"
+
 class QNetworkReply;
 
+const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
+const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
+const int VERIFICATION_STATS_INTERVAL_MSECS = 1 * 1000;
+
 class IceServer : public QCoreApplication {
     Q_OBJECT
 public:
     IceServer(int argc, char* argv[]);
 private slots:
     void clearInactivePeers();
+    void printVerificationStats();
     void publicKeyReplyFinished(QNetworkReply* reply);
+    void processHeartbeats();
 private:
     bool packetVersionMatch(const udt::Packet& packet);
     void processPacket(std::unique_ptr<udt::Packet> packet);
     
-    SharedNetworkPeer addOrUpdateHeartbeatingPeer(NLPacket& incomingPacket);
+    IcePeerTable::HeartbeatResult verifyHeartbeat(NLPacket& packet, QUuid& domainID);
     void sendPeerInformationPacket(const NetworkPeer& peer, const HifiSockAddr* destinationSockAddr);
 
-    bool isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature);
     void requestDomainPublicKey(const QUuid& domainID);
 
     QUuid _id;
     udt::Socket _serverSocket;
 
-    using NetworkPeerHash = QHash<QUuid, SharedNetworkPeer>;
-    NetworkPeerHash _activePeers;
-
-    using RSAUniquePtr = std::unique_ptr<RSA, std::function<void(RSA*)>>;
-    using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
-    DomainPublicKeyHash _domainPublicKeys;
+    IcePeerTable _peers;
+    quint64 _lastNumVerifications { 0 };
+    quint64 _lastNumCachedVerifications { 0 };
 
-    QSet<QUuid> _pendingPublicKeyRequests;
+    // heartbeats received since the last batch, verified together across threads
+    std::vector<std::unique_ptr<NLPacket>> _pendingHeartbeats;
+    QTimer _heartbeatBatchTimer;
 };
 
 #endif // hifi_IceServer_h
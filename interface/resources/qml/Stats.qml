@@ -291,12 +291,19 @@ Item {
                     StatText {
                         visible: root.expanded;
                         text: "Downloads: " + root.downloads + "/" + root.downloadLimit +
-                              ", Pending: " + root.downloadsPending;
+                              ", Pending: " + root.downloadsPending +
+                              ", Wait: " + root.downloadWait.toFixed(1) + " ms";
                     }
                     StatText {
                         visible: root.expanded;
                         text: "Processing: " + root.processing +
-                              ", Pending: " + root.processingPending;
+                              ", Pending: " + root.processingPending +
+                              ", Wait: " + root.processingWait.toFixed(1) + " ms";
+                    }
+                    StatText {
+                        visible: root.expanded;
+                        text: "Uploads Pending: " + root.uploadsPending +
+                              ", Wait: " + root.uploadWait.toFixed(1) + " ms";
                     }
                     StatText {
                         visible: root.expanded && root.downloadUrls.length > 0;
@@ -91,6 +91,7 @@
 #include <FramebufferCache.h>
 #include <gpu/Batch.h>
 #include <gpu/Context.h>
+#include <image/TextureProcessing.h>
 #include <InfoView.h>
 #include <input-plugins/InputPlugin.h>
 #include <controllers/UserInputMapper.h>
@@ -338,6 +339,12 @@ Setting::Handle<int> maxOctreePacketsPerSecond{"maxOctreePPS", DEFAULT_MAX_OCTRE
 
 Setting::Handle<bool> loginDialogPoppedUp{"loginDialogPoppedUp", false};
 
+// 1 keeps physics on the simulation thread, more spreads each step over that many TBB workers
+Setting::Handle<int> physicsNumThreads{"physicsNumThreads", 1};
+
+// 0 lets texture compression use as many threads as the processing thread pool
+Setting::Handle<int> textureCompressionNumThreads{"textureCompressionNumThreads", 0};
+
 static const QUrl AVATAR_INPUTS_BAR_QML = PathUtils::qmlUrl("AvatarInputsBar.qml");
 static const QUrl MIC_BAR_APPLICATION_QML = PathUtils::qmlUrl("hifi/audio/MicBarApplication.qml");
 static const QUrl BUBBLE_ICON_QML = PathUtils::qmlUrl("BubbleIcon.qml");
@@ -5558,7 +5565,8 @@ void Application::init() {
         auto dims = item.getScaledDimensions();
         auto maxSize = glm::compMax(dims);
 
-        if (maxSize <= 0.0f) {
+        // invisible entities still load, for their collisions, but after everything that can be seen
+        if (maxSize <= 0.0f || !item.getVisible()) {
             return 0.0f;
         }
 
@@ -5566,8 +5574,12 @@ void Application::init() {
         return atan2(maxSize, distance);
     });
 
+    // read the shapes built on earlier visits before any entity asks for one
+    auto shapeCache = std::make_shared<ShapeCache>();
+    shapeCache->initialize();
+    _shapeManager.setShapeCache(shapeCache);
     ObjectMotionState::setShapeManager(&_shapeManager);
-    _physicsEngine->init();
+    _physicsEngine->init(physicsNumThreads.get());
 
     EntityTreePointer tree = getEntities()->getTree();
     _entitySimulation->init(tree, _physicsEngine, &_entityEditSender);
@@ -6512,13 +6524,14 @@ void Application::update(float deltaTime) {
 
                     auto t5 = std::chrono::high_resolution_clock::now();
 
-                    workload::Timings timings(6);
+                    workload::Timings timings(7);
                     timings[0] = t1 - t0; // prePhysics entities
                     timings[1] = t2 - t1; // prePhysics avatars
                     timings[2] = t3 - t2; // stepPhysics
                     timings[3] = t4 - t3; // postPhysics
                     timings[4] = t5 - t4; // non-physical kinematics
                     timings[5] = workload::Timing_ns((int32_t)(NSECS_PER_SECOND * deltaTime)); // game loop duration
+                    timings[6] = getEntities()->getWorkloadSpace()->getClassificationTime(); // last space classification
                     _gameWorkload.updateSimulationTimings(timings);
                 }
             }
@@ -9285,6 +9298,14 @@ void Application::updateThreadPoolCount() const {
     qCDebug(interfaceapp) << "Reserved threads " << reservedThreads;
     qCDebug(interfaceapp) << "Setting thread pool size to " << threadPoolSize;
     QThreadPool::globalInstance()->setMaxThreadCount(threadPoolSize);
+
+    // the resource decode stage gets its own pool of the same size, so that downloads being processed don't starve
+    // the other work on the global pool, nor the other way around
+    ResourceCache::setMaxDecodeJobs(threadPoolSize);
+
+    // the texture readers run on the decode stage, their compression shares its cores rather than each using them all
+    auto compressionThreads = textureCompressionNumThreads.get();
+    image::setCompressionThreadBudget(compressionThreads > 0 ? compressionThreads : threadPoolSize);
 }
 
 void Application::updateSystemTabletMode() {
@@ -293,6 +293,13 @@ void Stats::updateStats(bool force) {
         STAT_UPDATE(downloadsPending, (int)ResourceCache::getPendingRequestCount());
         STAT_UPDATE(processing, DependencyManager::get<StatTracker>()->getStat("Processing").toInt());
         STAT_UPDATE(processingPending, DependencyManager::get<StatTracker>()->getStat("PendingProcessing").toInt());
+        STAT_UPDATE_FLOAT(downloadWait, ResourceCache::getStageStats(ResourceScheduler::NETWORK).averageWaitMsecs, 0.1f);
+        STAT_UPDATE_FLOAT(processingWait, ResourceCache::getStageStats(ResourceScheduler::DECODE).averageWaitMsecs, 0.1f);
+        {
+            auto uploadStats = ResourceCache::getStageStats(ResourceScheduler::UPLOAD);
+            STAT_UPDATE(uploadsPending, (int)uploadStats.queueDepth);
+            STAT_UPDATE_FLOAT(uploadWait, uploadStats.averageWaitMsecs, 0.1f);
+        }
 
         // See if the active download urls have changed
         bool shouldUpdateUrls = _downloads != _downloadUrls.size();
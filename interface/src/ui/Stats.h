@@ -95,8 +95,14 @@ private: \
  * @property {number} downloadLimit - <em>Read-only.</em>
  * @property {number} downloadsPending - <em>Read-only.</em>
  * @property {string[]} downloadUrls - <em>Read-only.</em>
+ * @property {number} downloadWait - Average time in milliseconds that recent downloads waited to start. <em>Read-only.</em>
  * @property {number} processing - <em>Read-only.</em>
  * @property {number} processingPending - <em>Read-only.</em>
+ * @property {number} processingWait - Average time in milliseconds that recent downloaded resources waited to be processed.
+ *     <em>Read-only.</em>
+ * @property {number} uploadsPending - Number of processed resources waiting to be handed over. <em>Read-only.</em>
+ * @property {number} uploadWait - Average time in milliseconds that recent processed resources waited to be handed over.
+ *     <em>Read-only.</em>
  * @property {number} triangles - <em>Read-only.</em>
  * @property {number} materialSwitches - <em>Read-only.</em>
  * @property {number} itemConsidered - <em>Read-only.</em>
@@ -259,8 +265,12 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, downloadLimit, 0)
     STATS_PROPERTY(int, downloadsPending, 0)
     Q_PROPERTY(QStringList downloadUrls READ downloadUrls NOTIFY downloadUrlsChanged)
+    STATS_PROPERTY(float, downloadWait, 0)
     STATS_PROPERTY(int, processing, 0)
     STATS_PROPERTY(int, processingPending, 0)
+    STATS_PROPERTY(float, processingWait, 0)
+    STATS_PROPERTY(int, uploadsPending, 0)
+    STATS_PROPERTY(float, uploadWait, 0)
     STATS_PROPERTY(int, triangles, 0)
     STATS_PROPERTY(quint32 , drawcalls, 0)
     STATS_PROPERTY(int, materialSwitches, 0)
@@ -770,6 +780,34 @@ signals:
      */
     void processingPendingChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>downloadWait</code> property changes.
+     * @function Stats.downloadWaitChanged
+     * @returns {Signal}
+     */
+    void downloadWaitChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>processingWait</code> property changes.
+     * @function Stats.processingWaitChanged
+     * @returns {Signal}
+     */
+    void processingWaitChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>uploadsPending</code> property changes.
+     * @function Stats.uploadsPendingChanged
+     * @returns {Signal}
+     */
+    void uploadsPendingChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>uploadWait</code> property changes.
+     * @function Stats.uploadWaitChanged
+     * @returns {Signal}
+     */
+    void uploadWaitChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>triangles</code> property changes.
      * @function Stats.trianglesChanged
@@ -47,7 +47,7 @@ protected:
     QString _downLeftId;
     QString _downRightId;
 
-    QString _alphaVar;
+    AnimVariantKey _alphaVar;
 
     int _childIndices[3][3];
 
@@ -14,10 +14,16 @@
 #include "AnimUtil.h"
 #include "AnimClip.h"
 
+static const AnimVariantKey MOVE_FORWARD_SPEED_VAR("moveForwardSpeed");
+static const AnimVariantKey MOVE_BACKWARD_SPEED_VAR("moveBackwardSpeed");
+static const AnimVariantKey MOVE_LATERAL_SPEED_VAR("moveLateralSpeed");
+
 AnimBlendLinearMove::AnimBlendLinearMove(const QString& id, float alpha, float desiredSpeed, const std::vector<float>& characteristicSpeeds) :
     AnimNode(AnimNode::Type::BlendLinearMove, id),
     _alpha(alpha),
     _desiredSpeed(desiredSpeed),
+    _speedVar(MOVE_FORWARD_SPEED_VAR),
+    _onLoopTrigger(id + "OnLoop"),
     _characteristicSpeeds(characteristicSpeeds) {
 
 }
@@ -26,6 +32,18 @@ AnimBlendLinearMove::~AnimBlendLinearMove() {
 
 }
 
+void AnimBlendLinearMove::setAlphaVar(const QString& alphaVar) {
+    _alphaVar = alphaVar;
+    if (alphaVar.contains("Lateral")) {
+        _speedVar = MOVE_LATERAL_SPEED_VAR;
+    } else if (alphaVar.contains("Backward")) {
+        _speedVar = MOVE_BACKWARD_SPEED_VAR;
+    } else {
+        //this is forward movement
+        _speedVar = MOVE_FORWARD_SPEED_VAR;
+    }
+}
+
 static float calculateAlpha(const float speed, const std::vector<float>& characteristicSpeeds) {
 
     assert(characteristicSpeeds.size() > 0);
@@ -52,15 +70,7 @@ const AnimPoseVec& AnimBlendLinearMove::evaluate(const AnimVariantMap& animVars,
 
     _desiredSpeed = animVars.lookup(_desiredSpeedVar, _desiredSpeed);
 
-    float speed = 0.0f;
-    if (_alphaVar.contains("Lateral")) {
-        speed = animVars.lookup("moveLateralSpeed", speed);
-    } else if (_alphaVar.contains("Backward")) {
-        speed = animVars.lookup("moveBackwardSpeed", speed);
-    } else {
-        //this is forward movement
-        speed = animVars.lookup("moveForwardSpeed", speed);
-    }
+    float speed = animVars.lookup(_speedVar, 0.0f);
     _alpha = calculateAlpha(speed, _characteristicSpeeds);
     float parentDebugAlpha = context.getDebugAlpha(_id);
 
@@ -154,7 +164,7 @@ void AnimBlendLinearMove::setFrameAndPhase(float dt, float alpha, int prevPoseIn
 
     // detect loop trigger events
     if (_phase >= 1.0f) {
-        triggersOut.setTrigger(_id + "OnLoop");
+        triggersOut.setTrigger(_onLoopTrigger);
         _phase = glm::fract(_phase);
     }
 
@@ -41,7 +41,7 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setAlphaVar(const QString& alphaVar) { _alphaVar = alphaVar; }
+    void setAlphaVar(const QString& alphaVar);
     void setDesiredSpeedVar(const QString& desiredSpeedVar) { _desiredSpeedVar = desiredSpeedVar; }
 
 protected:
@@ -64,8 +64,10 @@ protected:
 
     float _phase = 0.0f;
 
-    QString _alphaVar;
-    QString _desiredSpeedVar;
+    AnimVariantKey _alphaVar;
+    AnimVariantKey _desiredSpeedVar;
+    AnimVariantKey _speedVar; // the movement speed that drives the blend, chosen by the direction of _alphaVar
+    AnimVariantKey _onLoopTrigger;
 
     std::vector<float> _characteristicSpeeds;
 
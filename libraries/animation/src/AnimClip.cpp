@@ -233,7 +233,9 @@ AnimClip::AnimClip(const QString& id, const QString& url, float startFrame, floa
     _mirrorFlag(mirrorFlag),
     _frame(startFrame),
     _blendType(blendType),
-    _baseFrame(baseFrame)
+    _baseFrame(baseFrame),
+    _onLoopTrigger(id + "OnLoop"),
+    _onDoneTrigger(id + "OnDone")
 {
     loadURL(url);
 
@@ -258,7 +260,7 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
     _mirrorFlag = animVars.lookup(_mirrorFlagVar, _mirrorFlag);
     float frame = animVars.lookup(_frameVar, _frame);
 
-    _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame, dt, _loopFlag, _id, triggersOut);
+    _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame, dt, _loopFlag, _onLoopTrigger, _onDoneTrigger, triggersOut);
 
     // poll network anim to see if it's finished loading yet.
     if (_blendType == AnimBlendType_Normal) {
@@ -338,7 +340,7 @@ void AnimClip::setCurrentFrameInternal(float frame) {
     // because dt is 0, we should not encounter any triggers
     const float dt = 0.0f;
     AnimVariantMap triggers;
-    _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _id, triggers);
+    _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _onLoopTrigger, _onDoneTrigger, triggers);
 }
 
 void AnimClip::buildMirrorAnim() {
@@ -651,7 +651,7 @@ void AnimExpression::dumpOpCodes() const {
     QString tmp;
     for (auto& op : _opCodes) {
         switch (op.type) {
-        case OpCode::Identifier: tmp += QString(" %1").arg(op.strVal); break;
+        case OpCode::Identifier: tmp += QString(" %1").arg(op.strVal.getName()); break;
         case OpCode::Bool: tmp += QString(" %1").arg(op.intVal ? "true" : "false"); break;
         case OpCode::Int: tmp += QString(" %1").arg(op.intVal); break;
         case OpCode::Float: tmp += QString(" %1").arg(op.floatVal); break;
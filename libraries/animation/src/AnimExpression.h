@@ -100,7 +100,7 @@ protected:
         }
 
         Type type {Int};
-        QString strVal;
+        AnimVariantKey strVal;
         int intVal {0};
         float floatVal {0.0f};
     };
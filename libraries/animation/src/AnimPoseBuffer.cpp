@@ -0,0 +1,304 @@
+//
+//  AnimPoseBuffer.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseBuffer.h"
+
+#include <assert.h>
+#include <math.h>
+#include <algorithm>
+
+#include <GLMHelpers.h>
+
+#include "AnimationLogging.h"
+
+static const float IDENTITY_COMPONENTS[AnimPoseBuffer::NumComponents] = {
+    1.0f, 1.0f, 1.0f,       // scale
+    0.0f, 0.0f, 0.0f, 1.0f, // rot
+    0.0f, 0.0f, 0.0f        // trans
+};
+
+void AnimPoseBuffer::resize(int numPoses) {
+    int stride = (numPoses + POSE_BUFFER_SIMD_WIDTH - 1) & ~(POSE_BUFFER_SIMD_WIDTH - 1);
+    if (stride != _stride) {
+        std::vector<float> data(NumComponents * stride);
+        for (int c = 0; c < NumComponents; c++) {
+            float* dst = data.data() + c * stride;
+            int numToCopy = std::min(_size, numPoses);
+            for (int i = 0; i < stride; i++) {
+                dst[i] = (i < numToCopy) ? _data[c * _stride + i] : IDENTITY_COMPONENTS[c];
+            }
+        }
+        _data.swap(data);
+        _stride = stride;
+    } else {
+        // keep the padding at identity
+        for (int c = 0; c < NumComponents; c++) {
+            float* dst = component((Component)c);
+            for (int i = numPoses; i < _size; i++) {
+                dst[i] = IDENTITY_COMPONENTS[c];
+            }
+        }
+    }
+    _size = numPoses;
+}
+
+AnimPose AnimPoseBuffer::getPose(int i) const {
+    assert(i >= 0 && i < _size);
+    const float* p = _data.data() + i;
+    return AnimPose(glm::vec3(p[ScaleX * _stride], p[ScaleY * _stride], p[ScaleZ * _stride]),
+                    glm::quat(p[RotW * _stride], p[RotX * _stride], p[RotY * _stride], p[RotZ * _stride]),
+                    glm::vec3(p[TransX * _stride], p[TransY * _stride], p[TransZ * _stride]));
+}
+
+void AnimPoseBuffer::setPose(int i, const AnimPose& pose) {
+    assert(i >= 0 && i < _size);
+    float* p = _data.data() + i;
+    p[ScaleX * _stride] = pose.scale().x;
+    p[ScaleY * _stride] = pose.scale().y;
+    p[ScaleZ * _stride] = pose.scale().z;
+    p[RotX * _stride] = pose.rot().x;
+    p[RotY * _stride] = pose.rot().y;
+    p[RotZ * _stride] = pose.rot().z;
+    p[RotW * _stride] = pose.rot().w;
+    p[TransX * _stride] = pose.trans().x;
+    p[TransY * _stride] = pose.trans().y;
+    p[TransZ * _stride] = pose.trans().z;
+}
+
+void AnimPoseBuffer::fromPoses(const AnimPoseVec& poses) {
+    resize((int)poses.size());
+    for (int i = 0; i < _size; i++) {
+        setPose(i, poses[i]);
+    }
+}
+
+void AnimPoseBuffer::toPoses(AnimPoseVec& poses) const {
+    poses.resize(_size);
+    for (int i = 0; i < _size; i++) {
+        poses[i] = getPose(i);
+    }
+}
+
+void AnimPoseBuffer::fromPoses(const AnimPoseVec& poses, const std::vector<int>& order) {
+    resize((int)order.size());
+    for (int i = 0; i < _size; i++) {
+        setPose(i, poses[order[i]]);
+    }
+}
+
+void AnimPoseBuffer::toPoses(AnimPoseVec& poses, const std::vector<int>& order) const {
+    assert((int)order.size() == _size);
+    for (int i = 0; i < _size; i++) {
+        poses[order[i]] = getPose(i);
+    }
+}
+
+AnimPoseHierarchy::AnimPoseHierarchy(const std::vector<int>& parentIndices) {
+    int numJoints = (int)parentIndices.size();
+
+    // find the depth of each joint, walking up the parent chain guards against joints listed before their parents.
+    std::vector<int> depths(numJoints, 0);
+    int maxDepth = 0;
+    for (int i = 0; i < numJoints; i++) {
+        int depth = 0;
+        int parentIndex = parentIndices[i];
+        while (parentIndex >= 0 && parentIndex < numJoints && depth < numJoints) {
+            depth++;
+            parentIndex = parentIndices[parentIndex];
+        }
+        depths[i] = depth;
+        maxDepth = std::max(maxDepth, depth);
+    }
+
+    // counting sort by depth, keeping joint order within a level
+    _levelOffsets.assign(numJoints > 0 ? maxDepth + 2 : 0, 0);
+    for (int i = 0; i < numJoints; i++) {
+        _levelOffsets[depths[i] + 1]++;
+    }
+    for (int level = 1; level < (int)_levelOffsets.size(); level++) {
+        _levelOffsets[level] += _levelOffsets[level - 1];
+    }
+
+    _order.resize(numJoints);
+    std::vector<int> jointToSlot(numJoints);
+    std::vector<int> nextSlot(_levelOffsets.begin(), _levelOffsets.end());
+    for (int i = 0; i < numJoints; i++) {
+        int slot = nextSlot[depths[i]]++;
+        _order[slot] = i;
+        jointToSlot[i] = slot;
+    }
+
+    _parentSlots.resize(numJoints);
+    for (int slot = 0; slot < numJoints; slot++) {
+        int parentIndex = parentIndices[_order[slot]];
+        _parentSlots[slot] = (parentIndex >= 0 && parentIndex < numJoints) ? jointToSlot[parentIndex] : -1;
+    }
+}
+
+//
+// portable reference kernels
+//
+
+static inline void composePose(const float* parent, int parentStride, const float* child, int childStride, float out[AnimPoseBuffer::NumComponents]) {
+    float psx = parent[AnimPoseBuffer::ScaleX * parentStride];
+    float psy = parent[AnimPoseBuffer::ScaleY * parentStride];
+    float psz = parent[AnimPoseBuffer::ScaleZ * parentStride];
+    float prx = parent[AnimPoseBuffer::RotX * parentStride];
+    float pry = parent[AnimPoseBuffer::RotY * parentStride];
+    float prz = parent[AnimPoseBuffer::RotZ * parentStride];
+    float prw = parent[AnimPoseBuffer::RotW * parentStride];
+
+    float crx = child[AnimPoseBuffer::RotX * childStride];
+    float cry = child[AnimPoseBuffer::RotY * childStride];
+    float crz = child[AnimPoseBuffer::RotZ * childStride];
+    float crw = child[AnimPoseBuffer::RotW * childStride];
+
+    out[AnimPoseBuffer::ScaleX] = psx * child[AnimPoseBuffer::ScaleX * childStride];
+    out[AnimPoseBuffer::ScaleY] = psy * child[AnimPoseBuffer::ScaleY * childStride];
+    out[AnimPoseBuffer::ScaleZ] = psz * child[AnimPoseBuffer::ScaleZ * childStride];
+
+    out[AnimPoseBuffer::RotX] = prw * crx + prx * crw + pry * crz - prz * cry;
+    out[AnimPoseBuffer::RotY] = prw * cry - prx * crz + pry * crw + prz * crx;
+    out[AnimPoseBuffer::RotZ] = prw * crz + prx * cry - pry * crx + prz * crw;
+    out[AnimPoseBuffer::RotW] = prw * crw - prx * crx - pry * cry - prz * crz;
+
+    // rotate the scaled child translation by the parent rotation: v + w * t + cross(q, t), where t = 2 * cross(q, v)
+    float vx = psx * child[AnimPoseBuffer::TransX * childStride];
+    float vy = psy * child[AnimPoseBuffer::TransY * childStride];
+    float vz = psz * child[AnimPoseBuffer::TransZ * childStride];
+    float tx = 2.0f * (pry * vz - prz * vy);
+    float ty = 2.0f * (prz * vx - prx * vz);
+    float tz = 2.0f * (prx * vy - pry * vx);
+    out[AnimPoseBuffer::TransX] = parent[AnimPoseBuffer::TransX * parentStride] + vx + prw * tx + (pry * tz - prz * ty);
+    out[AnimPoseBuffer::TransY] = parent[AnimPoseBuffer::TransY * parentStride] + vy + prw * ty + (prz * tx - prx * tz);
+    out[AnimPoseBuffer::TransZ] = parent[AnimPoseBuffer::TransZ * parentStride] + vz + prw * tz + (prx * ty - pry * tx);
+}
+
+static void blendPoses_ref(const float* a, const float* b, float* result, int stride, int numPoses, float alpha) {
+    float beta = 1.0f - alpha;
+    for (int i = 0; i < numPoses; i++) {
+        for (int c = AnimPoseBuffer::ScaleX; c <= AnimPoseBuffer::ScaleZ; c++) {
+            result[c * stride + i] = beta * a[c * stride + i] + alpha * b[c * stride + i];
+        }
+        for (int c = AnimPoseBuffer::TransX; c <= AnimPoseBuffer::TransZ; c++) {
+            result[c * stride + i] = beta * a[c * stride + i] + alpha * b[c * stride + i];
+        }
+
+        // take the shortest path
+        float dot = 0.0f;
+        for (int c = AnimPoseBuffer::RotX; c <= AnimPoseBuffer::RotW; c++) {
+            dot += a[c * stride + i] * b[c * stride + i];
+        }
+        float bAlpha = dot < 0.0f ? -alpha : alpha;
+
+        float rot[4];
+        float lengthSquared = 0.0f;
+        for (int c = AnimPoseBuffer::RotX; c <= AnimPoseBuffer::RotW; c++) {
+            float r = beta * a[c * stride + i] + bAlpha * b[c * stride + i];
+            rot[c - AnimPoseBuffer::RotX] = r;
+            lengthSquared += r * r;
+        }
+        float oneOverLength = 1.0f / sqrtf(lengthSquared);
+        for (int c = AnimPoseBuffer::RotX; c <= AnimPoseBuffer::RotW; c++) {
+            result[c * stride + i] = rot[c - AnimPoseBuffer::RotX] * oneOverLength;
+        }
+    }
+}
+
+static void multiplyPoses_ref(const float* a, const float* b, float* result, int stride, int numPoses) {
+    for (int i = 0; i < numPoses; i++) {
+        float out[AnimPoseBuffer::NumComponents];
+        composePose(a + i, stride, b + i, stride, out);
+        for (int c = 0; c < AnimPoseBuffer::NumComponents; c++) {
+            result[c * stride + i] = out[c];
+        }
+    }
+}
+
+static void composeLevel_ref(float* poses, int stride, const int* parentSlots, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        float out[AnimPoseBuffer::NumComponents];
+        composePose(poses + parentSlots[i], stride, poses + i, stride, out);
+        for (int c = 0; c < AnimPoseBuffer::NumComponents; c++) {
+            poses[c * stride + i] = out[c];
+        }
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+//
+// Runtime CPU dispatch
+//
+
+#include "CPUDetect.h"
+
+void blendPoses_AVX2(const float* a, const float* b, float* result, int stride, int numPoses, float alpha);
+void multiplyPoses_AVX2(const float* a, const float* b, float* result, int stride, int numPoses);
+void composeLevel_AVX2(float* poses, int stride, const int* parentSlots, int begin, int end);
+
+static void blendPoses(const float* a, const float* b, float* result, int stride, int numPoses, float alpha) {
+    static auto f = cpuSupportsAVX2() ? blendPoses_AVX2 : blendPoses_ref;
+    (*f)(a, b, result, stride, numPoses, alpha); // dispatch
+}
+
+static void multiplyPoses(const float* a, const float* b, float* result, int stride, int numPoses) {
+    static auto f = cpuSupportsAVX2() ? multiplyPoses_AVX2 : multiplyPoses_ref;
+    (*f)(a, b, result, stride, numPoses); // dispatch
+}
+
+static void composeLevel(float* poses, int stride, const int* parentSlots, int begin, int end) {
+    static auto f = cpuSupportsAVX2() ? composeLevel_AVX2 : composeLevel_ref;
+    (*f)(poses, stride, parentSlots, begin, end); // dispatch
+}
+
+#else   // portable reference code
+
+static void blendPoses(const float* a, const float* b, float* result, int stride, int numPoses, float alpha) {
+    blendPoses_ref(a, b, result, stride, numPoses, alpha);
+}
+
+static void multiplyPoses(const float* a, const float* b, float* result, int stride, int numPoses) {
+    multiplyPoses_ref(a, b, result, stride, numPoses);
+}
+
+static void composeLevel(float* poses, int stride, const int* parentSlots, int begin, int end) {
+    composeLevel_ref(poses, stride, parentSlots, begin, end);
+}
+
+#endif
+
+void blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseBuffer& result) {
+    assert(a.size() == b.size());
+    result.resize(a.size());
+    // the padding holds identity poses, so it is safe to process whole simd groups
+    blendPoses(a.data(), b.data(), result.data(), result.getStride(), result.getStride(), alpha);
+}
+
+void multiply(const AnimPoseBuffer& a, const AnimPoseBuffer& b, AnimPoseBuffer& result) {
+    assert(a.size() == b.size());
+    result.resize(a.size());
+    multiplyPoses(a.data(), b.data(), result.data(), result.getStride(), result.getStride());
+}
+
+void convertRelativePosesToAbsolute(const AnimPoseHierarchy& hierarchy, AnimPoseBuffer& poses) {
+    const std::vector<int>& levelOffsets = hierarchy.getLevelOffsets();
+    if ((int)hierarchy.getOrder().size() != poses.size()) {
+        qCWarning(animation) << "convertRelativePosesToAbsolute: pose count" << poses.size()
+            << "does not match hierarchy" << hierarchy.getOrder().size();
+        return;
+    }
+
+    // level 0 holds the roots, which are already absolute.
+    const int* parentSlots = hierarchy.getParentSlots().data();
+    for (int level = 1; level < hierarchy.getNumLevels(); level++) {
+        composeLevel(poses.data(), poses.getStride(), parentSlots, levelOffsets[level], levelOffsets[level + 1]);
+    }
+}
@@ -0,0 +1,107 @@
+//
+//  AnimPoseBuffer.h
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseBuffer_h
+#define hifi_AnimPoseBuffer_h
+
+#include <vector>
+
+#include "AnimPose.h"
+
+// Structure-of-arrays storage for a set of AnimPoses.
+// Each pose component is kept in its own float array, padded up to a multiple of POSE_BUFFER_SIMD_WIDTH with
+// identity poses, so the kernels below can work on eight poses at a time.
+class AnimPoseBuffer {
+public:
+    enum Component {
+        ScaleX = 0,
+        ScaleY,
+        ScaleZ,
+        RotX,
+        RotY,
+        RotZ,
+        RotW,
+        TransX,
+        TransY,
+        TransZ,
+        NumComponents
+    };
+
+    static const int POSE_BUFFER_SIMD_WIDTH = 8;
+
+    AnimPoseBuffer() {}
+    explicit AnimPoseBuffer(int numPoses) { resize(numPoses); }
+
+    // new poses are identity
+    void resize(int numPoses);
+    int size() const { return _size; }
+
+    // distance in floats between one component array and the next
+    int getStride() const { return _stride; }
+
+    float* data() { return _data.data(); }
+    const float* data() const { return _data.data(); }
+
+    float* component(Component c) { return _data.data() + c * _stride; }
+    const float* component(Component c) const { return _data.data() + c * _stride; }
+
+    AnimPose getPose(int i) const;
+    void setPose(int i, const AnimPose& pose);
+
+    // buffer[i] = poses[i], resizing to match.
+    void fromPoses(const AnimPoseVec& poses);
+    void toPoses(AnimPoseVec& poses) const;
+
+    // buffer[i] = poses[order[i]], resizing to match order.  toPoses writes them back to the same indices.
+    void fromPoses(const AnimPoseVec& poses, const std::vector<int>& order);
+    void toPoses(AnimPoseVec& poses, const std::vector<int>& order) const;
+
+protected:
+    std::vector<float> _data;
+    int _size { 0 };
+    int _stride { 0 };
+};
+
+// The joints of a skeleton sorted by depth, so that every joint in a level has its parent in an earlier level.
+// All the joints in one level can then be converted from relative to absolute together.
+class AnimPoseHierarchy {
+public:
+    AnimPoseHierarchy() {}
+    explicit AnimPoseHierarchy(const std::vector<int>& parentIndices);
+
+    // slot -> joint index, use this to load and store an AnimPoseBuffer in hierarchy order.
+    const std::vector<int>& getOrder() const { return _order; }
+
+    // slot -> slot of the parent joint, or -1 for roots.
+    const std::vector<int>& getParentSlots() const { return _parentSlots; }
+
+    // level n covers slots [levelOffsets[n], levelOffsets[n + 1])
+    const std::vector<int>& getLevelOffsets() const { return _levelOffsets; }
+    int getNumLevels() const { return _levelOffsets.empty() ? 0 : (int)_levelOffsets.size() - 1; }
+
+protected:
+    std::vector<int> _order;
+    std::vector<int> _parentSlots;
+    std::vector<int> _levelOffsets;
+};
+
+// result[i] = nlerp of a[i] and b[i], rotations take the shortest path, like ::blend in AnimUtil.h
+void blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseBuffer& result);
+
+// result[i] = a[i] * b[i].
+// Unlike AnimPose::operator* this composes scale, rotation and translation directly rather than through a matrix,
+// which gives the same result whenever a[i] has uniform scale, as skeleton joints do.
+void multiply(const AnimPoseBuffer& a, const AnimPoseBuffer& b, AnimPoseBuffer& result);
+
+// poses must be loaded in hierarchy order, see AnimPoseHierarchy::getOrder().
+// poses start off relative and leave in absolute frame.
+void convertRelativePosesToAbsolute(const AnimPoseHierarchy& hierarchy, AnimPoseBuffer& poses);
+
+#endif // hifi_AnimPoseBuffer_h
@@ -206,6 +206,7 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints,
     for (auto& joint : _joints) {
         _parentIndices.push_back(joint.parentIndex);
     }
+    _poseHierarchy = AnimPoseHierarchy(_parentIndices);
 
     _jointsSize = (int)joints.size();
     // build a cache of bind poses
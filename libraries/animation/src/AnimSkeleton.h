@@ -17,6 +17,7 @@
 
 #include <FBXSerializer.h>
 #include "AnimPose.h"
+#include "AnimPoseBuffer.h"
 
 class AnimSkeleton {
 public:
@@ -55,6 +56,12 @@ public:
     void convertRelativePosesToAbsolute(AnimPoseVec& poses) const;
     void convertAbsolutePosesToRelative(AnimPoseVec& poses) const;
 
+    // joints grouped by depth, for converting an AnimPoseBuffer a whole level at a time.
+    const AnimPoseHierarchy& getPoseHierarchy() const { return _poseHierarchy; }
+
+    // poses must be loaded in getPoseHierarchy().getOrder(), poses start off relative and leave in absolute frame.
+    void convertRelativePosesToAbsolute(AnimPoseBuffer& poses) const { ::convertRelativePosesToAbsolute(_poseHierarchy, poses); }
+
     void convertRelativeRotationsToAbsolute(std::vector<glm::quat>& rotations) const;
     void convertAbsoluteRotationsToRelative(std::vector<glm::quat>& rotations) const;
 
@@ -75,6 +82,7 @@ protected:
 
     std::vector<HFMJoint> _joints;
     std::vector<int> _parentIndices;
+    AnimPoseHierarchy _poseHierarchy;
     int _jointsSize { 0 };
     AnimPoseVec _relativeDefaultPoses;
     AnimPoseVec _absoluteDefaultPoses;
@@ -94,6 +94,12 @@ glm::quat averageQuats(size_t numQuats, const glm::quat* quats) {
 
 float accumulateTime(float startFrame, float endFrame, float timeScale, float currentFrame, float dt, bool loopFlag,
                      const QString& id, AnimVariantMap& triggersOut) {
+    return accumulateTime(startFrame, endFrame, timeScale, currentFrame, dt, loopFlag,
+                          AnimVariantKey(id + "OnLoop"), AnimVariantKey(id + "OnDone"), triggersOut);
+}
+
+float accumulateTime(float startFrame, float endFrame, float timeScale, float currentFrame, float dt, bool loopFlag,
+                     const AnimVariantKey& onLoopTrigger, const AnimVariantKey& onDoneTrigger, AnimVariantMap& triggersOut) {
 
     const float EPSILON = 0.0001f;
     float frame = currentFrame;
@@ -119,12 +125,12 @@ float accumulateTime(float startFrame, float endFrame, float timeScale, float cu
             if (framesRemaining >= framesTillEnd) {
                 if (loopFlag) {
                     // anim loop
-                    triggersOut.setTrigger(id + "OnLoop");
+                    triggersOut.setTrigger(onLoopTrigger);
                     framesRemaining -= framesTillEnd;
                     frame = clampedStartFrame;
                 } else {
                     // anim end
-                    triggersOut.setTrigger(id + "OnDone");
+                    triggersOut.setTrigger(onDoneTrigger);
                     frame = endFrame;
                     framesRemaining = 0.0f;
                 }
@@ -30,6 +30,10 @@ glm::quat averageQuats(size_t numQuats, const glm::quat* quats);
 float accumulateTime(float startFrame, float endFrame, float timeScale, float currentFrame, float dt, bool loopFlag,
                      const QString& id, AnimVariantMap& triggersOut);
 
+// same as above, with the "OnLoop" and "OnDone" triggers of the node already resolved, for use during evaluate.
+float accumulateTime(float startFrame, float endFrame, float timeScale, float currentFrame, float dt, bool loopFlag,
+                     const AnimVariantKey& onLoopTrigger, const AnimVariantKey& onDoneTrigger, AnimVariantMap& triggersOut);
+
 inline glm::quat safeLerp(const glm::quat& a, const glm::quat& b, float alpha) {
     // adjust signs if necessary
     glm::quat bTemp = b;
@@ -11,6 +11,11 @@
 
 #include "AnimVariant.h" // which has AnimVariant/AnimVariantMap
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <QHash>
 #include <QScriptEngine>
 #include <QScriptValueIterator>
 #include <QThread>
@@ -18,6 +23,84 @@
 
 const AnimVariant AnimVariant::False = AnimVariant();
 
+namespace {
+    // An immutable copy of the names interned so far.  Interning a new name publishes a new snapshot, which is rare
+    // once the anim graphs are loaded, so lookups read a snapshot without taking any lock.
+    struct NameSnapshot {
+        QHash<QString, AnimVariantID> ids;
+        std::vector<QString> names;
+    };
+    using NameSnapshotPointer = std::shared_ptr<const NameSnapshot>;
+
+    struct NameTable {
+        std::mutex mutex; // serializes interning, and guards snapshot
+        NameSnapshotPointer snapshot { std::make_shared<NameSnapshot>() };
+        std::atomic<uint32_t> generation { 0 }; // bumped each time a new snapshot is published
+    };
+
+    // function local so that keys constructed during static initialization still see a valid table
+    NameTable& getNameTable() {
+        static NameTable table;
+        return table;
+    }
+
+    // Each thread keeps a reference to the latest snapshot it has seen, and only takes the table mutex to pick up
+    // a newer one after a name was interned.  A snapshot is freed once no thread refers to it anymore.
+    const NameSnapshot& getSnapshot() {
+        static thread_local NameSnapshotPointer localSnapshot;
+        static thread_local uint32_t localGeneration { 0 };
+
+        NameTable& table = getNameTable();
+        if (!localSnapshot || localGeneration != table.generation.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(table.mutex);
+            localSnapshot = table.snapshot;
+            localGeneration = table.generation.load(std::memory_order_relaxed);
+        }
+        return *localSnapshot;
+    }
+}
+
+AnimVariantID AnimVariantNames::intern(const QString& name) {
+    AnimVariantID id = getSnapshot().ids.value(name, INVALID_ANIM_VARIANT_ID);
+    if (id != INVALID_ANIM_VARIANT_ID) {
+        return id;
+    }
+
+    NameTable& table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    // another thread may have interned it since our snapshot
+    auto iter = table.snapshot->ids.find(name);
+    if (iter != table.snapshot->ids.end()) {
+        return iter.value();
+    }
+    auto snapshot = std::make_shared<NameSnapshot>(*table.snapshot);
+    id = (AnimVariantID)snapshot->names.size();
+    snapshot->names.push_back(name);
+    snapshot->ids.insert(name, id);
+    table.snapshot = snapshot;
+    table.generation.fetch_add(1, std::memory_order_release);
+    return id;
+}
+
+AnimVariantID AnimVariantNames::find(const QString& name) {
+    return getSnapshot().ids.value(name, INVALID_ANIM_VARIANT_ID);
+}
+
+QString AnimVariantNames::getName(AnimVariantID id) {
+    const NameSnapshot& snapshot = getSnapshot();
+    if (id >= 0 && id < (AnimVariantID)snapshot.names.size()) {
+        return snapshot.names[id];
+    }
+    // an ID handed out by another thread that we haven't picked up a snapshot for yet
+    NameTable& table = getNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return (id >= 0 && id < (AnimVariantID)table.snapshot->names.size()) ? table.snapshot->names[id] : QString();
+}
+
+int AnimVariantNames::getNumNames() {
+    return (int)getSnapshot().names.size();
+}
+
 QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const {
     if (QThread::currentThread() != engine->thread()) {
         qCWarning(animation) << "Cannot create Javacript object from non-script thread" << QThread::currentThread();
@@ -52,25 +135,38 @@ QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine,
     };
     if (useNames) { // copy only the requested names
         for (const QString& name : names) {
-            auto search = _map.find(name);
-            if (search != _map.end()) {
-                setOne(name, search->second);
-            } else if (_triggers.count(name) == 1) {
+            AnimVariantID id = AnimVariantNames::find(name);
+            const AnimVariant* value = find(id, name);
+            if (value) {
+                setOne(name, *value);
+            } else if (_triggers.count(id) == 1) {
                 target.setProperty(name, true);
             } // scripts are allowed to request names that do not exist
         }
 
     } else {  // copy all of them
-        for (auto& pair : _map) {
-            setOne(pair.first, pair.second);
-        }
+        forEachValue(setOne);
     }
     return target;
 }
 
+void AnimVariantMap::clearMap() {
+    for (auto& entry : _slots) {
+        entry.isSet = false;
+    }
+    _uninternedValues.clear();
+    _triggers.clear();
+}
+
 void AnimVariantMap::copyVariantsFrom(const AnimVariantMap& other) {
-    for (auto& pair : other._map) {
-        _map[pair.first] = pair.second;
+    for (AnimVariantID id = 0; id < (AnimVariantID)other._slots.size(); id++) {
+        if (other._slots[id].isSet) {
+            // the name is only needed to drop a value this map had set before the name was interned
+            slot(id, _uninternedValues.empty() ? QString() : AnimVariantNames::getName(id)) = other._slots[id].value;
+        }
+    }
+    for (auto& entry : other._uninternedValues) {
+        slot(entry.first) = entry.second;
     }
 }
 
@@ -128,21 +224,21 @@ void AnimVariantMap::animVariantMapFromScriptValue(const QScriptValue& source) {
 
 std::map<QString, QString> AnimVariantMap::toDebugMap() const {
     std::map<QString, QString> result;
-    for (auto& pair : _map) {
-        switch (pair.second.getType()) {
+    forEachValue([&](const QString& name, const AnimVariant& variant) {
+        switch (variant.getType()) {
         case AnimVariant::Type::Bool:
-            result[pair.first] = QString("%1").arg(pair.second.getBool());
+            result[name] = QString("%1").arg(variant.getBool());
             break;
         case AnimVariant::Type::Int:
-            result[pair.first] = QString("%1").arg(pair.second.getInt());
+            result[name] = QString("%1").arg(variant.getInt());
             break;
         case AnimVariant::Type::Float:
-            result[pair.first] = QString::number(pair.second.getFloat(), 'f', 3);
+            result[name] = QString::number(variant.getFloat(), 'f', 3);
             break;
         case AnimVariant::Type::Vec3: {
             // To prevent filling up debug stats, don't show vec3 values
-            glm::vec3 value = pair.second.getVec3();
-            result[pair.first] = QString("(%1, %2, %3)").
+            glm::vec3 value = variant.getVec3();
+            result[name] = QString("(%1, %2, %3)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3));
@@ -150,8 +246,8 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::Quat: {
             // To prevent filling up the anim stats, don't show quat values
-            glm::quat value = pair.second.getQuat();
-            result[pair.first] = QString("(%1, %2, %3, %4)").
+            glm::quat value = variant.getQuat();
+            result[name] = QString("(%1, %2, %3, %4)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3)).
@@ -160,12 +256,12 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::String:
             // To prevent filling up anim stats, don't show string values
-            result[pair.first] = pair.second.getString();
+            result[name] = variant.getString();
             break;
         default:
             // invalid AnimVariant::Type
             assert(false);
         }
-    }
+    });
     return result;
 }
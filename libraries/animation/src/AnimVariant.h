@@ -11,12 +11,14 @@
 #ifndef hifi_AnimVariant_h
 #define hifi_AnimVariant_h
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <map>
 #include <set>
+#include <vector>
 #include <QScriptValue>
 #include <StreamUtils.h>
 #include <GLMHelpers.h>
@@ -114,118 +116,163 @@ protected:
     } _val;
 };
 
+// Anim variable names are interned into small integer IDs, shared by every AnimVariantMap in the process,
+// so that maps can keep their values in slots indexed by ID.  Only names that anim graphs and code hold keys for
+// are interned, so the IDs stay dense whatever names scripts set.
+using AnimVariantID = int;
+const AnimVariantID INVALID_ANIM_VARIANT_ID = -1;
+
+class AnimVariantNames {
+public:
+    // thread-safe.  returns the ID for name, adding it if this is the first time it has been seen.
+    static AnimVariantID intern(const QString& name);
+
+    // thread-safe, and lock-free unless a name was interned since this thread last looked.
+    // returns INVALID_ANIM_VARIANT_ID if name has never been interned.
+    static AnimVariantID find(const QString& name);
+
+    // thread-safe, and lock-free unless a name was interned since this thread last looked.
+    static QString getName(AnimVariantID id);
+
+    // thread-safe and lock-free, but may not count the names other threads interned since this thread last looked.
+    static int getNumNames();
+};
+
+// A variable name that was resolved to its ID when it was set, typically when the anim graph was loaded.
+// Anim nodes hold their variable names as keys so that their lookups during evaluate are indexed reads.
+class AnimVariantKey {
+public:
+    AnimVariantKey() {}
+    AnimVariantKey(const QString& name) : _name(name), _id(AnimVariantNames::intern(name)) {}
+
+    const QString& getName() const { return _name; }
+    AnimVariantID getID() const { return _id; }
+    bool isEmpty() const { return _name.isEmpty(); }
+
+    operator const QString&() const { return _name; }
+
+protected:
+    QString _name;
+    AnimVariantID _id { INVALID_ANIM_VARIANT_ID };
+};
+
 class AnimVariantMap {
 public:
 
     bool lookup(const QString& key, bool defaultValue) const {
-        // check triggers first, then map
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else if (_triggers.find(key) != _triggers.end()) {
-            return true;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getBool() : defaultValue;
-        }
+        return key.isEmpty() ? defaultValue : lookupBool(AnimVariantNames::find(key), key, defaultValue);
+    }
+    bool lookup(const AnimVariantKey& key, bool defaultValue) const {
+        return key.isEmpty() ? defaultValue : lookupBool(key.getID(), key.getName(), defaultValue);
     }
 
     int lookup(const QString& key, int defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getInt() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? value->getInt() : defaultValue;
+    }
+    int lookup(const AnimVariantKey& key, int defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? value->getInt() : defaultValue;
     }
 
     float lookup(const QString& key, float defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getFloat() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? value->getFloat() : defaultValue;
+    }
+    float lookup(const AnimVariantKey& key, float defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? value->getFloat() : defaultValue;
     }
 
     const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getVec3() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? value->getVec3() : defaultValue;
+    }
+    const glm::vec3& lookupRaw(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? value->getVec3() : defaultValue;
     }
 
     glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformPoint(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? transformPoint(_rigToGeometryMat, value->getVec3()) : defaultValue;
+    }
+    glm::vec3 lookupRigToGeometry(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? transformPoint(_rigToGeometryMat, value->getVec3()) : defaultValue;
     }
 
     glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformVectorFast(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? transformVectorFast(_rigToGeometryMat, value->getVec3()) : defaultValue;
+    }
+    glm::vec3 lookupRigToGeometryVector(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? transformVectorFast(_rigToGeometryMat, value->getVec3()) : defaultValue;
     }
 
     const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getQuat() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? value->getQuat() : defaultValue;
+    }
+    const glm::quat& lookupRaw(const AnimVariantKey& key, const glm::quat& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? value->getQuat() : defaultValue;
     }
 
     glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? _rigToGeometryRot * iter->second.getQuat() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? _rigToGeometryRot * value->getQuat() : defaultValue;
+    }
+    glm::quat lookupRigToGeometry(const AnimVariantKey& key, const glm::quat& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? _rigToGeometryRot * value->getQuat() : defaultValue;
     }
 
     const QString& lookup(const QString& key, const QString& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getString() : defaultValue;
-        }
+        const AnimVariant* value = find(key);
+        return value ? value->getString() : defaultValue;
+    }
+    const QString& lookup(const AnimVariantKey& key, const QString& defaultValue) const {
+        const AnimVariant* value = find(key);
+        return value ? value->getString() : defaultValue;
     }
 
-    void set(const QString& key, bool value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, int value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, float value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::vec3& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::quat& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const QString& value) { _map[key] = AnimVariant(value); }
-    void unset(const QString& key) { _map.erase(key); }
+    void set(const QString& key, bool value) { slot(key) = AnimVariant(value); }
+    void set(const QString& key, int value) { slot(key) = AnimVariant(value); }
+    void set(const QString& key, float value) { slot(key) = AnimVariant(value); }
+    void set(const QString& key, const glm::vec3& value) { slot(key) = AnimVariant(value); }
+    void set(const QString& key, const glm::quat& value) { slot(key) = AnimVariant(value); }
+    void set(const QString& key, const QString& value) { slot(key) = AnimVariant(value); }
+    void unset(const QString& key) { unset(AnimVariantNames::find(key), key); }
 
-    void setTrigger(const QString& key) { _map[key] = AnimVariant(true); }
+    void set(const AnimVariantKey& key, bool value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void set(const AnimVariantKey& key, int value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void set(const AnimVariantKey& key, float value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void set(const AnimVariantKey& key, const glm::vec3& value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void set(const AnimVariantKey& key, const glm::quat& value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void set(const AnimVariantKey& key, const QString& value) { slot(key.getID(), key.getName()) = AnimVariant(value); }
+    void unset(const AnimVariantKey& key) { unset(key.getID(), key.getName()); }
+
+    void setTrigger(const QString& key) { slot(key) = AnimVariant(true); }
+    void setTrigger(const AnimVariantKey& key) { slot(key.getID(), key.getName()) = AnimVariant(true); }
 
     void setRigToGeometryTransform(const glm::mat4& rigToGeometry) {
         _rigToGeometryMat = rigToGeometry;
         _rigToGeometryRot = glmExtractRotation(rigToGeometry);
     }
 
-    void clearMap() { _map.clear(); _triggers.clear(); }
-    bool hasKey(const QString& key) const { return _map.find(key) != _map.end(); }
+    void clearMap();
+    bool hasKey(const QString& key) const { return find(key) != nullptr; }
+    bool hasKey(const AnimVariantKey& key) const { return find(key) != nullptr; }
 
     const AnimVariant& get(const QString& key) const {
-        auto iter = _map.find(key);
-        if (iter != _map.end()) {
-            return iter->second;
-        } else {
-            return AnimVariant::False;
-        }
+        const AnimVariant* value = find(key);
+        return value ? *value : AnimVariant::False;
+    }
+    const AnimVariant& get(const AnimVariantKey& key) const {
+        const AnimVariant* value = find(key);
+        return value ? *value : AnimVariant::False;
     }
 
     // Answer a Plain Old Javascript Object (for the given engine) all of our values set as properties.
@@ -240,36 +287,111 @@ public:
 #ifndef NDEBUG
     void dump() const {
         qCDebug(animation) << "AnimVariantMap =";
-        for (auto& pair : _map) {
-            switch (pair.second.getType()) {
+        forEachValue([](const QString& name, const AnimVariant& value) {
+            switch (value.getType()) {
             case AnimVariant::Type::Bool:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getBool();
+                qCDebug(animation) << "    " << name << "=" << value.getBool();
                 break;
             case AnimVariant::Type::Int:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getInt();
+                qCDebug(animation) << "    " << name << "=" << value.getInt();
                 break;
             case AnimVariant::Type::Float:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getFloat();
+                qCDebug(animation) << "    " << name << "=" << value.getFloat();
                 break;
             case AnimVariant::Type::Vec3:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getVec3();
+                qCDebug(animation) << "    " << name << "=" << value.getVec3();
                 break;
             case AnimVariant::Type::Quat:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getQuat();
+                qCDebug(animation) << "    " << name << "=" << value.getQuat();
                 break;
             case AnimVariant::Type::String:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getString();
+                qCDebug(animation) << "    " << name << "=" << value.getString();
                 break;
             default:
                 assert(false);
             }
-        }
+        });
     }
 #endif
 
 protected:
-    std::map<QString, AnimVariant> _map;
-    std::set<QString> _triggers;
+    struct Slot {
+        AnimVariant value;
+        bool isSet { false };
+    };
+
+    const AnimVariant* find(AnimVariantID id, const QString& name) const {
+        if (id >= 0 && id < (AnimVariantID)_slots.size() && _slots[id].isSet) {
+            return &_slots[id].value;
+        }
+        if (_uninternedValues.empty()) {
+            return nullptr;
+        }
+        // set by name before anything interned it
+        auto iter = _uninternedValues.find(name);
+        return iter != _uninternedValues.end() ? &iter->second : nullptr;
+    }
+    const AnimVariant* find(const QString& name) const {
+        return name.isEmpty() ? nullptr : find(AnimVariantNames::find(name), name);
+    }
+    const AnimVariant* find(const AnimVariantKey& key) const { return find(key.getID(), key.getName()); }
+
+    AnimVariant& slot(AnimVariantID id, const QString& name) {
+        assert(id >= 0);
+        if (id >= (AnimVariantID)_slots.size()) {
+            // room for every name interned so far, so that this only happens again when a graph adds names
+            _slots.resize(std::max(id + 1, AnimVariantNames::getNumNames()));
+        }
+        Slot& entry = _slots[id];
+        if (!entry.isSet) {
+            entry.isSet = true;
+            if (!_uninternedValues.empty()) {
+                _uninternedValues.erase(name);
+            }
+        }
+        return entry.value;
+    }
+    AnimVariant& slot(const QString& name) {
+        // names nothing has interned, such as the ones only scripts set, don't take up an ID, and stay out of the slots
+        AnimVariantID id = AnimVariantNames::find(name);
+        return id != INVALID_ANIM_VARIANT_ID ? slot(id, name) : _uninternedValues[name];
+    }
+
+    // leaves the slot in place, so that setting it again, as Rig does every frame, doesn't move anything
+    void unset(AnimVariantID id, const QString& name) {
+        if (id >= 0 && id < (AnimVariantID)_slots.size()) {
+            _slots[id].isSet = false;
+        }
+        if (!_uninternedValues.empty()) {
+            _uninternedValues.erase(name);
+        }
+    }
+
+    bool lookupBool(AnimVariantID id, const QString& name, bool defaultValue) const {
+        // check triggers first, then map
+        if (id >= 0 && _triggers.find(id) != _triggers.end()) {
+            return true;
+        }
+        const AnimVariant* value = find(id, name);
+        return value ? value->getBool() : defaultValue;
+    }
+
+    template <typename F>
+    void forEachValue(F f) const {
+        for (AnimVariantID id = 0; id < (AnimVariantID)_slots.size(); id++) {
+            if (_slots[id].isSet) {
+                f(AnimVariantNames::getName(id), _slots[id].value);
+            }
+        }
+        for (auto& entry : _uninternedValues) {
+            f(entry.first, entry.second);
+        }
+    }
+
+    // indexed by ID, so that lookups by key are a single indexed read
+    std::vector<Slot> _slots;
+    std::map<QString, AnimVariant> _uninternedValues;
+    std::set<AnimVariantID> _triggers;
     glm::mat4 _rigToGeometryMat;
     glm::quat _rigToGeometryRot;
 };
@@ -21,7 +21,9 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 #include <PerfStat.h>
+#include <Profile.h>
 #include <ScriptValueUtils.h>
+#include <TBBHelpers.h>
 #include <shared/NsightHelpers.h>
 
 #include "AnimationLogging.h"
@@ -1063,6 +1065,53 @@ bool Rig::getRelativeDefaultJointTranslation(int index, glm::vec3& translationOu
     }
 }
 
+// the vars set by computeMotionAnimationState every frame, resolved once rather than on each set
+static const AnimVariantKey SINE("sine");
+static const AnimVariantKey MOVE_FORWARD_SPEED("moveForwardSpeed");
+static const AnimVariantKey MOVE_BACKWARD_SPEED("moveBackwardSpeed");
+static const AnimVariantKey MOVE_LATERAL_SPEED("moveLateralSpeed");
+static const AnimVariantKey IS_MOVING_FORWARD("isMovingForward");
+static const AnimVariantKey IS_MOVING_BACKWARD("isMovingBackward");
+static const AnimVariantKey IS_MOVING_RIGHT("isMovingRight");
+static const AnimVariantKey IS_MOVING_LEFT("isMovingLeft");
+static const AnimVariantKey IS_MOVING_RIGHT_HMD("isMovingRightHmd");
+static const AnimVariantKey IS_MOVING_LEFT_HMD("isMovingLeftHmd");
+static const AnimVariantKey IS_NOT_MOVING("isNotMoving");
+static const AnimVariantKey IS_TURNING_RIGHT("isTurningRight");
+static const AnimVariantKey IS_TURNING_LEFT("isTurningLeft");
+static const AnimVariantKey IS_NOT_TURNING("isNotTurning");
+static const AnimVariantKey IS_FLYING("isFlying");
+static const AnimVariantKey IS_NOT_FLYING("isNotFlying");
+static const AnimVariantKey IS_TAKEOFF_STAND("isTakeoffStand");
+static const AnimVariantKey IS_TAKEOFF_RUN("isTakeoffRun");
+static const AnimVariantKey IS_NOT_TAKEOFF("isNotTakeoff");
+static const AnimVariantKey IS_IN_AIR_STAND("isInAirStand");
+static const AnimVariantKey IS_IN_AIR_RUN("isInAirRun");
+static const AnimVariantKey IS_NOT_IN_AIR("isNotInAir");
+static const AnimVariantKey IS_SEATED("isSeated");
+static const AnimVariantKey IS_NOT_SEATED("isNotSeated");
+static const AnimVariantKey IS_SEATED_TURNING_RIGHT("isSeatedTurningRight");
+static const AnimVariantKey IS_SEATED_TURNING_LEFT("isSeatedTurningLeft");
+static const AnimVariantKey IS_SEATED_NOT_TURNING("isSeatedNotTurning");
+static const AnimVariantKey IN_AIR_ALPHA("inAirAlpha");
+static const AnimVariantKey IK_OVERLAY_ALPHA("ikOverlayAlpha");
+static const AnimVariantKey SPLINE_IK_ENABLED("splineIKEnabled");
+static const AnimVariantKey LEFT_HAND_IK_ENABLED("leftHandIKEnabled");
+static const AnimVariantKey RIGHT_HAND_IK_ENABLED("rightHandIKEnabled");
+static const AnimVariantKey LEFT_FOOT_IK_ENABLED("leftFootIKEnabled");
+static const AnimVariantKey RIGHT_FOOT_IK_ENABLED("rightFootIKEnabled");
+static const AnimVariantKey LEFT_HAND_POLE_VECTOR_ENABLED("leftHandPoleVectorEnabled");
+static const AnimVariantKey RIGHT_HAND_POLE_VECTOR_ENABLED("rightHandPoleVectorEnabled");
+static const AnimVariantKey LEFT_FOOT_POLE_VECTOR_ENABLED("leftFootPoleVectorEnabled");
+static const AnimVariantKey RIGHT_FOOT_POLE_VECTOR_ENABLED("rightFootPoleVectorEnabled");
+static const AnimVariantKey IS_INPUT_FORWARD("isInputForward");
+static const AnimVariantKey IS_INPUT_BACKWARD("isInputBackward");
+static const AnimVariantKey IS_INPUT_RIGHT("isInputRight");
+static const AnimVariantKey IS_INPUT_LEFT("isInputLeft");
+static const AnimVariantKey IS_NOT_INPUT("isNotInput");
+static const AnimVariantKey IS_NOT_INPUT_SLOW("isNotInputSlow");
+static const AnimVariantKey IS_NOT_INPUT_NO_MOMENTUM("isNotInputNoMomentum");
+
 void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPosition, const glm::vec3& worldVelocity,
                                       const glm::quat& worldRotation, CharacterControllerState ccState, float sensorToWorldScale) {
 
@@ -1083,10 +1132,10 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
         // sine wave LFO var for testing.
         static float t = 0.0f;
-        _animVars.set("sine", 2.0f * 0.5f * sinf(t) + 0.5f);
-        _animVars.set("moveForwardSpeed", _averageForwardSpeed.getAverage());
-        _animVars.set("moveBackwardSpeed", -_averageForwardSpeed.getAverage());
-        _animVars.set("moveLateralSpeed", fabsf(_averageLateralSpeed.getAverage()));
+        _animVars.set(SINE, 2.0f * 0.5f * sinf(t) + 0.5f);
+        _animVars.set(MOVE_FORWARD_SPEED, _averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_BACKWARD_SPEED, -_averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_LATERAL_SPEED, fabsf(_averageLateralSpeed.getAverage()));
 
         const float MOVE_ENTER_SPEED_THRESHOLD = 0.2f; // m/sec
         const float MOVE_EXIT_SPEED_THRESHOLD = 0.07f;  // m/sec
@@ -1184,228 +1233,228 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 if (fabsf(forwardSpeed) > 0.5f * fabsf(lateralSpeed)) {
                     if (forwardSpeed > 0.0f) {
                         // forward
-                        _animVars.set("isMovingForward", true);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, true);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_MOVING_RIGHT, false);
+                        _animVars.set(IS_MOVING_LEFT, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
 
                     } else {
                         // backward
-                        _animVars.set("isMovingBackward", true);
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_BACKWARD, true);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_RIGHT, false);
+                        _animVars.set(IS_MOVING_LEFT, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     }
                 } else {
                     if (lateralSpeed > 0.0f) {
                         // right
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", true);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, true);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", true);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, true);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     } else {
                         // left
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", true);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, true);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", true);
+                            _animVars.set(IS_MOVING_RIGHT, false);
+                            _animVars.set(IS_MOVING_LEFT, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD, true);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD, false);
+                        _animVars.set(IS_MOVING_BACKWARD, false);
+                        _animVars.set(IS_NOT_MOVING, false);
                     }
                 }
             }
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Turn) {
             if (turningSpeed > 0.0f) {
                 // turning right
-                _animVars.set("isTurningRight", true);
-                _animVars.set("isTurningLeft", false);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT, true);
+                _animVars.set(IS_TURNING_LEFT, false);
+                _animVars.set(IS_NOT_TURNING, false);
             } else {
                 // turning left
-                _animVars.set("isTurningRight", false);
-                _animVars.set("isTurningLeft", true);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT, false);
+                _animVars.set(IS_TURNING_LEFT, true);
+                _animVars.set(IS_NOT_TURNING, false);
             }
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Idle) {
             // default anim vars to notMoving and notTurning
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Hover) {
             // flying.
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", true);
-            _animVars.set("isNotFlying", false);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, true);
+            _animVars.set(IS_NOT_FLYING, false);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::Takeoff) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
 
             bool takeOffRun = forwardSpeed > 0.1f;
             if (takeOffRun) {
-                _animVars.set("isTakeoffStand", false);
-                _animVars.set("isTakeoffRun", true);
+                _animVars.set(IS_TAKEOFF_STAND, false);
+                _animVars.set(IS_TAKEOFF_RUN, true);
             } else {
-                _animVars.set("isTakeoffStand", true);
-                _animVars.set("isTakeoffRun", false);
+                _animVars.set(IS_TAKEOFF_STAND, true);
+                _animVars.set(IS_TAKEOFF_RUN, false);
             }
 
-            _animVars.set("isNotTakeoff", false);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", false);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_NOT_TAKEOFF, false);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, false);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
         } else if (_state == RigRole::InAir) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, true);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_SEATED, false);
+            _animVars.set(IS_NOT_SEATED, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT, false);
+            _animVars.set(IS_SEATED_NOT_TURNING, false);
 
             bool inAirRun = forwardSpeed > 0.1f;
             if (inAirRun) {
-                _animVars.set("isInAirStand", false);
-                _animVars.set("isInAirRun", true);
+                _animVars.set(IS_IN_AIR_STAND, false);
+                _animVars.set(IS_IN_AIR_RUN, true);
             } else {
-                _animVars.set("isInAirStand", true);
-                _animVars.set("isInAirRun", false);
+                _animVars.set(IS_IN_AIR_STAND, true);
+                _animVars.set(IS_IN_AIR_RUN, false);
             }
-            _animVars.set("isNotInAir", false);
+            _animVars.set(IS_NOT_IN_AIR, false);
 
             // We want to preserve the apparent jump height in sensor space.
             const float jumpHeight = std::max(sensorToWorldScale * DEFAULT_AVATAR_JUMP_HEIGHT, DEFAULT_AVATAR_MIN_JUMP_HEIGHT);
@@ -1416,62 +1465,62 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             // compute inAirAlpha blend based on velocity
             float alpha = glm::clamp((-workingVelocity.y * sensorToWorldScale) / jumpSpeed, -1.0f, 1.0f) + 1.0f;
 
-            _animVars.set("inAirAlpha", alpha);
+            _animVars.set(IN_AIR_ALPHA, alpha);
         } else if (_state == RigRole::Seated) {
             if (fabsf(_previousControllerParameters.inputX) <= INPUT_DEADZONE_THRESHOLD) {
                 // seated not turning
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", true);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT, false);
+                _animVars.set(IS_SEATED_NOT_TURNING, true);
             } else if (_previousControllerParameters.inputX > 0.0f) {
                 // seated turning right
-                _animVars.set("isSeatedTurningRight", true);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, true);
+                _animVars.set(IS_SEATED_TURNING_LEFT, false);
+                _animVars.set(IS_SEATED_NOT_TURNING, false);
             } else {
                 // seated turning left
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", true);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT, true);
+                _animVars.set(IS_SEATED_NOT_TURNING, false);
             }
 
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", false);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", true);
-            _animVars.set("isNotSeated", false);
+            _animVars.set(IS_MOVING_FORWARD, false);
+            _animVars.set(IS_MOVING_BACKWARD, false);
+            _animVars.set(IS_MOVING_RIGHT, false);
+            _animVars.set(IS_MOVING_LEFT, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD, false);
+            _animVars.set(IS_MOVING_LEFT_HMD, false);
+            _animVars.set(IS_NOT_MOVING, false);
+            _animVars.set(IS_TURNING_RIGHT, false);
+            _animVars.set(IS_TURNING_LEFT, false);
+            _animVars.set(IS_NOT_TURNING, true);
+            _animVars.set(IS_FLYING, false);
+            _animVars.set(IS_NOT_FLYING, true);
+            _animVars.set(IS_TAKEOFF_STAND, false);
+            _animVars.set(IS_TAKEOFF_RUN, false);
+            _animVars.set(IS_NOT_TAKEOFF, true);
+            _animVars.set(IS_IN_AIR_STAND, false);
+            _animVars.set(IS_IN_AIR_RUN, false);
+            _animVars.set(IS_NOT_IN_AIR, true);
+            _animVars.set(IS_SEATED, true);
+            _animVars.set(IS_NOT_SEATED, false);
         }
 
         t += deltaTime;
 
         if (_enableInverseKinematics) {
-            _animVars.set("ikOverlayAlpha", 1.0f);
+            _animVars.set(IK_OVERLAY_ALPHA, 1.0f);
         } else {
-            _animVars.set("ikOverlayAlpha", 0.0f);
-            _animVars.set("splineIKEnabled", false);
-            _animVars.set("leftHandIKEnabled", false);
-            _animVars.set("rightHandIKEnabled", false);
-            _animVars.set("leftFootIKEnabled", false);
-            _animVars.set("rightFootIKEnabled", false);
-            _animVars.set("leftHandPoleVectorEnabled", false);
-            _animVars.set("rightHandPoleVectorEnabled", false);
-            _animVars.set("leftFootPoleVectorEnabled", false);
-            _animVars.set("rightFootPoleVectorEnabled", false);
+            _animVars.set(IK_OVERLAY_ALPHA, 0.0f);
+            _animVars.set(SPLINE_IK_ENABLED, false);
+            _animVars.set(LEFT_HAND_IK_ENABLED, false);
+            _animVars.set(RIGHT_HAND_IK_ENABLED, false);
+            _animVars.set(LEFT_FOOT_IK_ENABLED, false);
+            _animVars.set(RIGHT_FOOT_IK_ENABLED, false);
+            _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED, false);
+            _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED, false);
+            _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED, false);
+            _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED, false);
         }
         _lastEnableInverseKinematics = _enableInverseKinematics;
 
@@ -1490,31 +1539,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 }
 
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
 
                 // directly reflects input
-                _animVars.set("isNotInput", true);  
+                _animVars.set(IS_NOT_INPUT, true);  
 
                 // no input + speed drops to SLOW_SPEED_THRESHOLD
                 // (don't transition run->idle - slow to walk first)
-                _animVars.set("isNotInputSlow", _isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_SLOW, _isMovingWithMomentum);
 
                 // no input + speed didn't get above HAS_MOMENTUM_THRESHOLD since last idle
                 // (brief inputs and movement adjustments)
-                _animVars.set("isNotInputNoMomentum", !_isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, !_isMovingWithMomentum);
 
 
             } else {
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", true);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, true);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         } else if (fabsf(_previousControllerParameters.inputZ) >= fabsf(_previousControllerParameters.inputX)) {
             if (fabsf(forwardSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1523,22 +1572,22 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
             if (_previousControllerParameters.inputZ > 0.0f) {
                 // forward
-                _animVars.set("isInputForward", true);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, true);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             } else {
                 // backward
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", true);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, true);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         } else {
             if (fabsf(lateralSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1548,31 +1597,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             if (_previousControllerParameters.inputX > 0.0f) {
                 // right
                 if (!_headEnabled) {
-                    _animVars.set("isInputRight", true);
+                    _animVars.set(IS_INPUT_RIGHT, true);
                 } else {
-                    _animVars.set("isInputRight", false);
+                    _animVars.set(IS_INPUT_RIGHT, false);
                 }
 
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_LEFT, false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             } else {
                 // left
                 if (!_headEnabled) {
-                    _animVars.set("isInputLeft", true);
+                    _animVars.set(IS_INPUT_LEFT, true);
                 } else {
-                    _animVars.set("isInputLeft", false);
+                    _animVars.set(IS_INPUT_LEFT, false);
                 }
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD, false);
+                _animVars.set(IS_INPUT_BACKWARD, false);
+                _animVars.set(IS_INPUT_RIGHT, false);
+                _animVars.set(IS_NOT_INPUT, false);
+                _animVars.set(IS_NOT_INPUT_SLOW, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM, false);
             }
         }
 
@@ -1752,6 +1801,25 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
     }
 }
 
+void Rig::updateAnimationsBatch(const std::vector<AnimationUpdate>& updates) {
+    PROFILE_RANGE(simulation_animation, __FUNCTION__);
+
+    if (updates.size() == 1) {
+        const AnimationUpdate& update = updates.front();
+        update.rig->updateAnimations(update.deltaTime, update.rootTransform, update.rigToWorldTransform);
+        return;
+    }
+
+    // rigs share no mutable state while evaluating, so each one is its own job.
+    // parallel_for doesn't return until every job is done, which is the join point for our callers.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, updates.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            const AnimationUpdate& update = updates[i];
+            update.rig->updateAnimations(update.deltaTime, update.rootTransform, update.rigToWorldTransform);
+        }
+    });
+}
+
 void Rig::updateFromEyeParameters(const EyeParameters& params) {
     updateEyeJoint(params.leftEyeJointIndex, params.modelTranslation, params.modelRotation, params.eyeLookAt, params.eyeSaccade);
     updateEyeJoint(params.rightEyeJointIndex, params.modelTranslation, params.modelRotation, params.eyeLookAt, params.eyeSaccade);
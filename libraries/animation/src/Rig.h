@@ -197,6 +197,18 @@ public:
     // Regardless of who started the animations or how many, update the joints.
     void updateAnimations(float deltaTime, const glm::mat4& rootTransform, const glm::mat4& rigToWorldTransform);
 
+    struct AnimationUpdate {
+        Rig* rig;
+        float deltaTime;
+        glm::mat4 rootTransform;
+        glm::mat4 rigToWorldTransform;
+    };
+
+    // Update the joints of many rigs.  Each rig is evaluated as an independent job on the worker pool.
+    // Returns once every rig has its new poses, so the caller can hand them to rendering and physics right away.
+    // thread-safe as long as each rig appears only once and no other thread is updating those rigs.
+    static void updateAnimationsBatch(const std::vector<AnimationUpdate>& updates);
+
     void updateFromControllerParameters(const ControllerParameters& params, float dt);
     void updateFromEyeParameters(const EyeParameters& params);
 
@@ -0,0 +1,218 @@
+//
+//  AnimPoseBuffer_avx2.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "../AnimPoseBuffer.h"
+
+// eight poses, one register per component
+struct Poses8 {
+    __m256 sx, sy, sz;
+    __m256 rx, ry, rz, rw;
+    __m256 tx, ty, tz;
+};
+
+static inline Poses8 loadPoses8(const float* p, int stride) {
+    Poses8 r;
+    r.sx = _mm256_loadu_ps(p + AnimPoseBuffer::ScaleX * stride);
+    r.sy = _mm256_loadu_ps(p + AnimPoseBuffer::ScaleY * stride);
+    r.sz = _mm256_loadu_ps(p + AnimPoseBuffer::ScaleZ * stride);
+    r.rx = _mm256_loadu_ps(p + AnimPoseBuffer::RotX * stride);
+    r.ry = _mm256_loadu_ps(p + AnimPoseBuffer::RotY * stride);
+    r.rz = _mm256_loadu_ps(p + AnimPoseBuffer::RotZ * stride);
+    r.rw = _mm256_loadu_ps(p + AnimPoseBuffer::RotW * stride);
+    r.tx = _mm256_loadu_ps(p + AnimPoseBuffer::TransX * stride);
+    r.ty = _mm256_loadu_ps(p + AnimPoseBuffer::TransY * stride);
+    r.tz = _mm256_loadu_ps(p + AnimPoseBuffer::TransZ * stride);
+    return r;
+}
+
+static inline void storePoses8(float* p, int stride, const Poses8& r) {
+    _mm256_storeu_ps(p + AnimPoseBuffer::ScaleX * stride, r.sx);
+    _mm256_storeu_ps(p + AnimPoseBuffer::ScaleY * stride, r.sy);
+    _mm256_storeu_ps(p + AnimPoseBuffer::ScaleZ * stride, r.sz);
+    _mm256_storeu_ps(p + AnimPoseBuffer::RotX * stride, r.rx);
+    _mm256_storeu_ps(p + AnimPoseBuffer::RotY * stride, r.ry);
+    _mm256_storeu_ps(p + AnimPoseBuffer::RotZ * stride, r.rz);
+    _mm256_storeu_ps(p + AnimPoseBuffer::RotW * stride, r.rw);
+    _mm256_storeu_ps(p + AnimPoseBuffer::TransX * stride, r.tx);
+    _mm256_storeu_ps(p + AnimPoseBuffer::TransY * stride, r.ty);
+    _mm256_storeu_ps(p + AnimPoseBuffer::TransZ * stride, r.tz);
+}
+
+static inline Poses8 maskLoadPoses8(const float* p, int stride, __m256i mask) {
+    Poses8 r;
+    r.sx = _mm256_maskload_ps(p + AnimPoseBuffer::ScaleX * stride, mask);
+    r.sy = _mm256_maskload_ps(p + AnimPoseBuffer::ScaleY * stride, mask);
+    r.sz = _mm256_maskload_ps(p + AnimPoseBuffer::ScaleZ * stride, mask);
+    r.rx = _mm256_maskload_ps(p + AnimPoseBuffer::RotX * stride, mask);
+    r.ry = _mm256_maskload_ps(p + AnimPoseBuffer::RotY * stride, mask);
+    r.rz = _mm256_maskload_ps(p + AnimPoseBuffer::RotZ * stride, mask);
+    r.rw = _mm256_maskload_ps(p + AnimPoseBuffer::RotW * stride, mask);
+    r.tx = _mm256_maskload_ps(p + AnimPoseBuffer::TransX * stride, mask);
+    r.ty = _mm256_maskload_ps(p + AnimPoseBuffer::TransY * stride, mask);
+    r.tz = _mm256_maskload_ps(p + AnimPoseBuffer::TransZ * stride, mask);
+    return r;
+}
+
+static inline void maskStorePoses8(float* p, int stride, __m256i mask, const Poses8& r) {
+    _mm256_maskstore_ps(p + AnimPoseBuffer::ScaleX * stride, mask, r.sx);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::ScaleY * stride, mask, r.sy);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::ScaleZ * stride, mask, r.sz);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::RotX * stride, mask, r.rx);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::RotY * stride, mask, r.ry);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::RotZ * stride, mask, r.rz);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::RotW * stride, mask, r.rw);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::TransX * stride, mask, r.tx);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::TransY * stride, mask, r.ty);
+    _mm256_maskstore_ps(p + AnimPoseBuffer::TransZ * stride, mask, r.tz);
+}
+
+// gather the poses at indices[0..7], masked off lanes are zero
+static inline Poses8 gatherPoses8(const float* p, int stride, __m256i indices, __m256i mask) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 maskps = _mm256_castsi256_ps(mask);
+    Poses8 r;
+    r.sx = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::ScaleX * stride, indices, maskps, 4);
+    r.sy = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::ScaleY * stride, indices, maskps, 4);
+    r.sz = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::ScaleZ * stride, indices, maskps, 4);
+    r.rx = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::RotX * stride, indices, maskps, 4);
+    r.ry = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::RotY * stride, indices, maskps, 4);
+    r.rz = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::RotZ * stride, indices, maskps, 4);
+    r.rw = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::RotW * stride, indices, maskps, 4);
+    r.tx = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::TransX * stride, indices, maskps, 4);
+    r.ty = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::TransY * stride, indices, maskps, 4);
+    r.tz = _mm256_mask_i32gather_ps(zero, p + AnimPoseBuffer::TransZ * stride, indices, maskps, 4);
+    return r;
+}
+
+// same math as composePose() in AnimPoseBuffer.cpp
+static inline Poses8 composePoses8(const Poses8& p, const Poses8& c) {
+    Poses8 r;
+    r.sx = _mm256_mul_ps(p.sx, c.sx);
+    r.sy = _mm256_mul_ps(p.sy, c.sy);
+    r.sz = _mm256_mul_ps(p.sz, c.sz);
+
+    r.rx = _mm256_fmsub_ps(p.ry, c.rz, _mm256_mul_ps(p.rz, c.ry));
+    r.rx = _mm256_fmadd_ps(p.rx, c.rw, r.rx);
+    r.rx = _mm256_fmadd_ps(p.rw, c.rx, r.rx);
+
+    r.ry = _mm256_fmsub_ps(p.rz, c.rx, _mm256_mul_ps(p.rx, c.rz));
+    r.ry = _mm256_fmadd_ps(p.ry, c.rw, r.ry);
+    r.ry = _mm256_fmadd_ps(p.rw, c.ry, r.ry);
+
+    r.rz = _mm256_fmsub_ps(p.rx, c.ry, _mm256_mul_ps(p.ry, c.rx));
+    r.rz = _mm256_fmadd_ps(p.rz, c.rw, r.rz);
+    r.rz = _mm256_fmadd_ps(p.rw, c.rz, r.rz);
+
+    r.rw = _mm256_fnmadd_ps(p.rx, c.rx, _mm256_mul_ps(p.rw, c.rw));
+    r.rw = _mm256_fnmadd_ps(p.ry, c.ry, r.rw);
+    r.rw = _mm256_fnmadd_ps(p.rz, c.rz, r.rw);
+
+    // rotate the scaled child translation by the parent rotation
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 vx = _mm256_mul_ps(p.sx, c.tx);
+    __m256 vy = _mm256_mul_ps(p.sy, c.ty);
+    __m256 vz = _mm256_mul_ps(p.sz, c.tz);
+    __m256 tx = _mm256_mul_ps(two, _mm256_fmsub_ps(p.ry, vz, _mm256_mul_ps(p.rz, vy)));
+    __m256 ty = _mm256_mul_ps(two, _mm256_fmsub_ps(p.rz, vx, _mm256_mul_ps(p.rx, vz)));
+    __m256 tz = _mm256_mul_ps(two, _mm256_fmsub_ps(p.rx, vy, _mm256_mul_ps(p.ry, vx)));
+
+    r.tx = _mm256_add_ps(_mm256_add_ps(p.tx, vx), _mm256_fmadd_ps(p.rw, tx, _mm256_fmsub_ps(p.ry, tz, _mm256_mul_ps(p.rz, ty))));
+    r.ty = _mm256_add_ps(_mm256_add_ps(p.ty, vy), _mm256_fmadd_ps(p.rw, ty, _mm256_fmsub_ps(p.rz, tx, _mm256_mul_ps(p.rx, tz))));
+    r.tz = _mm256_add_ps(_mm256_add_ps(p.tz, vz), _mm256_fmadd_ps(p.rw, tz, _mm256_fmsub_ps(p.rx, ty, _mm256_mul_ps(p.ry, tx))));
+    return r;
+}
+
+static inline __m256 lerp8(__m256 a, __m256 b, __m256 alpha) {
+    // a + alpha * (b - a)
+    return _mm256_fmadd_ps(alpha, _mm256_sub_ps(b, a), a);
+}
+
+void blendPoses_AVX2(const float* a, const float* b, float* result, int stride, int numPoses, float alpha) {
+
+    assert(numPoses % 8 == 0);  // SIMD8
+
+    const __m256 alpha8 = _mm256_set1_ps(alpha);
+    const __m256 beta8 = _mm256_set1_ps(1.0f - alpha);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    for (int i = 0; i < numPoses; i += 8) {
+        Poses8 pa = loadPoses8(a + i, stride);
+        Poses8 pb = loadPoses8(b + i, stride);
+        Poses8 r;
+
+        r.sx = lerp8(pa.sx, pb.sx, alpha8);
+        r.sy = lerp8(pa.sy, pb.sy, alpha8);
+        r.sz = lerp8(pa.sz, pb.sz, alpha8);
+        r.tx = lerp8(pa.tx, pb.tx, alpha8);
+        r.ty = lerp8(pa.ty, pb.ty, alpha8);
+        r.tz = lerp8(pa.tz, pb.tz, alpha8);
+
+        // take the shortest path, by flipping the sign of alpha where dot(a, b) < 0
+        __m256 dot = _mm256_mul_ps(pa.rx, pb.rx);
+        dot = _mm256_fmadd_ps(pa.ry, pb.ry, dot);
+        dot = _mm256_fmadd_ps(pa.rz, pb.rz, dot);
+        dot = _mm256_fmadd_ps(pa.rw, pb.rw, dot);
+        __m256 bAlpha = _mm256_xor_ps(alpha8, _mm256_and_ps(dot, signMask));
+
+        __m256 rx = _mm256_fmadd_ps(bAlpha, pb.rx, _mm256_mul_ps(beta8, pa.rx));
+        __m256 ry = _mm256_fmadd_ps(bAlpha, pb.ry, _mm256_mul_ps(beta8, pa.ry));
+        __m256 rz = _mm256_fmadd_ps(bAlpha, pb.rz, _mm256_mul_ps(beta8, pa.rz));
+        __m256 rw = _mm256_fmadd_ps(bAlpha, pb.rw, _mm256_mul_ps(beta8, pa.rw));
+
+        __m256 lengthSquared = _mm256_mul_ps(rx, rx);
+        lengthSquared = _mm256_fmadd_ps(ry, ry, lengthSquared);
+        lengthSquared = _mm256_fmadd_ps(rz, rz, lengthSquared);
+        lengthSquared = _mm256_fmadd_ps(rw, rw, lengthSquared);
+        __m256 oneOverLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+
+        r.rx = _mm256_mul_ps(rx, oneOverLength);
+        r.ry = _mm256_mul_ps(ry, oneOverLength);
+        r.rz = _mm256_mul_ps(rz, oneOverLength);
+        r.rw = _mm256_mul_ps(rw, oneOverLength);
+
+        storePoses8(result + i, stride, r);
+    }
+}
+
+void multiplyPoses_AVX2(const float* a, const float* b, float* result, int stride, int numPoses) {
+
+    assert(numPoses % 8 == 0);  // SIMD8
+
+    for (int i = 0; i < numPoses; i += 8) {
+        Poses8 pa = loadPoses8(a + i, stride);
+        Poses8 pb = loadPoses8(b + i, stride);
+        storePoses8(result + i, stride, composePoses8(pa, pb));
+    }
+}
+
+// poses[i] = poses[parentSlots[i]] * poses[i], for i in [begin, end).
+// None of the parents may lie in [begin, end), which AnimPoseHierarchy guarantees for a single level.
+void composeLevel_AVX2(float* poses, int stride, const int* parentSlots, int begin, int end) {
+
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (int i = begin; i < end; i += 8) {
+        // levels are rarely a multiple of eight long, so mask off the lanes past the end
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(end - i), lanes);
+        __m256i indices = _mm256_maskload_epi32(parentSlots + i, mask);
+
+        Poses8 parent = gatherPoses8(poses, stride, indices, mask);
+        Poses8 child = maskLoadPoses8(poses + i, stride, mask);
+        maskStorePoses8(poses + i, stride, mask, composePoses8(parent, child));
+    }
+}
+
+#endif
@@ -268,20 +268,19 @@ int InboundAudioStream::lostAudioData(int numPackets) {
 }
 
 int InboundAudioStream::parseAudioData(PacketType type, const QByteArray& packetAfterStreamProperties) {
-    QByteArray decodedBuffer;
-
     // may block on the real-time thread, which is acceptible as 
     // parseAudioData is only called by the packet processing
     // thread which, while high performance, is not as sensitive to
     // delays as the real-time thread.
     QMutexLocker lock(&_decoderMutex);
-    if (_decoder) {
-        _decoder->decode(packetAfterStreamProperties, decodedBuffer);
-    } else {
-        decodedBuffer = packetAfterStreamProperties;
+    if (!_decoder) {
+        return _ringBuffer.writeData(packetAfterStreamProperties.constData(), packetAfterStreamProperties.size());
     }
-    auto actualSize = decodedBuffer.size();
-    return _ringBuffer.writeData(decodedBuffer.data(), actualSize);
+
+    // decode into the preallocated buffer, so that steady state decoding does not allocate
+    int decodedSize = _decoder->decodeInto(packetAfterStreamProperties.constData(), packetAfterStreamProperties.size(),
+                                           _decodedBuffer);
+    return _ringBuffer.writeData(_decodedBuffer.constData(), decodedSize);
 }
 
 int InboundAudioStream::writeDroppableSilentFrames(int silentFrames) {
@@ -574,6 +573,7 @@ void InboundAudioStream::setupCodec(CodecPluginPointer codec, const QString& cod
     if (_codec) {
         QMutexLocker lock(&_decoderMutex);
         _decoder = codec->createDecoder(AudioConstants::SAMPLE_RATE, numChannels);
+        _decodedBuffer.resize(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL * numChannels);
     }
 }
 
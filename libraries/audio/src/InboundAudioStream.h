@@ -189,6 +189,7 @@ protected:
     QString _selectedCodecName;
     QMutex _decoderMutex;
     Decoder* _decoder { nullptr };
+    QByteArray _decodedBuffer; // reused by parseAudioData, guarded by _decoderMutex
     int _mismatchedAudioCodecCount { 0 };
 };
 
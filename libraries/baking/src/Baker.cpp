@@ -13,6 +13,18 @@
 
 #include "ModelBakingLoggingCategory.h"
 
+std::shared_ptr<BakeCache> Baker::_bakeCache;
+
+Baker::Baker() :
+    _cache(_bakeCache)
+{
+}
+
+void Baker::startBake() {
+    _bakeTimer.start();
+    bake();
+}
+
 bool Baker::shouldStop() {
     if (_shouldAbort) {
         setWasAborted(true);
@@ -12,12 +12,18 @@
 #ifndef hifi_Baker_h
 #define hifi_Baker_h
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
 
+#include <memory>
+
+class BakeCache;
+
 class Baker : public QObject {
     Q_OBJECT
 
 public:
+    Baker();
     virtual ~Baker() = default;
 
     bool shouldStop();
@@ -37,7 +43,15 @@ public:
 
     bool wasAborted() const { return _wasAborted.load(); }
 
+    // Started when startBake runs on the baker's thread, invalid until then
+    const QElapsedTimer& getBakeTimer() const { return _bakeTimer; }
+
+    // Bakers created while a cache is set restore the results of unchanged bakes from it instead of redoing them
+    static void setBakeCache(const std::shared_ptr<BakeCache>& bakeCache) { _bakeCache = bakeCache; }
+
 public slots:
+    // Bakes, after recording when the bake started so that callers can tell queueing from baking
+    void startBake();
     virtual void bake() = 0;
     virtual void abort() { _shouldAbort.store(true); }
 
@@ -62,6 +76,13 @@ protected:
 
     std::atomic<bool> _shouldAbort { false };
     std::atomic<bool> _wasAborted { false };
+
+    std::shared_ptr<BakeCache> _cache;
+
+private:
+    QElapsedTimer _bakeTimer;
+
+    static std::shared_ptr<BakeCache> _bakeCache;
 };
 
 #endif // hifi_Baker_h
@@ -17,8 +17,12 @@
 #include <SharedUtil.h>
 #include <PathUtils.h>
 
+#include "baking/BakeCache.h"
+
 const int ASCII_CHARACTERS_UPPER_LIMIT = 126;
 
+const int JSBaker::CACHE_VERSION = 1;
+
 JSBaker::JSBaker(const QUrl& jsURL, const QString& bakedOutputDir) :
     _jsURL(jsURL),
     _bakedOutputDir(bakedOutputDir)
@@ -91,6 +95,24 @@ void JSBaker::handleScriptNetworkReply() {
 }
 
 void JSBaker::processScript() {
+    auto fileName = _jsURL.fileName();
+    auto baseName = fileName.left(fileName.lastIndexOf('.'));
+    auto bakedFilename = baseName + BAKED_JS_EXTENSION;
+
+    _bakedJSFilePath = _bakedOutputDir + "/" + bakedFilename;
+
+    QString cacheKey;
+    if (_cache) {
+        cacheKey = BakeCache::makeKey("js", CACHE_VERSION, QByteArray(), _originalScript);
+        BakeCache::Artifact artifact;
+        if (_cache->restore(cacheKey, _bakedOutputDir, baseName, artifact)) {
+            _outputFiles.push_back(_bakedJSFilePath);
+            qCDebug(js_baking) << "Restored the minified" << _jsURL << "from the bake cache";
+            emit finished();
+            return;
+        }
+    }
+
     // Read file into an array
     QByteArray outputJS;
 
@@ -103,12 +125,6 @@ void JSBaker::processScript() {
     }
 
     // Bake Successful. Export the file
-    auto fileName = _jsURL.fileName();
-    auto baseName = fileName.left(fileName.lastIndexOf('.'));
-    auto bakedFilename = baseName + BAKED_JS_EXTENSION;
-
-    _bakedJSFilePath = _bakedOutputDir + "/" + bakedFilename;
-
     QFile bakedFile;
     bakedFile.setFileName(_bakedJSFilePath);
     if (!bakedFile.open(QIODevice::WriteOnly)) {
@@ -117,11 +133,18 @@ void JSBaker::processScript() {
     }
 
     bakedFile.write(outputJS);
+    bakedFile.close();
 
     // Export successful
     _outputFiles.push_back(_bakedJSFilePath);
     qCDebug(js_baking) << "Exported" << _jsURL << "minified to" << _bakedJSFilePath;
 
+    if (_cache) {
+        BakeCache::Artifact artifact;
+        artifact.files.push_back(bakedFilename);
+        _cache->store(cacheKey, _bakedOutputDir, baseName, artifact);
+    }
+
     // emit signal to indicate the JS baking is finished
     emit finished();
 }
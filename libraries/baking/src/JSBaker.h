@@ -25,6 +25,9 @@ public:
     JSBaker(const QUrl& jsURL, const QString& bakedOutputDir);
     static bool bakeJS(const QByteArray& inputFile, QByteArray& outputFile);
 
+    // Whenever a change is made to the minification, this value should be incremented so that cached bakes are redone
+    static const int CACHE_VERSION;
+
     QString getJSPath() const { return _jsURL.toDisplayString(); }
     QString getBakedJSFilePath() const { return _bakedJSFilePath; }
 
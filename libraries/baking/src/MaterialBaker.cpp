@@ -23,7 +23,14 @@
 
 #include <graphics-scripting/GraphicsScriptingInterface.h>
 
-std::function<QThread*()> MaterialBaker::_getNextOvenWorkerThreadOperator;
+#include "baking/BakeCache.h"
+
+const int MaterialBaker::CACHE_VERSION = 1;
+
+static const QString CACHED_TEXTURE_DIR_KEY = "textureDir";
+static const QString CACHED_BAKED_MATERIAL_DATA_KEY = "bakedMaterialData";
+
+std::function<QThread*(Baker*)> MaterialBaker::_getNextOvenWorkerThreadOperator;
 
 static int materialNum = 0;
 
@@ -39,6 +46,10 @@ MaterialBaker::MaterialBaker(const QString& materialData, bool isURL, const QStr
 void MaterialBaker::bake() {
     qDebug(material_baking) << "Material Baker" << _materialData << "bake starting";
 
+    if (_cache && !_materialResource && restoreFromCache()) {
+        return;
+    }
+
     // once our script is loaded, kick off a the processing
     connect(this, &MaterialBaker::originalMaterialLoaded, this, &MaterialBaker::processMaterial);
 
@@ -135,6 +146,14 @@ void MaterialBaker::processMaterial() {
                     if (QImageReader::supportedImageFormats().contains(extension.toLatin1())) {
                         TextureKey textureKey(textureURL, type);
                         if (!_textureBakers.contains(textureKey)) {
+                            if (content.isEmpty()) {
+                                if (textureURL.isLocalFile()) {
+                                    _cacheDependencies.push_back(textureURL.toLocalFile());
+                                } else {
+                                    _isCacheable = false;
+                                }
+                            }
+
                             auto baseTextureFileName = _textureFileNamer.createBaseTextureFileName(textureURL.fileName(), type);
 
                             QSharedPointer<TextureBaker> textureBaker {
@@ -144,7 +163,7 @@ void MaterialBaker::processMaterial() {
                             textureBaker->setMapChannel(mapChannel);
                             connect(textureBaker.data(), &TextureBaker::finished, this, &MaterialBaker::handleFinishedTextureBaker);
                             _textureBakers.insert(textureKey, textureBaker);
-                            textureBaker->moveToThread(_getNextOvenWorkerThreadOperator ? _getNextOvenWorkerThreadOperator() : thread());
+                            textureBaker->moveToThread(_getNextOvenWorkerThreadOperator ? _getNextOvenWorkerThreadOperator(textureBaker.data()) : thread());
                             // By default, Qt will invoke this bake immediately if the TextureBaker is on the same worker thread as this MaterialBaker.
                             // We don't want that, because threads may be waiting for work while this thread is stuck processing a TextureBaker.
                             // On top of that, _textureBakers isn't fully populated.
@@ -186,10 +205,14 @@ void MaterialBaker::handleFinishedTextureBaker() {
             for (auto networkMaterial : _materialsNeedingRewrite.values(textureKey)) {
                 networkMaterial->getTextureMap(baker->getMapChannel())->getTextureSource()->setUrl(relativeURL);
             }
+
+            auto outputFiles = baker->getOutputFiles();
+            _textureOutputFiles.insert(_textureOutputFiles.end(), outputFiles.begin(), outputFiles.end());
         } else {
             // this texture failed to bake - this doesn't fail the entire bake but we need to add the errors from
             // the texture to our warnings
             _warningList << baker->getWarnings();
+            _isCacheable = false;
         }
 
         _materialsNeedingRewrite.remove(textureKey);
@@ -245,12 +268,98 @@ void MaterialBaker::outputMaterial() {
             _bakedMaterialData = QString(outputMaterial);
             qCDebug(material_baking) << "Converted" << _materialData << "to" << _bakedMaterialData;
         }
+
+        if (_cache && !_cacheKey.isEmpty() && _isCacheable) {
+            storeInCache();
+        }
     }
 
     // emit signal to indicate the material baking is finished
     emit finished();
 }
 
+bool MaterialBaker::restoreFromCache() {
+    // only materials given as data or as local files have a source to key the cache with,
+    // the ones ModelBaker sets are cached along with their model
+    QByteArray source;
+    QString bakedFilename;
+    if (_isURL) {
+        QUrl materialURL { _materialData };
+        if (!materialURL.isLocalFile()) {
+            return false;
+        }
+        QFile materialFile { materialURL.toLocalFile() };
+        if (!materialFile.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+        source = materialFile.readAll();
+
+        auto fileName = materialURL.fileName();
+        bakedFilename = fileName.left(fileName.lastIndexOf('.')) + BAKED_MATERIAL_EXTENSION;
+    } else {
+        source = _materialData.toUtf8();
+    }
+
+    QByteArray options;
+    options.append(bakedFilename.toUtf8());
+    options.append('\0');
+    options.append(_destinationPath.toString().toUtf8());
+    options.append('\0');
+    options.append((char)TextureBaker::isCompressionEnabled());
+    options.append((const char*)&TextureBaker::CACHE_VERSION, sizeof(TextureBaker::CACHE_VERSION));
+    _cacheKey = BakeCache::makeKey("material", CACHE_VERSION, options, source);
+
+    // the textures of each material baker go to a folder of their own, so restore them into ours
+    QDir bakedOutputDir { _bakedOutputDir };
+    auto textureDir = bakedOutputDir.relativeFilePath(_textureOutputDir);
+    BakeCache::Artifact artifact;
+    if (!_cache->restore(_cacheKey, bakedOutputDir, textureDir, artifact)) {
+        return false;
+    }
+
+    // and point the baked material at that folder instead of the one it was cached from
+    auto cachedTextureDir = artifact.metadata[CACHED_TEXTURE_DIR_KEY].toString() + "/";
+    if (_isURL) {
+        _bakedMaterialData = bakedOutputDir.absoluteFilePath(bakedFilename);
+
+        QFile bakedFile { _bakedMaterialData };
+        if (!bakedFile.open(QIODevice::ReadWrite)) {
+            return false;
+        }
+        auto bakedMaterial = QString::fromUtf8(bakedFile.readAll()).replace(cachedTextureDir, textureDir + "/").toUtf8();
+        bakedFile.resize(0);
+        if (bakedFile.write(bakedMaterial) == -1) {
+            return false;
+        }
+        _outputFiles.push_back(_bakedMaterialData);
+    } else {
+        _bakedMaterialData = artifact.metadata[CACHED_BAKED_MATERIAL_DATA_KEY].toString().replace(cachedTextureDir, textureDir + "/");
+    }
+
+    qCDebug(material_baking) << "Restored the bake of" << _materialData << "from the bake cache";
+    emit finished();
+    return true;
+}
+
+void MaterialBaker::storeInCache() {
+    QDir bakedOutputDir { _bakedOutputDir };
+    auto textureDir = bakedOutputDir.relativeFilePath(_textureOutputDir);
+
+    BakeCache::Artifact artifact;
+    if (_isURL) {
+        artifact.files.push_back(bakedOutputDir.relativeFilePath(_bakedMaterialData));
+    } else {
+        artifact.metadata[CACHED_BAKED_MATERIAL_DATA_KEY] = _bakedMaterialData;
+    }
+    for (const auto& textureOutputFile : _textureOutputFiles) {
+        artifact.files.push_back(bakedOutputDir.relativeFilePath(textureOutputFile));
+    }
+    artifact.metadata[CACHED_TEXTURE_DIR_KEY] = textureDir;
+    artifact.dependencies = _cacheDependencies;
+
+    _cache->store(_cacheKey, bakedOutputDir, textureDir, artifact);
+}
+
 void MaterialBaker::addTexture(const QString& materialName, image::TextureUsage::Type textureUsage, const hfm::Texture& texture) {
     auto& textureUsageMap = _textureContentMap[materialName.toStdString()];
     if (textureUsageMap.find(textureUsage) == textureUsageMap.end() && !texture.content.isEmpty()) {
@@ -37,7 +37,16 @@ public:
 
     NetworkMaterialResourcePointer getNetworkMaterialResource() const { return _materialResource; }
 
-    static void setNextOvenWorkerThreadOperator(std::function<QThread*()> getNextOvenWorkerThreadOperator) { _getNextOvenWorkerThreadOperator = getNextOvenWorkerThreadOperator; }
+    // The local files this bake read besides its material data, and whether the bake can be cached at all:
+    // materials with textures that had to be downloaded or failed to bake are baked again every time
+    QStringList getCacheDependencies() const { return _cacheDependencies; }
+    bool isCacheable() const { return _isCacheable; }
+
+    // Whenever a change is made to the baked materials, this value should be incremented so that cached bakes are redone
+    static const int CACHE_VERSION;
+
+    // getNextOvenWorkerThreadOperator picks the thread for each texture baker this material baker starts
+    static void setNextOvenWorkerThreadOperator(std::function<QThread*(Baker*)> getNextOvenWorkerThreadOperator) { _getNextOvenWorkerThreadOperator = getNextOvenWorkerThreadOperator; }
 
 public slots:
     virtual void bake() override;
@@ -53,6 +62,8 @@ private slots:
 
 private:
     void loadMaterial();
+    bool restoreFromCache();
+    void storeInCache();
 
     QString _materialData;
     bool _isURL;
@@ -67,8 +78,13 @@ private:
     QString _textureOutputDir;
     QString _bakedMaterialData;
 
+    QString _cacheKey;
+    QStringList _cacheDependencies;
+    bool _isCacheable { true };
+    std::vector<QString> _textureOutputFiles;
+
     QScriptEngine _scriptEngine;
-    static std::function<QThread*()> _getNextOvenWorkerThreadOperator;
+    static std::function<QThread*(Baker*)> _getNextOvenWorkerThreadOperator;
     TextureFileNamer _textureFileNamer;
 
     void addTexture(const QString& materialName, image::TextureUsage::Type textureUsage, const hfm::Texture& texture);
@@ -20,9 +20,11 @@
 
 #include <model-baker/Baker.h>
 #include <model-baker/PrepareJointsTask.h>
+#include <model-baker/BuildDracoMeshTask.h>
 
 #include <FBXWriter.h>
 #include <FSTReader.h>
+#include <ProgressiveModel.h>
 
 #ifdef _WIN32
 #pragma warning( push )
@@ -41,8 +43,19 @@
 #endif
 
 #include "baking/BakerLibrary.h"
+#include "baking/BakeCache.h"
 
 #include <QJsonArray>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFileInfo>
+
+const int ModelBaker::CACHE_VERSION = 2;
+
+// The progressive model holds this many coarser LODs before the full detail model, each with a quarter of the triangles of the next
+static const int NUM_PROGRESSIVE_LODS = 2;
+static const float PROGRESSIVE_LOD_TRIANGLE_RATIO = 0.25f;
+
+static const QString CACHED_OUTPUT_MAPPING_KEY = "outputMapping";
 
 ModelBaker::ModelBaker(const QUrl& inputModelURL, const QString& bakedOutputDirectory, const QString& originalOutputDirectory, bool hasBeenBaked) :
     _originalInputModelURL(inputModelURL),
@@ -214,6 +227,21 @@ void ModelBaker::bakeSourceCopy() {
     }
     hifi::ByteArray modelData = modelFile.readAll();
 
+    if (_cache) {
+        _cacheKey = BakeCache::makeKey(metaObject()->className(), CACHE_VERSION, getCacheOptions(), modelData);
+        if (restoreFromCache()) {
+            return;
+        }
+
+        for (const auto& dependency : getSourceDependencies(modelData)) {
+            if (dependency.isLocalFile()) {
+                _cacheDependencies.push_back(dependency.toLocalFile());
+            } else {
+                _isCacheable = false;
+            }
+        }
+    }
+
     std::vector<hifi::ByteArray> dracoMeshes;
     std::vector<std::vector<hifi::ByteArray>> dracoMaterialLists; // Material order for per-mesh material lookup used by dracoMeshes
 
@@ -238,8 +266,11 @@ void ModelBaker::bakeSourceCopy() {
 
         baker::Baker baker(loadedModel, serializerMapping, _mappingURL);
         auto config = baker.getConfiguration();
-        // Enable compressed draco mesh generation
-        config->getJobConfig("BuildDracoMesh")->setEnabled(true);
+        // Enable compressed draco mesh generation, along with the coarser LODs of the progressive model
+        auto dracoConfig = (BuildDracoMeshConfig*)config->getJobConfig("BuildDracoMesh");
+        dracoConfig->setEnabled(true);
+        dracoConfig->numLODs = NUM_PROGRESSIVE_LODS;
+        dracoConfig->lodTriangleRatio = PROGRESSIVE_LOD_TRIANGLE_RATIO;
         // Do not permit potentially lossy modification of joint data meant for runtime
         ((PrepareJointsConfig*)config->getJobConfig("PrepareJoints"))->passthrough = true;
     
@@ -256,6 +287,8 @@ void ModelBaker::bakeSourceCopy() {
         _materialMapping = baker.getMaterialMapping();
         dracoMeshes = baker.getDracoMeshes();
         dracoMaterialLists = baker.getDracoMaterialLists();
+        _dracoMeshes = dracoMeshes;
+        _dracoLODMeshes = baker.getDracoLODMeshes();
     }
 
     // Do format-specific baking
@@ -280,6 +313,7 @@ void ModelBaker::bakeSourceCopy() {
 
 void ModelBaker::handleFinishedMaterialBaker() {
     auto baker = qobject_cast<MaterialBaker*>(sender());
+    addCacheDependencies(baker);
 
     if (baker) {
         if (!baker->hasErrors()) {
@@ -312,6 +346,16 @@ void ModelBaker::handleFinishedMaterialBaker() {
 
 void ModelBaker::bakeMaterialMap() {
     if (!_materialMapping.empty()) {
+        // materials the mapping loaded from files are read along with the model
+        auto materialURL = _materialMapping.front().second ? _materialMapping.front().second->getURL() : QUrl();
+        if (!materialURL.isEmpty()) {
+            if (materialURL.isLocalFile()) {
+                _cacheDependencies.push_back(materialURL.toLocalFile());
+            } else {
+                _isCacheable = false;
+            }
+        }
+
         // TODO:  The existing material map must be baked in order, so we do it all on this thread to preserve the order.
         // It could be spread over multiple threads if we had a good way of preserving the order once all of the bakers are done
         _materialBaker = QSharedPointer<MaterialBaker>(
@@ -328,6 +372,7 @@ void ModelBaker::bakeMaterialMap() {
 
 void ModelBaker::handleFinishedMaterialMapBaker() {
     auto baker = qobject_cast<MaterialBaker*>(sender());
+    addCacheDependencies(baker);
 
     if (baker) {
         if (!baker->hasErrors()) {
@@ -409,6 +454,10 @@ void ModelBaker::outputBakedFST() {
     auto outputMapping = _mapping;
     outputMapping[FST_VERSION_FIELD] = FST_VERSION;
     outputMapping[FILENAME_FIELD] = _bakedModelURL.fileName();
+    if (hasProgressiveLODs()) {
+        // clients which know of progressive models load it instead of the full detail model
+        outputMapping[PROGRESSIVE_FILENAME_FIELD] = QFileInfo(getProgressiveModelPath()).fileName();
+    }
     outputMapping.remove(TEXDIR_FIELD);
     outputMapping.remove(COMMENT_FIELD);
     if (!_materialMappingJSON.isEmpty()) {
@@ -429,10 +478,74 @@ void ModelBaker::outputBakedFST() {
     _outputMappingURL = outputFSTURL;
 
     exportScene();
+    if (_cache && !_cacheKey.isEmpty() && _isCacheable && !hasErrors()) {
+        storeInCache();
+    }
     qCDebug(model_baking) << "Finished baking, emitting finished" << _modelURL;
     emit finished();
 }
 
+QByteArray ModelBaker::getCacheOptions() const {
+    // QVariantHash has no set order, so key the mapping by its keys in sorted order
+    QJsonObject mapping;
+    for (const auto& key : _mapping.uniqueKeys()) {
+        auto values = _mapping.values(key);
+        mapping[key] = values.size() == 1 ? QJsonValue::fromVariant(values.front()) : QJsonArray::fromVariantList(values);
+    }
+
+    QByteArray options = QJsonDocument(mapping).toJson(QJsonDocument::Compact);
+    options.append('\0');
+    options.append(_mappingURL.fileName().toUtf8());
+    options.append('\0');
+    options.append(_bakedModelURL.fileName().toUtf8());
+    options.append('\0');
+
+    // the bake includes the materials and textures of the model, so their settings are part of it too
+    const int versions[] = { FST_VERSION, FBX_DRACO_MESH_VERSION, DRACO_MESH_VERSION, MaterialBaker::CACHE_VERSION, TextureBaker::CACHE_VERSION };
+    options.append((const char*)versions, sizeof(versions));
+    options.append((char)TextureBaker::isCompressionEnabled());
+    return options;
+}
+
+bool ModelBaker::restoreFromCache() {
+    QDir bakedOutputDir { _bakedOutputDir };
+    BakeCache::Artifact artifact;
+    if (!_cache->restore(_cacheKey, bakedOutputDir, QString(), artifact)) {
+        return false;
+    }
+
+    for (const auto& file : artifact.files) {
+        _outputFiles.push_back(bakedOutputDir.absoluteFilePath(file));
+    }
+    _outputMappingURL = bakedOutputDir.absoluteFilePath(artifact.metadata[CACHED_OUTPUT_MAPPING_KEY].toString());
+
+    qCDebug(model_baking) << "Restored the bake of" << _modelURL << "from the bake cache";
+    emit finished();
+    return true;
+}
+
+void ModelBaker::storeInCache() {
+    // the baked output folder belongs to this model, and holds its material textures along with the model itself
+    QDir bakedOutputDir { _bakedOutputDir };
+    BakeCache::Artifact artifact;
+    QDirIterator it(_bakedOutputDir, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        artifact.files.push_back(bakedOutputDir.relativeFilePath(it.next()));
+    }
+    artifact.metadata[CACHED_OUTPUT_MAPPING_KEY] = bakedOutputDir.relativeFilePath(_outputMappingURL);
+    artifact.dependencies = _cacheDependencies;
+
+    _cache->store(_cacheKey, bakedOutputDir, QString(), artifact);
+}
+
+void ModelBaker::addCacheDependencies(const MaterialBaker* baker) {
+    if (baker && !baker->hasErrors() && baker->isCacheable()) {
+        _cacheDependencies.append(baker->getCacheDependencies());
+    } else {
+        _isCacheable = false;
+    }
+}
+
 void ModelBaker::abort() {
     Baker::abort();
 
@@ -498,6 +611,10 @@ void ModelBaker::exportScene() {
 
     _outputFiles.push_back(bakedModelURL);
 
+    if (hasProgressiveLODs()) {
+        exportProgressiveModel(fbxData);
+    }
+
 #ifdef HIFI_DUMP_FBX
     {
         FBXToJSON fbxToJSON;
@@ -514,3 +631,64 @@ void ModelBaker::exportScene() {
 
     qCDebug(model_baking) << "Exported" << _modelURL << "with re-written paths to" << bakedModelURL;
 }
+
+bool ModelBaker::hasProgressiveLODs() const {
+    for (const auto& lodMeshes : _dracoLODMeshes) {
+        if (lodMeshes != _dracoMeshes) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QString ModelBaker::getProgressiveModelPath() const {
+    auto path = _bakedModelURL.toString();
+    if (path.endsWith(FBX_EXTENSION, Qt::CaseInsensitive)) {
+        path.chop(FBX_EXTENSION.length());
+    }
+    return path + PROGRESSIVE_MODEL_EXTENSION;
+}
+
+static void replaceDracoMeshes(FBXNode& node, const QHash<hifi::ByteArray, hifi::ByteArray>& replacements) {
+    if (node.name == "DracoMesh" && !node.properties.isEmpty()) {
+        auto replacement = replacements.find(node.properties[0].toByteArray());
+        if (replacement != replacements.end()) {
+            node.properties[0] = QVariant::fromValue(replacement.value());
+        }
+        return;
+    }
+    for (auto& child : node.children) {
+        replaceDracoMeshes(child, replacements);
+    }
+}
+
+void ModelBaker::exportProgressiveModel(const hifi::ByteArray& fbxData) {
+    // every LOD is the baked scene with its own draco meshes in place of the full detail ones
+    std::vector<hifi::ByteArray> chunks;
+    for (const auto& lodMeshes : _dracoLODMeshes) {
+        QHash<hifi::ByteArray, hifi::ByteArray> replacements;
+        for (size_t i = 0; i < lodMeshes.size() && i < _dracoMeshes.size(); i++) {
+            if (lodMeshes[i] != _dracoMeshes[i]) {
+                replacements[_dracoMeshes[i]] = lodMeshes[i];
+            }
+        }
+        if (replacements.isEmpty()) {
+            continue;
+        }
+
+        FBXNode lodRootNode = _rootNode;
+        replaceDracoMeshes(lodRootNode, replacements);
+        chunks.push_back(FBXWriter::encodeFBX(lodRootNode));
+    }
+    chunks.push_back(fbxData);
+
+    QString progressiveModelPath = getProgressiveModelPath();
+    QFile progressiveFile(progressiveModelPath);
+    if (!progressiveFile.open(QIODevice::WriteOnly) || progressiveFile.write(ProgressiveModel::write(chunks)) == -1) {
+        handleError("Error writing " + progressiveModelPath);
+        return;
+    }
+
+    _outputFiles.push_back(progressiveModelPath);
+    qCDebug(model_baking) << "Exported" << _modelURL << "as a progressive model with" << chunks.size() << "chunks to" << progressiveModelPath;
+}
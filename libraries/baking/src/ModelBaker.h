@@ -55,6 +55,9 @@ public:
     virtual QUrl getFullOutputMappingURL() const;
     QUrl getBakedModelURL() const { return _bakedModelURL; }
 
+    // Whenever a change is made to the baked models, this value should be incremented so that cached bakes are redone
+    static const int CACHE_VERSION;
+
 signals:
     void modelLoaded();
 
@@ -67,6 +70,9 @@ protected:
     virtual void bakeProcessedSource(const hfm::Model::Pointer& hfmModel, const std::vector<hifi::ByteArray>& dracoMeshes, const std::vector<std::vector<hifi::ByteArray>>& dracoMaterialLists) = 0;
     void exportScene();
 
+    // The other files the model format reads along with the model itself, such as the material libraries of OBJ files
+    virtual QList<QUrl> getSourceDependencies(const hifi::ByteArray& modelData) const { return QList<QUrl>(); }
+
     FBXNode _rootNode;
     QUrl _originalInputModelURL;
     QUrl _modelURL;
@@ -89,6 +95,13 @@ private:
     void outputUnbakedFST();
     void outputBakedFST();
     void bakeMaterialMap();
+    QByteArray getCacheOptions() const;
+    bool restoreFromCache();
+    void storeInCache();
+    void addCacheDependencies(const MaterialBaker* baker);
+    bool hasProgressiveLODs() const;
+    QString getProgressiveModelPath() const;
+    void exportProgressiveModel(const hifi::ByteArray& fbxData);
 
     bool _hasBeenBaked { false };
 
@@ -97,6 +110,13 @@ private:
     int _materialMapIndex { 0 };
     QJsonArray _materialMappingJSON;
     QSharedPointer<MaterialBaker> _materialBaker;
+
+    std::vector<hifi::ByteArray> _dracoMeshes;
+    std::vector<std::vector<hifi::ByteArray>> _dracoLODMeshes;
+
+    QString _cacheKey;
+    QStringList _cacheDependencies;
+    bool _isCacheable { true };
 };
 
 #endif // hifi_ModelBaker_h
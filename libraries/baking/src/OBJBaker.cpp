@@ -35,6 +35,26 @@ const QByteArray CONNECTIONS_NODE_PROPERTY = "OO";
 const QByteArray CONNECTIONS_NODE_PROPERTY_1 = "OP";
 const QByteArray MESH = "Mesh";
 
+QList<QUrl> OBJBaker::getSourceDependencies(const hifi::ByteArray& modelData) const {
+    // OBJSerializer reads each material library the model names from next to the model
+    static const hifi::ByteArray MATERIAL_LIBRARY_TOKEN = "mtllib";
+    QList<QUrl> dependencies;
+    int index = 0;
+    while ((index = modelData.indexOf(MATERIAL_LIBRARY_TOKEN, index)) != -1) {
+        index += MATERIAL_LIBRARY_TOKEN.size();
+        int lineEnd = modelData.indexOf('\n', index);
+        if (lineEnd == -1) {
+            lineEnd = modelData.size();
+        }
+        QString libraryName = modelData.mid(index, lineEnd - index).trimmed();
+        if (!libraryName.isEmpty()) {
+            dependencies.push_back(_modelURL.resolved(QUrl(libraryName).fileName()));
+        }
+        index = lineEnd;
+    }
+    return dependencies;
+}
+
 void OBJBaker::bakeProcessedSource(const hfm::Model::Pointer& hfmModel, const std::vector<hifi::ByteArray>& dracoMeshes, const std::vector<std::vector<hifi::ByteArray>>& dracoMaterialLists) {
     // Write OBJ Data as FBX tree nodes
     createFBXNodeTree(_rootNode, hfmModel, dracoMeshes[0], dracoMaterialLists[0]);
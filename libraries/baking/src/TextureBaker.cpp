@@ -25,12 +25,19 @@
 #include <OwningBuffer.h>
 
 #include "ModelBakingLoggingCategory.h"
+#include "baking/BakeCache.h"
 
 const QString BAKED_TEXTURE_KTX_EXT = ".ktx";
 const QString BAKED_TEXTURE_BCN_SUFFIX = "_bcn.ktx";
 const QString BAKED_META_TEXTURE_SUFFIX = ".texmeta.json";
 
+const int TextureBaker::CACHE_VERSION = 1;
+
+static const QString CACHED_COMPRESSED_TEXTURES_KEY = "compressed";
+static const QString CACHED_UNCOMPRESSED_TEXTURE_KEY = "uncompressed";
+
 bool TextureBaker::_compressionEnabled = true;
+std::shared_ptr<TextureBakeRegistry> TextureBaker::_bakeRegistry;
 
 TextureBaker::TextureBaker(const QUrl& textureURL, image::TextureUsage::Type textureType,
                            const QDir& outputDirectory, const QString& baseFilename,
@@ -54,6 +61,18 @@ TextureBaker::TextureBaker(const QUrl& textureURL, image::TextureUsage::Type tex
         originalExtension = textureFilename.mid(extensionStart);
     }
     _originalCopyFilePath = _outputDirectory.absoluteFilePath(_baseFilename + originalExtension);
+
+    _registry = _bakeRegistry;
+    connect(this, &TextureBaker::sharedTextureBaked, this, &TextureBaker::copySharedTexture, Qt::QueuedConnection);
+}
+
+TextureBaker::~TextureBaker() {
+    if (_ownsSharedBake) {
+        // let the bakers waiting on us know that this content still has to be baked
+        _registry->finish(_sourceHash, TextureBakeRegistry::BakedTexture());
+    } else if (_waitsForSharedBake) {
+        _registry->release(_sourceHash, this);
+    }
 }
 
 void TextureBaker::bake() {
@@ -134,9 +153,7 @@ void TextureBaker::processTexture() {
     hasher.addData(_originalTexture);
     hasher.addData((const char*)&_textureType, sizeof(_textureType));
     auto hashData = hasher.result();
-    std::string hash = hashData.toHex().toStdString();
-
-    TextureMeta meta;
+    _sourceHash = hashData.toHex().toStdString();
 
     QString originalCopyFilePath = _originalCopyFilePath.toString();
 
@@ -150,14 +167,67 @@ void TextureBaker::processTexture() {
         // IMPORTANT: _originalTexture is empty past this point
         _originalTexture.clear();
         _outputFiles.push_back(originalCopyFilePath);
-        meta.original = _originalCopyFilePath.fileName();
+        _meta.original = _originalCopyFilePath.fileName();
     }
 
+    if (_cache) {
+        // the source hash covers the content and the usage type, so the cache only needs the settings on top of it
+        QByteArray options;
+        options.append((char)_compressionEnabled);
+        options.append((const char*)&KTX_VERSION, sizeof(KTX_VERSION));
+        _cacheKey = BakeCache::makeKey("texture", CACHE_VERSION, options, QByteArray::fromStdString(_sourceHash));
+        if (restoreFromCache()) {
+            writeMetaTexture();
+            return;
+        }
+    }
+
+    if (_registry) {
+        // the handler runs on the thread of whichever baker processed this content first,
+        // so stash the result and pick it up on our own thread
+        bool isFirst = _registry->claim(_sourceHash, this, [this](const TextureBakeRegistry::BakedTexture& bakedTexture) {
+            _sharedTexture = bakedTexture;
+            emit sharedTextureBaked();
+        });
+        if (!isFirst) {
+            _waitsForSharedBake = true;
+            return;
+        }
+        _ownsSharedBake = true;
+    }
+
+    bakeTexture();
+}
+
+void TextureBaker::bakeTexture() {
+    bool succeeded = writeBakedTextures();
+
+    if (_ownsSharedBake) {
+        TextureBakeRegistry::BakedTexture bakedTexture;
+        bakedTexture.succeeded = succeeded;
+        bakedTexture.outputDirectory = _outputDirectory;
+        bakedTexture.baseFilename = _baseFilename;
+        bakedTexture.meta = _meta;
+        _ownsSharedBake = false;
+        _registry->finish(_sourceHash, bakedTexture);
+    }
+
+    if (succeeded) {
+        if (_cache) {
+            storeInCache();
+        }
+        writeMetaTexture();
+    }
+}
+
+bool TextureBaker::writeBakedTextures() {
+    QString originalCopyFilePath = _originalCopyFilePath.toString();
+
     // Load the copy of the original file from the baked output directory. New images will be created using the original as the source data.
     auto buffer = std::static_pointer_cast<QIODevice>(std::make_shared<QFile>(originalCopyFilePath));
     if (!buffer->open(QIODevice::ReadOnly)) {
         handleError("Could not open original file at " + originalCopyFilePath);
-        return;
+        return false;
     }
 
     // Compressed KTX
@@ -172,24 +242,24 @@ void TextureBaker::processTexture() {
                                                         target, _abortProcessing);
             if (!processedTexture) {
                 handleError("Could not process texture " + _textureURL.toString());
-                return;
+                return false;
             }
-            processedTexture->setSourceHash(hash);
+            processedTexture->setSourceHash(_sourceHash);
 
             if (shouldStop()) {
-                return;
+                return false;
             }
 
             auto memKTX = gpu::Texture::serialize(*processedTexture);
             if (!memKTX) {
                 handleError("Could not serialize " + _textureURL.toString() + " to KTX");
-                return;
+                return false;
             }
 
             const char* name = khronos::gl::texture::toString(memKTX->_header.getGLInternaFormat());
             if (name == nullptr) {
                 handleError("Could not determine internal format for compressed KTX: " + _textureURL.toString());
-                return;
+                return false;
             }
 
             const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
@@ -200,10 +270,10 @@ void TextureBaker::processTexture() {
             QFile bakedTextureFile { filePath };
             if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
                 handleError("Could not write baked texture for " + _textureURL.toString());
-                return;
+                return false;
             }
             _outputFiles.push_back(filePath);
-            meta.availableTextureTypes[memKTX->_header.getGLInternaFormat()] = fileName;
+            _meta.availableTextureTypes[memKTX->_header.getGLInternaFormat()] = fileName;
         }
     }
 
@@ -214,18 +284,18 @@ void TextureBaker::processTexture() {
                                                     ABSOLUTE_MAX_TEXTURE_NUM_PIXELS, _textureType, false, gpu::BackendTarget::GL45, _abortProcessing);
         if (!processedTexture) {
             handleError("Could not process texture " + _textureURL.toString());
-            return;
+            return false;
         }
-        processedTexture->setSourceHash(hash);
+        processedTexture->setSourceHash(_sourceHash);
 
         if (shouldStop()) {
-            return;
+            return false;
         }
 
         auto memKTX = gpu::Texture::serialize(*processedTexture);
         if (!memKTX) {
             handleError("Could not serialize " + _textureURL.toString() + " to KTX");
-            return;
+            return false;
         }
 
         const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
@@ -236,16 +306,113 @@ void TextureBaker::processTexture() {
         QFile bakedTextureFile { filePath };
         if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
             handleError("Could not write baked texture for " + _textureURL.toString());
-            return;
+            return false;
         }
         _outputFiles.push_back(filePath);
-        meta.uncompressed = fileName;
+        _meta.uncompressed = fileName;
     } else {
         buffer.reset();
     }
 
+    return true;
+}
+
+void TextureBaker::copySharedTexture() {
+    _waitsForSharedBake = false;
+    if (shouldStop()) {
+        return;
+    }
+
+    // fall back to baking this texture ourselves whenever the shared bake can't be used
+    if (!_sharedTexture.succeeded) {
+        bakeTexture();
+        return;
+    }
+
+    // the shared files are named after the other baker's base filename, so rename them after ours as they are copied
+    auto copyFile = [&](const QString& fileName, QString& copiedFileName) {
+        copiedFileName = _baseFilename + fileName.mid(_sharedTexture.baseFilename.length());
+        auto sourcePath = _sharedTexture.outputDirectory.absoluteFilePath(fileName);
+        auto copyPath = _outputDirectory.absoluteFilePath(copiedFileName);
+        if (sourcePath != copyPath) {
+            QFile::remove(copyPath);
+            if (!QFile::copy(sourcePath, copyPath)) {
+                return false;
+            }
+        }
+        _outputFiles.push_back(copyPath);
+        return true;
+    };
+
+    for (const auto& formatAndFile : _sharedTexture.meta.availableTextureTypes) {
+        QString copiedFileName;
+        if (!copyFile(formatAndFile.second.toString(), copiedFileName)) {
+            bakeTexture();
+            return;
+        }
+        _meta.availableTextureTypes[formatAndFile.first] = copiedFileName;
+    }
+    if (!_sharedTexture.meta.uncompressed.isEmpty()) {
+        QString copiedFileName;
+        if (!copyFile(_sharedTexture.meta.uncompressed.toString(), copiedFileName)) {
+            bakeTexture();
+            return;
+        }
+        _meta.uncompressed = copiedFileName;
+    }
+
+    qCDebug(model_baking) << "Reused the bake of" << _sharedTexture.baseFilename << "for" << _textureURL;
+    writeMetaTexture();
+}
+
+bool TextureBaker::restoreFromCache() {
+    BakeCache::Artifact artifact;
+    if (!_cache->restore(_cacheKey, _outputDirectory, _baseFilename, artifact)) {
+        return false;
+    }
+
+    for (const auto& fileName : artifact.files) {
+        _outputFiles.push_back(_outputDirectory.absoluteFilePath(fileName));
+    }
+
+    // the cached file names leave out the base filename, which differs between bakes of the same content
+    auto compressedTextures = artifact.metadata[CACHED_COMPRESSED_TEXTURES_KEY].toObject();
+    for (auto it = compressedTextures.constBegin(); it != compressedTextures.constEnd(); ++it) {
+        auto format = (khronos::gl::texture::InternalFormat)it.key().toUInt();
+        _meta.availableTextureTypes[format] = _baseFilename + it.value().toString();
+    }
+    auto uncompressedTexture = artifact.metadata[CACHED_UNCOMPRESSED_TEXTURE_KEY].toString();
+    if (!uncompressedTexture.isEmpty()) {
+        _meta.uncompressed = _baseFilename + uncompressedTexture;
+    }
+
+    qCDebug(model_baking) << "Restored the bake of" << _textureURL << "from the bake cache";
+    return true;
+}
+
+void TextureBaker::storeInCache() {
+    BakeCache::Artifact artifact;
+
+    QJsonObject compressedTextures;
+    for (const auto& formatAndFile : _meta.availableTextureTypes) {
+        auto fileName = formatAndFile.second.toString();
+        artifact.files.push_back(fileName);
+        compressedTextures[QString::number((uint32_t)formatAndFile.first)] = fileName.mid(_baseFilename.length());
+    }
+    artifact.metadata[CACHED_COMPRESSED_TEXTURES_KEY] = compressedTextures;
+
+    if (!_meta.uncompressed.isEmpty()) {
+        auto fileName = _meta.uncompressed.toString();
+        artifact.files.push_back(fileName);
+        artifact.metadata[CACHED_UNCOMPRESSED_TEXTURE_KEY] = fileName.mid(_baseFilename.length());
+    }
+
+    _cache->store(_cacheKey, _outputDirectory, _baseFilename, artifact);
+}
+
+void TextureBaker::writeMetaTexture() {
     {
-        auto data = meta.serialize();
+        auto data = _meta.serialize();
         _metaTextureFileName = _outputDirectory.absoluteFilePath(_baseFilename + BAKED_META_TEXTURE_SUFFIX);
         QFile file { _metaTextureFileName };
         if (!file.open(QIODevice::WriteOnly) || file.write(data) == -1) {
@@ -19,8 +19,10 @@
 #include <QImageReader>
 
 #include <image/TextureProcessing.h>
+#include <TextureMeta.h>
 
 #include "Baker.h"
+#include "baking/TextureBakeRegistry.h"
 
 #include <graphics/Material.h>
 
@@ -34,6 +36,7 @@ public:
     TextureBaker(const QUrl& textureURL, image::TextureUsage::Type textureType,
                  const QDir& outputDirectory, const QString& baseFilename = QString(),
                  const QByteArray& textureContent = QByteArray());
+    ~TextureBaker();
 
     const QByteArray& getOriginalTexture() const { return _originalTexture; }
 
@@ -46,6 +49,13 @@ public:
     virtual void setWasAborted(bool wasAborted) override;
 
     static void setCompressionEnabled(bool enabled) { _compressionEnabled = enabled; }
+    static bool isCompressionEnabled() { return _compressionEnabled; }
+
+    // Whenever a change is made to the baked textures, this value should be incremented so that cached bakes are redone
+    static const int CACHE_VERSION;
+
+    // Texture bakers created while a registry is set share their work with the other bakers of the same content
+    static void setBakeRegistry(const std::shared_ptr<TextureBakeRegistry>& bakeRegistry) { _bakeRegistry = bakeRegistry; }
 
     void setMapChannel(graphics::Material::MapChannel mapChannel) { _mapChannel = mapChannel; }
     graphics::Material::MapChannel getMapChannel() const { return _mapChannel; }
@@ -57,13 +67,20 @@ public slots:
 
 signals:
     void originalTextureLoaded();
+    void sharedTextureBaked();
 
 private slots:
     void processTexture();
+    void copySharedTexture();
 
 private:
     void loadTexture();
     void handleTextureNetworkReply();
+    void bakeTexture();
+    bool writeBakedTextures();
+    void writeMetaTexture();
+    bool restoreFromCache();
+    void storeInCache();
 
     QUrl _textureURL;
     QByteArray _originalTexture;
@@ -78,7 +95,17 @@ private:
 
     std::atomic<bool> _abortProcessing { false };
 
+    std::string _sourceHash;
+    TextureMeta _meta;
+    QString _cacheKey;
+
+    std::shared_ptr<TextureBakeRegistry> _registry;
+    bool _ownsSharedBake { false };
+    bool _waitsForSharedBake { false };
+    TextureBakeRegistry::BakedTexture _sharedTexture;
+
     static bool _compressionEnabled;
+    static std::shared_ptr<TextureBakeRegistry> _bakeRegistry;
 };
 
 #endif // hifi_TextureBaker_h
@@ -0,0 +1,249 @@
+//
+//  BakeCache.cpp
+//  libraries/baking/src/baking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QUuid>
+
+#include "../ModelBakingLoggingCategory.h"
+
+const int BakeCache::CURRENT_VERSION = 1;
+const QString BakeCache::MANIFEST_FILENAME = "manifest.json";
+const QString BakeCache::BASE_NAME_PLACEHOLDER = "{base}";
+const qint64 BakeCache::DEFAULT_MAX_SIZE = 10LL * 1024 * 1024 * 1024; // 10GB
+
+static const QString VERSION_KEY = "version";
+static const QString SIZE_KEY = "size";
+static const QString FILES_KEY = "files";
+static const QString METADATA_KEY = "metadata";
+static const QString DEPENDENCIES_KEY = "dependencies";
+static const QString PATH_KEY = "path";
+static const QString HASH_KEY = "hash";
+
+static const QString TEMPORARY_ENTRY_SUFFIX = ".tmp";
+static const qint64 STALE_TEMPORARY_ENTRY_AGE_SECS = 24 * 60 * 60;
+
+BakeCache::BakeCache(const QString& directory) :
+    _directory(directory)
+{
+    if (!_directory.exists() && !QDir().mkpath(_directory.absolutePath())) {
+        qCWarning(model_baking) << "Could not create bake cache folder" << _directory.absolutePath();
+    }
+}
+
+QString BakeCache::makeKey(const QString& bakerType, int bakerVersion, const QByteArray& options, const QByteArray& source) {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    // hash the size of each variable length part along with it, so that no two inputs can run together
+    auto addPart = [&](const QByteArray& part) {
+        int size = part.size();
+        hasher.addData((const char*)&size, sizeof(size));
+        hasher.addData(part);
+    };
+    addPart(bakerType.toUtf8());
+    hasher.addData((const char*)&bakerVersion, sizeof(bakerVersion));
+    addPart(options);
+    addPart(source);
+    return hasher.result().toHex();
+}
+
+QString BakeCache::hashFile(const QString& path) {
+    QFile file { path };
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    if (!hasher.addData(&file)) {
+        return QString();
+    }
+    return hasher.result().toHex();
+}
+
+bool BakeCache::restore(const QString& key, const QDir& outputDirectory, const QString& baseName, Artifact& artifact) {
+    QDir entryDirectory { _directory.absoluteFilePath(key) };
+    QFile manifestFile { entryDirectory.absoluteFilePath(MANIFEST_FILENAME) };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    auto manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+    if (manifest[VERSION_KEY].toInt() != CURRENT_VERSION) {
+        return false;
+    }
+
+    Artifact restoredArtifact;
+    for (const auto& dependencyValue : manifest[DEPENDENCIES_KEY].toArray()) {
+        auto dependency = dependencyValue.toObject();
+        auto path = dependency[PATH_KEY].toString();
+        if (hashFile(path) != dependency[HASH_KEY].toString()) {
+            qCDebug(model_baking) << "Bake cache entry" << key << "is out of date:" << path << "has changed";
+            return false;
+        }
+        restoredArtifact.dependencies.push_back(path);
+    }
+
+    auto files = manifest[FILES_KEY].toArray();
+    for (int i = 0; i < files.size(); ++i) {
+        auto relativePath = files[i].toString();
+        if (relativePath.startsWith(BASE_NAME_PLACEHOLDER)) {
+            relativePath = baseName + relativePath.mid(BASE_NAME_PLACEHOLDER.length());
+        }
+
+        auto outputPath = outputDirectory.absoluteFilePath(relativePath);
+        QDir().mkpath(QFileInfo(outputPath).absolutePath());
+        QFile::remove(outputPath);
+        if (!QFile::copy(entryDirectory.absoluteFilePath(QString::number(i)), outputPath)) {
+            qCWarning(model_baking) << "Could not restore" << outputPath << "from bake cache entry" << key;
+            return false;
+        }
+        restoredArtifact.files.push_back(relativePath);
+    }
+    restoredArtifact.metadata = manifest[METADATA_KEY].toObject();
+
+    // the modification time of the manifest tracks when each entry was last used, for trim()
+    manifestFile.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+
+    artifact = restoredArtifact;
+    ++_numRestored;
+    return true;
+}
+
+bool BakeCache::store(const QString& key, const QDir& outputDirectory, const QString& baseName, const Artifact& artifact) {
+    auto makeTemporaryName = [&] {
+        return key + "." + QUuid::createUuid().toString().mid(1, 36) + TEMPORARY_ENTRY_SUFFIX;
+    };
+
+    if (_directory.exists(key)) {
+        // the entry is out of date, since restore() would have used it otherwise; move it aside before removing it
+        // so that no other oven restores it half deleted
+        auto outdatedName = makeTemporaryName();
+        if (_directory.rename(key, outdatedName)) {
+            QDir(_directory.absoluteFilePath(outdatedName)).removeRecursively();
+        }
+    }
+
+    auto temporaryName = makeTemporaryName();
+    if (!_directory.mkpath(temporaryName)) {
+        qCWarning(model_baking) << "Could not create bake cache entry" << key;
+        return false;
+    }
+    QDir temporaryDirectory { _directory.absoluteFilePath(temporaryName) };
+    auto discard = [&] {
+        temporaryDirectory.removeRecursively();
+        return false;
+    };
+
+    QJsonArray dependencies;
+    for (const auto& path : artifact.dependencies) {
+        auto hash = hashFile(path);
+        if (hash.isEmpty()) {
+            return discard();
+        }
+        QJsonObject dependency;
+        dependency[PATH_KEY] = path;
+        dependency[HASH_KEY] = hash;
+        dependencies.push_back(dependency);
+    }
+
+    QJsonArray files;
+    qint64 size = 0;
+    for (int i = 0; i < artifact.files.size(); ++i) {
+        auto relativePath = artifact.files[i];
+        auto outputPath = outputDirectory.absoluteFilePath(relativePath);
+        if (!QFile::copy(outputPath, temporaryDirectory.absoluteFilePath(QString::number(i)))) {
+            qCWarning(model_baking) << "Could not save" << outputPath << "to bake cache entry" << key;
+            return discard();
+        }
+        size += QFileInfo(outputPath).size();
+
+        if (!baseName.isEmpty() && relativePath.startsWith(baseName)) {
+            relativePath = BASE_NAME_PLACEHOLDER + relativePath.mid(baseName.length());
+        }
+        files.push_back(relativePath);
+    }
+
+    QJsonObject manifest;
+    manifest[VERSION_KEY] = CURRENT_VERSION;
+    manifest[SIZE_KEY] = (double)size;
+    manifest[FILES_KEY] = files;
+    manifest[METADATA_KEY] = artifact.metadata;
+    manifest[DEPENDENCIES_KEY] = dependencies;
+
+    QFile manifestFile { temporaryDirectory.absoluteFilePath(MANIFEST_FILENAME) };
+    if (!manifestFile.open(QIODevice::WriteOnly) || manifestFile.write(QJsonDocument(manifest).toJson(QJsonDocument::Compact)) == -1) {
+        return discard();
+    }
+    manifestFile.close();
+
+    // another oven may have stored the same entry in the meantime, in which case we keep theirs
+    if (!_directory.rename(temporaryName, key)) {
+        discard();
+        return _directory.exists(key);
+    }
+
+    ++_numStored;
+    return true;
+}
+
+void BakeCache::trim(qint64 maxSize) {
+    struct Entry {
+        QString name;
+        qint64 size;
+        QDateTime lastUsed;
+    };
+    std::vector<Entry> entries;
+
+    auto now = QDateTime::currentDateTimeUtc();
+    for (const auto& info : _directory.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+        QDir entryDirectory { info.absoluteFilePath() };
+        if (info.fileName().endsWith(TEMPORARY_ENTRY_SUFFIX)) {
+            // left behind by an oven that didn't get to finish storing it
+            if (info.lastModified().secsTo(now) > STALE_TEMPORARY_ENTRY_AGE_SECS) {
+                entryDirectory.removeRecursively();
+            }
+            continue;
+        }
+
+        QFile manifestFile { entryDirectory.absoluteFilePath(MANIFEST_FILENAME) };
+        QJsonObject manifest;
+        if (manifestFile.open(QIODevice::ReadOnly)) {
+            manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+        }
+        if (manifest[VERSION_KEY].toInt() != CURRENT_VERSION) {
+            entryDirectory.removeRecursively();
+            continue;
+        }
+        entries.push_back({ info.fileName(), (qint64)manifest[SIZE_KEY].toDouble(), QFileInfo(manifestFile).lastModified() });
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.lastUsed > b.lastUsed;
+    });
+
+    qint64 size = 0;
+    int numRemoved = 0;
+    for (const auto& entry : entries) {
+        size += entry.size;
+        if (size > maxSize) {
+            QDir(_directory.absoluteFilePath(entry.name)).removeRecursively();
+            ++numRemoved;
+        }
+    }
+    if (numRemoved > 0) {
+        qCDebug(model_baking) << "Removed" << numRemoved << "least recently used entries from the bake cache";
+    }
+}
@@ -0,0 +1,72 @@
+//
+//  BakeCache.h
+//  libraries/baking/src/baking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeCache_h
+#define hifi_BakeCache_h
+
+#include <atomic>
+
+#include <QtCore/QDir>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+
+// Persistent store of bake artifacts, so that re-running a bake whose source and settings are unchanged copies the
+// previous results into place instead of redoing the work. Entries are keyed by makeKey(), which covers the baker type,
+// the baker version, the bake options and the source content. Each entry also remembers the hashes of the local files
+// the bake read besides its source, such as the textures of a material, and is ignored once any of them has changed.
+//
+// Every entry is a directory holding a manifest and a copy of each output file, written under a temporary name and then
+// renamed into place, so several ovens may share one cache. All methods may be called from any thread.
+class BakeCache {
+public:
+    // Whenever a change is made to the layout of the entries that isn't backward compatible, this value should be
+    // incremented. Entries of other versions are ignored and eventually trimmed.
+    static const int CURRENT_VERSION;
+    static const QString MANIFEST_FILENAME;
+
+    // Output paths that start with the base name passed to store() are saved with this in its place, and restore()
+    // replaces it with its own base name, so that bakes of the same content under another name can share an entry
+    static const QString BASE_NAME_PLACEHOLDER;
+
+    static const qint64 DEFAULT_MAX_SIZE;
+
+    struct Artifact {
+        QStringList files; // relative to the output directory
+        QJsonObject metadata;
+        QStringList dependencies; // absolute paths of the local files the bake read besides its source
+    };
+
+    BakeCache(const QString& directory);
+
+    QString getDirectory() const { return _directory.absolutePath(); }
+
+    static QString makeKey(const QString& bakerType, int bakerVersion, const QByteArray& options, const QByteArray& source);
+
+    /// \return true and fill artifact with the files copied into outputDirectory when the cache has an up to date entry for key
+    bool restore(const QString& key, const QDir& outputDirectory, const QString& baseName, Artifact& artifact);
+
+    /// Saves a copy of the files of artifact, read from outputDirectory, along with its metadata and the current state of its dependencies
+    bool store(const QString& key, const QDir& outputDirectory, const QString& baseName, const Artifact& artifact);
+
+    /// Removes the least recently used entries until the cache holds no more than maxSize bytes
+    void trim(qint64 maxSize = DEFAULT_MAX_SIZE);
+
+    int getNumRestored() const { return _numRestored.load(); }
+    int getNumStored() const { return _numStored.load(); }
+
+private:
+    static QString hashFile(const QString& path);
+
+    QDir _directory;
+    std::atomic<int> _numRestored { 0 };
+    std::atomic<int> _numStored { 0 };
+};
+
+#endif // hifi_BakeCache_h
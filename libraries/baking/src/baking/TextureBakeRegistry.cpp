@@ -0,0 +1,77 @@
+//
+//  TextureBakeRegistry.cpp
+//  libraries/baking/src/baking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureBakeRegistry.h"
+
+#include <algorithm>
+
+bool TextureBakeRegistry::claim(const std::string& hash, const void* claimant, Handler handler) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(hash);
+    if (it == _entries.end()) {
+        _entries[hash];
+        return true;
+    }
+
+    auto& entry = it->second;
+    if (entry.isFinished) {
+        ++_numSharedTextures;
+        handler(entry.bakedTexture);
+    } else {
+        entry.waiting.emplace_back(claimant, std::move(handler));
+    }
+    return false;
+}
+
+void TextureBakeRegistry::finish(const std::string& hash, const BakedTexture& bakedTexture) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(hash);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    auto waiting = std::move(it->second.waiting);
+    if (bakedTexture.succeeded) {
+        ++_numBakedTextures;
+        _numSharedTextures += (int)waiting.size();
+        it->second.isFinished = true;
+        it->second.bakedTexture = bakedTexture;
+    } else {
+        // a failed or aborted bake isn't remembered: whoever asks next gets to try again
+        _entries.erase(it);
+    }
+
+    for (auto& claimantAndHandler : waiting) {
+        claimantAndHandler.second(bakedTexture);
+    }
+}
+
+void TextureBakeRegistry::release(const std::string& hash, const void* claimant) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(hash);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    auto& waiting = it->second.waiting;
+    waiting.erase(std::remove_if(waiting.begin(), waiting.end(), [&](const std::pair<const void*, Handler>& claimantAndHandler) {
+        return claimantAndHandler.first == claimant;
+    }), waiting.end());
+}
+
+int TextureBakeRegistry::getNumBakedTextures() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numBakedTextures;
+}
+
+int TextureBakeRegistry::getNumSharedTextures() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numSharedTextures;
+}
@@ -0,0 +1,63 @@
+//
+//  TextureBakeRegistry.h
+//  libraries/baking/src/baking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TextureBakeRegistry_h
+#define hifi_TextureBakeRegistry_h
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QDir>
+
+#include <TextureMeta.h>
+
+// Lets the TextureBakers of a bake share the work for sources with identical content, so that a texture used by many
+// models is processed once and copied into place for the others. Bakes are keyed by the source hash TextureBaker already
+// writes into its KTX files, which covers the source content and the usage type.
+// All methods may be called from any thread.
+class TextureBakeRegistry {
+public:
+    struct BakedTexture {
+        bool succeeded { false };
+        QDir outputDirectory;
+        QString baseFilename; // every file name in meta starts with this
+        TextureMeta meta;
+    };
+    using Handler = std::function<void(const BakedTexture&)>;
+
+    /// \return true when nobody has claimed hash yet, in which case the caller bakes the texture and calls finish().
+    /// Otherwise handler is called with the result of the claiming bake: right away when that bake is done already,
+    /// or later from the thread that calls finish(). Handlers run under the registry lock and must not call back into it.
+    bool claim(const std::string& hash, const void* claimant, Handler handler);
+    void finish(const std::string& hash, const BakedTexture& bakedTexture);
+
+    /// Drops the handler claimant passed to claim(), for claimants that go away before it is called
+    void release(const std::string& hash, const void* claimant);
+
+    int getNumBakedTextures() const;
+    int getNumSharedTextures() const;
+
+private:
+    struct Entry {
+        bool isFinished { false };
+        BakedTexture bakedTexture;
+        std::vector<std::pair<const void*, Handler>> waiting;
+    };
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    int _numBakedTextures { 0 };
+    int _numSharedTextures { 0 };
+};
+
+#endif // hifi_TextureBakeRegistry_h
@@ -328,6 +328,7 @@ void EntityRenderer::updateInScene(const ScenePointer& scene, Transaction& trans
     }
 
     doRenderUpdateSynchronous(scene, transaction, _entity);
+    // Stays serial: doRenderUpdateAsynchronous reads the entity under its locks and reaches shared caches and materials.
     transaction.updateItem<PayloadProxyInterface>(_renderItemID, [this](PayloadProxyInterface& self) {
         if (!isValidRenderItem()) {
             return;
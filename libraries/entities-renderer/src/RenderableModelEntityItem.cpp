@@ -336,7 +336,8 @@ bool RenderableModelEntityItem::isReadyToComputeShape() const {
                 const_cast<RenderableModelEntityItem*>(this)->fetchCollisionGeometryResource();
             }
 
-            if (_collisionGeometryResource && _collisionGeometryResource->isLoaded()) {
+            if (_collisionGeometryResource && _collisionGeometryResource->isLoaded() &&
+                !_collisionGeometryResource->isRefining()) {
                 // we have both URLs AND both geometries AND they are both fully loaded.
                 if (_needsInitialSimulation) {
                     // the _model's offset will be wrong until _needsInitialSimulation is false
@@ -350,7 +351,9 @@ bool RenderableModelEntityItem::isReadyToComputeShape() const {
         // the model is still being downloaded.
         return false;
     } else if (type >= SHAPE_TYPE_SIMPLE_HULL && type <= SHAPE_TYPE_STATIC_MESH) {
-        return isModelLoaded();
+        // these shapes are built from the render geometry, so wait for the finest LOD of a progressive model
+        // rather than build them from a coarse one which would stay
+        return isModelLoaded() && !model->isRefining();
     }
     return true;
 }
@@ -1285,6 +1288,8 @@ void ModelEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& sce
 
     // Nothing else to do unless the model is loaded
     if (!model->isLoaded()) {
+        // follow the entity as it moves relative to the avatar, so that the work left to load it is ordered accordingly
+        model->setLoadingPriority(EntityTreeRenderer::getEntityLoadingPriority(*entity));
         withWriteLock([&] {
             _prevModelLoaded = false;
         });
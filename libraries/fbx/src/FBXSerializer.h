@@ -122,8 +122,15 @@ public:
     /// \exception QString if an error occurs in parsing
     HFMModel::Pointer read(const hifi::ByteArray& data, const hifi::VariantHash& mapping, const hifi::URL& url = hifi::URL()) override;
 
+    /// Reads HFMModel from the FBX file at path, parsing a memory mapping of the file rather than a copy of it.
+    /// \exception QString if an error occurs in opening or parsing
+    HFMModel::Pointer readFile(const QString& path, const hifi::VariantHash& mapping);
+
     FBXNode _rootNode;
     static FBXNode parseFBX(QIODevice* device);
+    /// Parses a binary FBX document in place; text documents go through the QIODevice parser.
+    static FBXNode parseFBX(const hifi::ByteArray& data);
+    static FBXNode parseFBXFile(const QString& path);
 
     HFMModel* extractHFMModel(const hifi::VariantHash& mapping, const QString& url);
 
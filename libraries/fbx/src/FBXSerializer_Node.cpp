@@ -11,199 +11,170 @@
 
 #include "FBXSerializer.h"
 
+#include <algorithm>
 #include <iostream>
 #include <QtCore/QBuffer>
-#include <QtCore/QDataStream>
+#include <QtCore/QFile>
 #include <QtCore/QIODevice>
 #include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 #include <QtCore/QDebug>
-#include <QtCore/QtEndian>
 #include <QtCore/QFileInfo>
 
+#include <zlib.h>
+
 #include <shared/NsightHelpers.h>
 #include <hfm/ModelFormatLogging.h>
 
-template<class T>
-int streamSize() {
-    return sizeof(T);
+// Walks the records of a binary FBX document in place, without going through a QDataStream.
+// Scalars are read straight out of the buffer and each array is copied, or inflated, exactly once
+// into the storage of the QVector that ends up in the FBXNode.
+//
+// TODO: this still builds the whole FBXNode tree, with a QVariantList of properties per record, because
+// FBXSerializer::extractHFMModel consumes that tree.  Parsing the geometry arrays (Vertices, PolygonVertexIndex,
+// Normals, UV, ...) and the Connections "C" records straight into typed structures for extractHFMModel would save
+// the per-record QVariant allocations too, and needs the extraction code to read those structures instead of the tree.
+class BinaryFBXReader {
+public:
+    BinaryFBXReader(const char* data, size_t size) : _data(data), _size(size) { }
+
+    bool atEnd() const { return _position >= _size; }
+    void skip(size_t length) { take(length); }
+    void setHas64BitPositions(bool has64BitPositions) { _has64BitPositions = has64BitPositions; }
+
+    template<class T>
+    T read() {
+        T value;
+        memcpy(&value, take(sizeof(T)), sizeof(T));
+        toHostByteOrder(&value, 1);
+        return value;
+    }
+
+    FBXNode readNode();
+
+private:
+    const char* take(size_t length);
+
+    template<class T>
+    static void toHostByteOrder(T* values, size_t count);
+
+    template<class T>
+    QVariant readArray();
+    QVariant readProperty();
+
+    const char* _data;
+    size_t _size;
+    size_t _position { 0 };
+    bool _has64BitPositions { false };
+};
+
+const char* BinaryFBXReader::take(size_t length) {
+    if (length > _size - _position) {
+        throw QString("FBX file most likely corrupt: unexpected end of data");
+    }
+    const char* bytes = _data + _position;
+    _position += length;
+    return bytes;
 }
 
-template<bool>
-int streamSize() {
-    return 1;
+template<class T>
+void BinaryFBXReader::toHostByteOrder(T* values, size_t count) {
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    for (size_t i = 0; i < count; i++) {
+        char* bytes = reinterpret_cast<char*>(values + i);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+#else
+    Q_UNUSED(values);
+    Q_UNUSED(count);
+#endif
 }
 
 template<class T>
-QVariant readBinaryArray(QDataStream& in, int& position) {
-    quint32 arrayLength;
-    quint32 encoding;
-    quint32 compressedLength;
+QVariant BinaryFBXReader::readArray() {
+    static_assert(std::is_arithmetic<T>::value, "FBX arrays hold plain numbers");
+    static_assert(sizeof(bool) == 1, "FBX stores one byte per bool");
 
-    in >> arrayLength;
+    quint32 arrayLength = read<quint32>();
     if (arrayLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: binary data exceeds data limits");
     }
-    in >> encoding;
-    in >> compressedLength;
+    quint32 encoding = read<quint32>();
+    quint32 compressedLength = read<quint32>();
     if (compressedLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: compressed binary data exceeds data limits");
     }
-    position += sizeof(quint32) * 3;
-
-    QVector<T> values;
-    if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
-        values.resize(arrayLength);
-        hifi::ByteArray arrayData;
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            arrayData = qUncompress(compressed);
-            if (arrayData.isEmpty() ||
-                (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-        } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
-        }
 
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
-        }
-    } else {
-        values.reserve(arrayLength);
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            hifi::ByteArray uncompressed = qUncompress(compressed);
-            if (uncompressed.isEmpty()) { // answers empty byte array if corrupt
+    QVector<T> values((int)arrayLength);
+    size_t byteLength = sizeof(T) * arrayLength;
+    if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
+        const char* compressed = take(compressedLength);
+        if (byteLength > 0) {
+            // inflate straight into the array rather than into a temporary buffer
+            uLongf inflatedLength = (uLongf)byteLength;
+            int status = uncompress(reinterpret_cast<Bytef*>(values.data()), &inflatedLength,
+                reinterpret_cast<const Bytef*>(compressed), (uLong)compressedLength);
+            if (status != Z_OK || inflatedLength != byteLength) {
                 throw QString("corrupt fbx file");
             }
-            QDataStream uncompressedIn(uncompressed);
-            uncompressedIn.setByteOrder(QDataStream::LittleEndian);
-            uncompressedIn.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                uncompressedIn >> value;
-                values.append(value);
-            }
-        } else {
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                in >> value;
-                position += streamSize<T>();
-                values.append(value);
-            }
         }
+    } else if (byteLength > 0) {
+        memcpy(values.data(), take(byteLength), byteLength);
     }
+    toHostByteOrder(values.data(), arrayLength);
     return QVariant::fromValue(values);
 }
 
-QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
-    char ch;
-    in.device()->getChar(&ch);
-    position++;
+QVariant BinaryFBXReader::readProperty() {
+    char ch = *take(1);
     switch (ch) {
-        case 'Y': {
-            qint16 value;
-            in >> value;
-            position += sizeof(qint16);
-            return QVariant::fromValue(value);
-        }
-        case 'C': {
-            bool value;
-            in >> value;
-            position++;
-            return QVariant::fromValue(value);
-        }
-        case 'I': {
-            qint32 value;
-            in >> value;
-            position += sizeof(qint32);
-            return QVariant::fromValue(value);
-        }
-        case 'F': {
-            float value;
-            in >> value;
-            position += sizeof(float);
-            return QVariant::fromValue(value);
-        }
-        case 'D': {
-            double value;
-            in >> value;
-            position += sizeof(double);
-            return QVariant::fromValue(value);
-        }
-        case 'L': {
-            qint64 value;
-            in >> value;
-            position += sizeof(qint64);
-            return QVariant::fromValue(value);
-        }
-        case 'f': {
-            return readBinaryArray<float>(in, position);
-        }
-        case 'd': {
-            return readBinaryArray<double>(in, position);
-        }
-        case 'l': {
-            return readBinaryArray<qint64>(in, position);
-        }
-        case 'i': {
-            return readBinaryArray<qint32>(in, position);
-        }
-        case 'b': {
-            return readBinaryArray<bool>(in, position);
-        }
+        case 'Y':
+            return QVariant::fromValue(read<qint16>());
+        case 'C':
+            return QVariant::fromValue(read<quint8>() != 0);
+        case 'I':
+            return QVariant::fromValue(read<qint32>());
+        case 'F':
+            return QVariant::fromValue(read<float>());
+        case 'D':
+            return QVariant::fromValue(read<double>());
+        case 'L':
+            return QVariant::fromValue(read<qint64>());
+        case 'f':
+            return readArray<float>();
+        case 'd':
+            return readArray<double>();
+        case 'l':
+            return readArray<qint64>();
+        case 'i':
+            return readArray<qint32>();
+        case 'b':
+            return readArray<bool>();
         case 'S':
         case 'R': {
-            quint32 length;
-            in >> length;
-            position += sizeof(quint32) + length;
-            return QVariant::fromValue(in.device()->read(length));
+            quint32 length = read<quint32>();
+            return QVariant::fromValue(hifi::ByteArray(take(length), (int)length));
         }
         default:
             throw QString("Unknown property type: ") + ch;
     }
 }
 
-FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPositions = false) {
+FBXNode BinaryFBXReader::readNode() {
     qint64 endOffset;
     quint64 propertyCount;
-    quint64 propertyListLength;
-    quint8 nameLength;
 
     // FBX 2016 and beyond uses 64bit positions in the node headers, pre-2016 used 32bit values
-    // our code generally doesn't care about the size that much, so we will use 64bit values
-    // from here on out, but if the file is an older format we read the stream into temp 32bit 
-    // values and then assign to our actual 64bit values.
-    if (has64BitPositions) {
-        in >> endOffset;
-        in >> propertyCount;
-        in >> propertyListLength;
-        position += sizeof(quint64) * 3;
+    if (_has64BitPositions) {
+        endOffset = read<qint64>();
+        propertyCount = read<quint64>();
+        read<quint64>(); // property list length
     } else {
-        qint32 tempEndOffset;
-        quint32 tempPropertyCount;
-        quint32 tempPropertyListLength;
-        in >> tempEndOffset;
-        in >> tempPropertyCount;
-        in >> tempPropertyListLength;
-        position += sizeof(quint32) * 3;
-        endOffset = tempEndOffset;
-        propertyCount = tempPropertyCount;
-        propertyListLength = tempPropertyListLength;
-    }
-    in >> nameLength;
-    position += sizeof(quint8);
+        endOffset = read<qint32>();
+        propertyCount = read<quint32>();
+        read<quint32>(); // property list length
+    }
+    quint8 nameLength = read<quint8>();
 
     FBXNode node;
     const int MIN_VALID_OFFSET = 40;
@@ -211,15 +182,19 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
         // use a null name to indicate a null node
         return node;
     }
-    node.name = in.device()->read(nameLength);
-    position += nameLength;
+    if ((quint64)endOffset > _size) {
+        throw QString("FBX file most likely corrupt: node extends past the end of the data");
+    }
+    node.name = hifi::ByteArray(take(nameLength), nameLength);
 
-    for (quint32 i = 0; i < propertyCount; i++) {
-        node.properties.append(parseBinaryFBXProperty(in, position));
+    // every property takes at least its type byte, which bounds the reservation on corrupt files
+    node.properties.reserve((int)std::min<quint64>(propertyCount, _size - _position));
+    for (quint64 i = 0; i < propertyCount; i++) {
+        node.properties.append(readProperty());
     }
 
-    while (endOffset > position) {
-        FBXNode child = parseBinaryFBXNode(in, position, has64BitPositions);
+    while ((quint64)endOffset > _position) {
+        FBXNode child = readNode();
         if (!child.name.isNull()) {
             node.children.append(child);
         }
@@ -352,26 +327,34 @@ FBXNode parseTextFBXNode(Tokenizer& tokenizer) {
 }
 
 FBXNode FBXSerializer::parseFBX(QIODevice* device) {
-    PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xff0000ff, device);
     // verify the prolog
-    if (device->peek(FBX_BINARY_PROLOG.size()) != FBX_BINARY_PROLOG) {
-        // parse as a text file
-        FBXNode top;
-        Tokenizer tokenizer(device);
-        while (device->bytesAvailable()) {
-            FBXNode next = parseTextFBXNode(tokenizer);
-            if (next.name.isNull()) {
-                return top;
+    if (device->peek(FBX_BINARY_PROLOG.size()) == FBX_BINARY_PROLOG) {
+        return parseFBX(device->readAll());
+    }
 
-            } else {
-                top.children.append(next);
-            }
+    PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xff0000ff, device);
+    // parse as a text file
+    FBXNode top;
+    Tokenizer tokenizer(device);
+    while (device->bytesAvailable()) {
+        FBXNode next = parseTextFBXNode(tokenizer);
+        if (next.name.isNull()) {
+            return top;
+
+        } else {
+            top.children.append(next);
         }
-        return top;
     }
-    QDataStream in(device);
-    in.setByteOrder(QDataStream::LittleEndian);
-    in.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
+    return top;
+}
+
+FBXNode FBXSerializer::parseFBX(const hifi::ByteArray& data) {
+    if (!data.startsWith(FBX_BINARY_PROLOG)) {
+        QBuffer buffer(const_cast<hifi::ByteArray*>(&data));
+        buffer.open(QIODevice::ReadOnly);
+        return parseFBX(&buffer);
+    }
+    PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xff0000ff, data.size());
 
     // see http://code.blender.org/index.php/2013/08/fbx-binary-file-format-specification/ for an explanation
     // of the FBX binary format
@@ -380,17 +363,15 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
     //   Bytes 0 - 20: Kaydara FBX Binary  \x00(file - magic, with 2 spaces at the end, then a NULL terminator).
     //   Bytes 21 - 22: [0x1A, 0x00](unknown but all observed files show these bytes).
     //   Bytes 23 - 26 : unsigned int, the version number. 7300 for version 7.3 for example.
-    in.skipRawData(FBX_HEADER_BYTES_BEFORE_VERSION);
-    int position = FBX_HEADER_BYTES_BEFORE_VERSION;
-    quint32 fileVersion;
-    in >> fileVersion;
-    position += sizeof(fileVersion);
-    bool has64BitPositions = (fileVersion >= FBX_VERSION_2016);
+    BinaryFBXReader reader(data.constData(), (size_t)data.size());
+    reader.skip(FBX_HEADER_BYTES_BEFORE_VERSION);
+    quint32 fileVersion = reader.read<quint32>();
+    reader.setHas64BitPositions(fileVersion >= FBX_VERSION_2016);
 
     // parse the top-level node
     FBXNode top;
-    while (device->bytesAvailable()) {
-        FBXNode next = parseBinaryFBXNode(in, position, has64BitPositions);
+    while (!reader.atEnd()) {
+        FBXNode next = reader.readNode();
         if (next.name.isNull()) {
             return top;
 
@@ -402,6 +383,19 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
     return top;
 }
 
+FBXNode FBXSerializer::parseFBXFile(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw QString("unable to open FBX file: ") + path;
+    }
+    // the parser copies everything it keeps out of the data, so the mapping only has to outlive this call
+    uchar* mapped = file.map(0, file.size());
+    if (!mapped) {
+        return parseFBX(file.readAll());
+    }
+    return parseFBX(hifi::ByteArray::fromRawData(reinterpret_cast<const char*>(mapped), (int)file.size()));
+}
+
 
 glm::vec3 FBXSerializer::getVec3(const QVariantList& properties, int index) {
     return glm::vec3(properties.at(index).value<double>(), properties.at(index + 1).value<double>(),
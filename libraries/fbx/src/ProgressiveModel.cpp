@@ -0,0 +1,95 @@
+//
+//  ProgressiveModel.cpp
+//  libraries/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ProgressiveModel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <QtCore/QDataStream>
+
+static const QByteArray MAGIC { "HIFIPFBX" };
+
+const int ProgressiveModel::VERSION = 1;
+const int ProgressiveModel::MAX_CHUNKS = 8;
+const int ProgressiveModel::HEADER_SIZE = 8 + 2 * sizeof(quint32) + MAX_CHUNKS * 2 * sizeof(quint64);
+
+bool ProgressiveModel::isProgressiveModelURL(const QUrl& url) {
+    return url.path().toLower().endsWith(PROGRESSIVE_MODEL_EXTENSION);
+}
+
+QUrl ProgressiveModel::getChunkURL(const QUrl& url) {
+    auto chunkURL = url;
+    auto path = url.path();
+    path.chop(PROGRESSIVE_MODEL_EXTENSION.length());
+    chunkURL.setPath(path + ".fbx");
+    return chunkURL;
+}
+
+QByteArray ProgressiveModel::write(const std::vector<QByteArray>& chunks) {
+    if (chunks.empty() || (int)chunks.size() > MAX_CHUNKS ||
+        std::any_of(chunks.cbegin(), chunks.cend(), [](const QByteArray& chunk) { return chunk.isEmpty(); })) {
+        return QByteArray();
+    }
+
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData(MAGIC.constData(), MAGIC.size());
+    stream << (quint32)VERSION << (quint32)chunks.size();
+
+    quint64 offset = HEADER_SIZE;
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        if (i < (int)chunks.size()) {
+            quint64 size = chunks[i].size();
+            stream << offset << size;
+            offset += size;
+        } else {
+            stream << (quint64)0 << (quint64)0;
+        }
+    }
+    for (const auto& chunk : chunks) {
+        stream.writeRawData(chunk.constData(), chunk.size());
+    }
+    return data;
+}
+
+bool ProgressiveModel::readHeader(const QByteArray& data, std::vector<Chunk>& chunks) {
+    if (data.size() < HEADER_SIZE || !data.startsWith(MAGIC)) {
+        return false;
+    }
+
+    QDataStream stream(data);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.skipRawData(MAGIC.size());
+    quint32 version;
+    quint32 numChunks;
+    stream >> version >> numChunks;
+    if (version != (quint32)VERSION || numChunks == 0 || numChunks > (quint32)MAX_CHUNKS) {
+        return false;
+    }
+
+    std::vector<Chunk> readChunks;
+    qint64 end = HEADER_SIZE;
+    for (quint32 i = 0; i < numChunks; i++) {
+        quint64 offset;
+        quint64 size;
+        stream >> offset >> size;
+        // chunks are stored back to back, in order
+        if ((qint64)offset != end || size == 0 || size > (quint64)std::numeric_limits<int>::max()) {
+            return false;
+        }
+        readChunks.push_back({ (qint64)offset, (qint64)size });
+        end += size;
+    }
+
+    chunks = readChunks;
+    return true;
+}
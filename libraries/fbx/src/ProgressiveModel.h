@@ -0,0 +1,50 @@
+//
+//  ProgressiveModel.h
+//  libraries/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ProgressiveModel_h
+#define hifi_ProgressiveModel_h
+
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUrl>
+
+static const QString PROGRESSIVE_MODEL_EXTENSION { ".pfbx" };
+
+// A progressive model holds a sequence of baked FBX files of the same model, from its coarsest LOD to its full detail,
+// which only differ in their DracoMesh nodes. Each file is a chunk which can be loaded by itself, so that a client can show
+// the first chunk while the rest are still downloading.
+//
+// The file starts with a fixed size header, so that it can be read with a single ranged request:
+//     char magic[8], uint32 version, uint32 number of chunks, then for each of MAX_CHUNKS: uint64 offset, uint64 size
+// with all values little endian and the unused chunk entries set to zero. The chunks follow the header, in order.
+class ProgressiveModel {
+public:
+    struct Chunk {
+        qint64 offset { 0 };
+        qint64 size { 0 };
+    };
+
+    static const int VERSION;
+    static const int MAX_CHUNKS;
+    static const int HEADER_SIZE;
+
+    static bool isProgressiveModelURL(const QUrl& url);
+
+    /// \return the URL of a chunk of the progressive model at url, so that serializers recognize it as an FBX file
+    static QUrl getChunkURL(const QUrl& url);
+
+    static QByteArray write(const std::vector<QByteArray>& chunks);
+
+    /// Reads the chunk table from data, which should start with at least HEADER_SIZE bytes of a progressive model
+    static bool readHeader(const QByteArray& data, std::vector<Chunk>& chunks);
+};
+
+#endif // hifi_ProgressiveModel_h
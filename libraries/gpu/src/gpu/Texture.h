@@ -11,6 +11,7 @@
 #ifndef hifi_gpu_Texture_h
 #define hifi_gpu_Texture_h
 
+#include <atomic>
 #include <algorithm> //min max and more
 #include <bitset>
 
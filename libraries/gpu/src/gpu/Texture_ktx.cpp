@@ -13,6 +13,7 @@
 #include "Texture.h"
 
 #include <QtCore/QByteArray>
+#include <QtCore/QProcessEnvironment>
 
 #include <ktx/KTX.h>
 
@@ -25,6 +26,9 @@ using KtxStorage = Texture::KtxStorage;
 
 std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> KtxStorage::_cachedKtxFiles;
 std::mutex KtxStorage::_cachedKtxFilesMutex;
+// getMipFace() pages the mip in from the mapped KTX file and returns a view on the mapping, which keeps the file mapped
+// until the view is released, instead of a copy of the mip in memory, unless HIFI_DISABLE_MAPPED_KTX_MIPS is set
+static const bool ENABLE_MAPPED_MIPS { !QProcessEnvironment::systemEnvironment().contains("HIFI_DISABLE_MAPPED_KTX_MIPS") };
 
 struct GPUKTXPayload {
     using Version = uint8;
@@ -269,6 +273,14 @@ PixelsPointer KtxStorage::getMipFace(uint16 level, uint8 face) const {
     if (!storageView) {
         qWarning() << "Failed to get a valid storageView for faceSize=" << faceSize << "  faceOffset=" << faceOffset
                     << "out of valid file " << QString::fromStdString(_filename);
+        return PixelsPointer();
+    }
+
+    if (ENABLE_MAPPED_MIPS) {
+        // Page the mip in here, on the transfer buffering thread, so that the render thread reads it from memory;
+        // the pages belong to the file, so the OS can drop them again once the transfer is done with the view
+        storageView->touchPages();
+        return storageView;
     }
     return storageView->toMemoryStorage();
 }
@@ -11,6 +11,9 @@
 
 #include "TextureProcessing.h"
 
+#include <mutex>
+#include <thread>
+
 #include <glm/gtc/packing.hpp>
 
 #include <QtCore/QtGlobal>
@@ -23,6 +26,9 @@
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
+
+#include <tbb/task_arena.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -46,6 +52,26 @@ bool DEV_DECIMATE_TEXTURES = false;
 std::atomic<size_t> DECIMATED_TEXTURE_COUNT{ 0 };
 std::atomic<size_t> RECTIFIED_TEXTURE_COUNT{ 0 };
 
+// All the compressions run in one arena, so that textures processed at once share the budget rather than each taking it
+static std::mutex compressionArenaMutex;
+static int compressionThreadBudget { 0 };
+static std::shared_ptr<tbb::task_arena> compressionArena;
+
+void image::setCompressionThreadBudget(int numThreads) {
+    std::lock_guard<std::mutex> lock(compressionArenaMutex);
+    numThreads = std::max(numThreads, 0);
+    if (numThreads != compressionThreadBudget) {
+        compressionThreadBudget = numThreads;
+        // compressions already running keep the arena they started with
+        compressionArena.reset();
+    }
+}
+
+int image::getCompressionThreadBudget() {
+    std::lock_guard<std::mutex> lock(compressionArenaMutex);
+    return compressionThreadBudget;
+}
+
 // we use a ref here to work around static order initialization
 // possibly causing the element not to be constructed yet
 static const auto& GPU_CUBEMAP_DEFAULT_FORMAT = gpu::Element::COLOR_SRGBA_32;
@@ -501,21 +527,42 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
 };
 
 #if defined(NVTT_API)
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+static int getCompressionThreadCount() {
+    int budget = image::getCompressionThreadBudget();
+    return (budget > 0) ? budget : std::max((int)std::thread::hardware_concurrency(), 1);
+}
+
+static std::shared_ptr<tbb::task_arena> getCompressionArena() {
+    std::lock_guard<std::mutex> lock(compressionArenaMutex);
+    if (!compressionArena) {
+        int maxConcurrency = (compressionThreadBudget > 0) ? compressionThreadBudget : tbb::task_arena::automatic;
+        compressionArena = std::make_shared<tbb::task_arena>(maxConcurrency);
+    }
+    return compressionArena;
+}
+
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
+    ParallelTaskDispatcher(const std::atomic<bool>& abortProcessing = false) :
+        _abortProcessing(abortProcessing),
+        _arena(getCompressionArena()) {
     }
 
     const std::atomic<bool>& _abortProcessing;
+    std::shared_ptr<tbb::task_arena> _arena;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
-            if (!_abortProcessing.load()) {
-                task(context, i);
-            } else {
-                break;
-            }
-        }
+        // nvtt hands out one task per block row or per mip face: coarse enough for one task per range
+        _arena->execute([&] {
+            tbb::parallel_for(tbb::blocked_range<int>(0, count, 1), [&](const tbb::blocked_range<int>& range) {
+                for (int i = range.begin(); i < range.end(); i++) {
+                    if (_abortProcessing.load()) {
+                        return;
+                    }
+                    task(context, i);
+                }
+            });
+        });
     }
 };
 #endif
@@ -622,8 +669,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
-    nvtt::Compressor compressor;
+    ParallelTaskDispatcher dispatcher(abortProcessing);
     context.setTaskDispatcher(&dispatcher);
 
     context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
@@ -759,8 +805,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
-        nvtt::Compressor context;
+        ParallelTaskDispatcher dispatcher(abortProcessing);
+        nvtt::Context context;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
@@ -807,7 +854,7 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         const Etc::ErrorMetric errorMetric = Etc::ErrorMetric::RGBA;
         const float effort = 1.0f;
-        const int numEncodeThreads = 4;
+        const int numEncodeThreads = getCompressionThreadCount();
         int encodingTime;
 
         if (localCopy.getFormat() != Image::Format_RGBAF) {
@@ -121,6 +121,11 @@ gpu::TexturePointer processCubeTextureColorFromImage(Image&& srcImage, const std
 
 const QStringList getSupportedFormats();
 
+// Caps the threads block compression may use, shared by all the textures being processed at once.
+// 0, the default, lets it use every core.
+void setCompressionThreadBudget(int numThreads);
+int getCompressionThreadBudget();
+
 gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::string& url, ColorChannel sourceChannel,
                                  int maxNumPixels, TextureUsage::Type textureType,
                                  bool compress, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false);
@@ -338,6 +338,11 @@ namespace ktx {
         static std::unique_ptr<KTX> create(const Header& header, const Images& images, const KeyValues& keyValues = KeyValues());
         static std::unique_ptr<KTX> createBare(const Header& header, const KeyValues& keyValues = KeyValues());
 
+        // The layout createBare() builds in memory, for writing it straight into a mapped file instead: the images are
+        // left as they are, so a freshly zeroed file only gets the pages of the header and of the image sizes touched
+        static size_t evalBareStorageSize(const Header& header, const KeyValues& keyValues = KeyValues());
+        static size_t writeBare(Byte* destBytes, size_t destByteSize, const Header& header, const KeyValues& keyValues = KeyValues());
+
         // Instead of creating a full Copy of the src data in a KTX object, the write serialization can be performed with the
         // following two functions
         //   size_t sizeNeeded = KTX::evalStorageSize(header, images);
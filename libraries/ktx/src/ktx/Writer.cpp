@@ -40,24 +40,34 @@ namespace ktx {
         return create(storagePointer);
     }
 
-    std::unique_ptr<KTX> KTX::createBare(const Header& header, const KeyValues& keyValues) {
-        auto descriptors = header.generateImageDescriptors();
-
+    // a bare KTX starts out with none of its mips populated
+    static KeyValues getBareKeyValues(const Header& header, const KeyValues& keyValues) {
         Byte minMip = header.numberOfMipmapLevels;
         auto newKeyValues = keyValues;
         newKeyValues.emplace_back(KeyValue(HIFI_MIN_POPULATED_MIP_KEY, sizeof(Byte), &minMip));
+        return newKeyValues;
+    }
 
+    std::unique_ptr<KTX> KTX::createBare(const Header& header, const KeyValues& keyValues) {
         StoragePointer storagePointer;
         {
-            auto storageSize = ktx::KTX::evalStorageSize(header, descriptors, newKeyValues);
+            auto storageSize = evalBareStorageSize(header, keyValues);
             auto memoryStorage = new storage::MemoryStorage(storageSize);
             qDebug() << "Memory storage size is: " << storageSize;
-            ktx::KTX::writeWithoutImages(memoryStorage->data(), memoryStorage->size(), header, descriptors, newKeyValues);
+            writeBare(memoryStorage->data(), memoryStorage->size(), header, keyValues);
             storagePointer.reset(memoryStorage);
         }
         return create(storagePointer);
     }
 
+    size_t KTX::evalBareStorageSize(const Header& header, const KeyValues& keyValues) {
+        return evalStorageSize(header, header.generateImageDescriptors(), getBareKeyValues(header, keyValues));
+    }
+
+    size_t KTX::writeBare(Byte* destBytes, size_t destByteSize, const Header& header, const KeyValues& keyValues) {
+        return writeWithoutImages(destBytes, destByteSize, header, header.generateImageDescriptors(), getBareKeyValues(header, keyValues));
+    }
+
     size_t KTX::evalStorageSize(const Header& header, const Images& images, const KeyValues& keyValues) {
         size_t storageSize = sizeof(Header);
 
@@ -17,7 +17,6 @@
 
 #include <QCryptographicHash>
 #include <QImageReader>
-#include <QRunnable>
 #include <QThreadPool>
 #include <QNetworkReply>
 #include <QPainter>
@@ -47,7 +46,6 @@
 #include "MaterialNetworkingLogging.h"
 #include "NetworkingConstants.h"
 #include <Trace.h>
-#include <StatTracker.h>
 
 #include <TextureMeta.h>
 
@@ -481,12 +479,12 @@ gpu::TexturePointer NetworkTexture::getFallbackTexture() const {
     return getFallbackTextureForType(_type);
 }
 
-class ImageReader : public QRunnable {
+class ImageReader {
 public:
     ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url,
-                const QByteArray& data, size_t extraHash, int maxNumPixels,
+                const QByteArray& data, int maxNumPixels,
                 image::ColorChannel sourceChannel);
-    void run() override final;
+    void run();
     void read();
 
 private:
@@ -495,11 +493,30 @@ private:
     QWeakPointer<Resource> _resource;
     QUrl _url;
     QByteArray _content;
-    size_t _extraHash;
     int _maxNumPixels;
     image::ColorChannel _sourceChannel;
 };
 
+// Hands a processed texture over to its resource on the upload stage, where the textures of the resources with the
+// highest load priority go first
+static void scheduleSetImage(const QWeakPointer<Resource>& resource, const gpu::TexturePointer& texture, bool requestNextMipLevel) {
+    ResourceCache::schedule(ResourceScheduler::UPLOAD, resource, [resource, texture, requestNextMipLevel] {
+        auto strongResource = resource.lock();
+        if (!strongResource) {
+            return;
+        }
+
+        QMetaObject::invokeMethod(strongResource.data(), "setImage",
+            Q_ARG(gpu::TexturePointer, texture),
+            Q_ARG(int, texture->getWidth()),
+            Q_ARG(int, texture->getHeight()));
+
+        if (requestNextMipLevel) {
+            QMetaObject::invokeMethod(strongResource.data(), "startRequestForNextMipLevel");
+        }
+    });
+}
+
 NetworkTexture::~NetworkTexture() {
     if (_ktxHeaderRequest || _ktxMipRequest) {
         if (_ktxHeaderRequest) {
@@ -823,11 +840,8 @@ void NetworkTexture::ktxMipRequestFinished() {
             auto data = _ktxMipRequest->getData();
             auto mipLevel = _ktxMipLevelRangeInFlight.first;
             auto texture = _textureSource->getGPUTexture();
-            DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
-            QtConcurrent::run(QThreadPool::globalInstance(), [self, data, mipLevel, url, texture] {
+            ResourceCache::schedule(ResourceScheduler::DECODE, self, [self, data, mipLevel, url, texture] {
                 PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Mip Data", 0xffff0000, 0, { { "url", url.toString() } });
-                DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-                CounterStat counter("Processing");
 
                 auto originalPriority = QThread::currentThread()->priority();
                 if (originalPriority == QThread::InheritPriority) {
@@ -852,12 +866,7 @@ void NetworkTexture::ktxMipRequestFinished() {
                     return;
                 }
 
-                QMetaObject::invokeMethod(resource.data(), "setImage",
-                    Q_ARG(gpu::TexturePointer, texture),
-                    Q_ARG(int, texture->getWidth()),
-                    Q_ARG(int, texture->getHeight()));
-
-                QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
+                scheduleSetImage(self, texture, true);
             });
         } else {
             qWarning(networking) << "Mip request finished in an unexpected state: " << _ktxResourceState;
@@ -891,11 +900,8 @@ void NetworkTexture::handleFinishedInitialLoad() {
 
     auto self = _self;
     auto url = _url;
-    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
-    QtConcurrent::run(QThreadPool::globalInstance(), [self, ktxHeaderData, ktxHighMipData, url] {
+    ResourceCache::schedule(ResourceScheduler::DECODE, self, [self, ktxHeaderData, ktxHighMipData, url] {
         PROFILE_RANGE_EX(resource_parse_image, "NetworkTexture - Processing Initial Data", 0xffff0000, 0, { { "url", url.toString() } });
-        DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-        CounterStat counter("Processing");
 
         auto originalPriority = QThread::currentThread()->priority();
         if (originalPriority == QThread::InheritPriority) {
@@ -981,22 +987,19 @@ void NetworkTexture::handleFinishedInitialLoad() {
         }
 
         if (!texture) {
-            auto memKtx = ktx::KTX::createBare(*header, keyValues);
-            if (!memKtx) {
-                qWarning() << " Ktx could not be created, bailing";
-                QMetaObject::invokeMethod(resource.data(), "setImage",
-                    Q_ARG(gpu::TexturePointer, nullptr),
-                    Q_ARG(int, 0),
-                    Q_ARG(int, 0));
-                return;
-            }
-
-            // Move ktx to file
-            const char* data = reinterpret_cast<const char*>(memKtx->_storage->data());
-            size_t length = memKtx->_storage->size();
-            cache::FilePointer file;
+            // Write the bare ktx straight into its cache file rather than building it in memory first: it is as large as
+            // the whole texture, but only its header and the high mips below get filled in, the rest is paged in later
             auto& ktxCache = textureCache->_ktxCache;
-            if (!memKtx || !(file = ktxCache->writeFile(data, KTXCache::Metadata(filename, length)))) {
+            size_t length = ktx::KTX::evalBareStorageSize(*header, keyValues);
+            auto file = ktxCache->writeFile([&](uint8_t* data, size_t size) {
+                return ktx::KTX::writeBare(data, size, *header, keyValues) != 0;
+            }, KTXCache::Metadata(filename, length));
+
+            std::unique_ptr<ktx::KTX> bareKtx;
+            if (file) {
+                bareKtx = ktx::KTX::create(std::make_shared<storage::FileStorage>(file->getFilepath().c_str()));
+            }
+            if (!bareKtx) {
                 qCWarning(materialnetworking) << url << " failed to write cache file";
                 QMetaObject::invokeMethod(resource.data(), "setImage",
                     Q_ARG(gpu::TexturePointer, nullptr),
@@ -1005,7 +1008,8 @@ void NetworkTexture::handleFinishedInitialLoad() {
                 return;
             }
 
-            auto newKtxDescriptor = memKtx->toDescriptor();
+            auto newKtxDescriptor = bareKtx->toDescriptor();
+            bareKtx.reset();
 
             texture = gpu::Texture::build(newKtxDescriptor);
             texture->setKtxBacking(file);
@@ -1033,12 +1037,7 @@ void NetworkTexture::handleFinishedInitialLoad() {
             texture = textureCache->cacheTextureByHash(filename, texture);
         }
 
-        QMetaObject::invokeMethod(resource.data(), "setImage",
-            Q_ARG(gpu::TexturePointer, texture),
-            Q_ARG(int, texture->getWidth()),
-            Q_ARG(int, texture->getHeight()));
-
-        QMetaObject::invokeMethod(resource.data(), "startRequestForNextMipLevel");
+        scheduleSetImage(self, texture, true);
     });
 }
 
@@ -1127,7 +1126,10 @@ void NetworkTexture::loadTextureContent(const QByteArray& content) {
         return;
     }
 
-    QThreadPool::globalInstance()->start(new ImageReader(_self, _url, content, _extraHash, _maxNumPixels, _sourceChannel));
+    auto reader = std::make_shared<ImageReader>(_self, _url, content, _maxNumPixels, _sourceChannel);
+    ResourceCache::schedule(ResourceScheduler::DECODE, _self, [reader] {
+        reader->run();
+    });
 }
 
 void NetworkTexture::refresh() {
@@ -1152,15 +1154,13 @@ void NetworkTexture::refresh() {
     Resource::refresh();
 }
 
-ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url, const QByteArray& data, size_t extraHash, int maxNumPixels, image::ColorChannel sourceChannel) :
+ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url, const QByteArray& data, int maxNumPixels, image::ColorChannel sourceChannel) :
     _resource(resource),
     _url(url),
     _content(data),
-    _extraHash(extraHash),
     _maxNumPixels(maxNumPixels),
     _sourceChannel(sourceChannel)
 {
-    DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
     listSupportedImageFormats();
 
 #if DEBUG_DUMP_TEXTURE_LOADS
@@ -1183,6 +1183,24 @@ ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url
 #endif
 }
 
+// Whenever a change is made to the processing of images that changes its output, this value should be incremented so that
+// the images transcoded before the change are processed again rather than read back from the KTX cache
+static const int32_t TRANSCODED_KTX_VERSION = 1;
+
+// The key under which the KTX transcoded from an image is cached: the output of the processing depends on the image, on how
+// it is processed and on the backend it is processed for.  The parameters are hashed by value, so the key of an image stays
+// the same from one run to the next.
+static std::string getTranscodedKtxKey(const QByteArray& content, image::TextureUsage::Type type, int maxNumPixels,
+                                       image::ColorChannel sourceChannel, bool compress, gpu::BackendTarget target) {
+    const int32_t parameters[] = {
+        TRANSCODED_KTX_VERSION, (int32_t)type, (int32_t)maxNumPixels, (int32_t)sourceChannel, (int32_t)compress, (int32_t)target
+    };
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    hasher.addData(content);
+    hasher.addData(reinterpret_cast<const char*>(parameters), sizeof(parameters));
+    return hasher.result().toHex().toStdString();
+}
+
 void ImageReader::listSupportedImageFormats() {
     static std::once_flag once;
     std::call_once(once, []{
@@ -1193,8 +1211,6 @@ void ImageReader::listSupportedImageFormats() {
 
 void ImageReader::run() {
     PROFILE_RANGE_EX(resource_parse_image, __FUNCTION__, 0xffff0000, 0, { { "url", _url.toString() } });
-    DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-    CounterStat counter("Processing");
 
     auto originalPriority = QThread::currentThread()->priority();
     if (originalPriority == QThread::InheritPriority) {
@@ -1213,14 +1229,17 @@ void ImageReader::read() {
     }
     auto networkTexture = resource.staticCast<NetworkTexture>();
 
-    // Hash the source image and extraHash for KTX caching
-    std::string hash;
-    {
-        QCryptographicHash hasher(QCryptographicHash::Md5);
-        hasher.addData(_content);
-        hasher.addData(std::to_string(_extraHash).c_str());
-        hash = hasher.result().toHex().toStdString();
-    }
+#ifdef USE_GLES
+    constexpr bool shouldCompress = true;
+#else
+    constexpr bool shouldCompress = false;
+#endif
+    auto target = getBackendTarget();
+    auto textureType = networkTexture->getTextureType();
+
+    // Key the KTX transcoded from the image, so that later loads of the same image for the same backend skip its decoding,
+    // mip generation and compression
+    std::string hash = getTranscodedKtxKey(_content, textureType, _maxNumPixels, _sourceChannel, shouldCompress, target);
 
     // Maybe load from cache
     auto textureCache = DependencyManager::get<TextureCache>();
@@ -1244,10 +1263,7 @@ void ImageReader::read() {
         // If we found the texture either because it's in use or via KTX deserialization,
         // set the image and return immediately.
         if (texture) {
-            QMetaObject::invokeMethod(resource.data(), "setImage",
-                                      Q_ARG(gpu::TexturePointer, texture),
-                                      Q_ARG(int, texture->getWidth()),
-                                      Q_ARG(int, texture->getHeight()));
+            scheduleSetImage(_resource, texture, false);
             return;
         }
     }
@@ -1259,14 +1275,7 @@ void ImageReader::read() {
 
         // IMPORTANT: _content is empty past this point
         auto buffer = std::shared_ptr<QIODevice>((QIODevice*)new OwningBuffer(std::move(_content)));
-
-#ifdef USE_GLES
-        constexpr bool shouldCompress = true;
-#else
-        constexpr bool shouldCompress = false;
-#endif
-        auto target = getBackendTarget();
-        texture = image::processImage(std::move(buffer), _url.toString().toStdString(), _sourceChannel, _maxNumPixels, networkTexture->getTextureType(), shouldCompress, target);
+        texture = image::processImage(std::move(buffer), _url.toString().toStdString(), _sourceChannel, _maxNumPixels, textureType, shouldCompress, target);
 
         if (!texture) {
             QMetaObject::invokeMethod(resource.data(), "setImage",
@@ -1301,10 +1310,7 @@ void ImageReader::read() {
         texture = textureCache->cacheTextureByHash(hash, texture);
     }
 
-    QMetaObject::invokeMethod(resource.data(), "setImage",
-                                Q_ARG(gpu::TexturePointer, texture),
-                                Q_ARG(int, texture->getWidth()),
-                                Q_ARG(int, texture->getHeight()));
+    scheduleSetImage(_resource, texture, false);
 }
 
 NetworkTexturePointer TextureCache::getResourceTexture(const QUrl& resourceTextureUrl) {
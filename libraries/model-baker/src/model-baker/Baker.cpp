@@ -154,7 +154,7 @@ namespace baker {
     class BakerEngineBuilder {
     public:
         using Input = VaryingSet3<hfm::Model::Pointer, hifi::VariantHash, hifi::URL>;
-        using Output = VaryingSet5<hfm::Model::Pointer, MaterialMapping, std::vector<hifi::ByteArray>, std::vector<bool>, std::vector<std::vector<hifi::ByteArray>>>;
+        using Output = VaryingSet6<hfm::Model::Pointer, MaterialMapping, std::vector<hifi::ByteArray>, std::vector<bool>, std::vector<std::vector<hifi::ByteArray>>, std::vector<std::vector<hifi::ByteArray>>>;
         using JobModel = Task::ModelIO<BakerEngineBuilder, Input, Output>;
         void build(JobModel& model, const Varying& input, Varying& output) {
             const auto& hfmModelIn = input.getN<Input>(0);
@@ -221,6 +221,7 @@ namespace baker {
             const auto dracoMeshes = buildDracoMeshOutputs.getN<BuildDracoMeshTask::Output>(0);
             const auto dracoErrors = buildDracoMeshOutputs.getN<BuildDracoMeshTask::Output>(1);
             const auto materialList = buildDracoMeshOutputs.getN<BuildDracoMeshTask::Output>(2);
+            const auto dracoLODMeshes = buildDracoMeshOutputs.getN<BuildDracoMeshTask::Output>(3);
 
             // Parse flow data
             const auto flowData = model.addJob<ParseFlowDataTask>("ParseFlowData", mapping);
@@ -233,7 +234,7 @@ namespace baker {
             const auto buildModelInputs = BuildModelTask::Input(hfmModelIn, meshesOut, jointsOut, jointRotationOffsets, jointIndices, flowData, shapeVerticesPerJoint, shapesOut, modelExtentsOut).asVarying();
             const auto hfmModelOut = model.addJob<BuildModelTask>("BuildModel", buildModelInputs);
 
-            output = Output(hfmModelOut, materialMapping, dracoMeshes, dracoErrors, materialList);
+            output = Output(hfmModelOut, materialMapping, dracoMeshes, dracoErrors, materialList, dracoLODMeshes);
         }
     };
 
@@ -271,4 +272,8 @@ namespace baker {
     std::vector<std::vector<hifi::ByteArray>> Baker::getDracoMaterialLists() const {
         return _engine->getOutput().get<BakerEngineBuilder::Output>().get4();
     }
+
+    const std::vector<std::vector<hifi::ByteArray>>& Baker::getDracoLODMeshes() const {
+        return _engine->getOutput().get<BakerEngineBuilder::Output>().get5();
+    }
 };
@@ -36,6 +36,8 @@ namespace baker {
         std::vector<bool> getDracoErrors() const;
         // This is a ByteArray and not a std::string because the character sequence can contain the null character (particularly for FBX materials)
         std::vector<std::vector<hifi::ByteArray>> getDracoMaterialLists() const;
+        // The draco meshes of each coarser LOD, from coarsest to finest, when BuildDracoMesh is configured to build them
+        const std::vector<std::vector<hifi::ByteArray>>& getDracoLODMeshes() const;
 
     protected:
         EnginePointer _engine;
@@ -234,6 +234,8 @@ std::tuple<std::unique_ptr<draco::Mesh>, bool> createDracoMesh(const hfm::Mesh&
 void BuildDracoMeshTask::configure(const Config& config) {
     _encodeSpeed = config.encodeSpeed;
     _decodeSpeed = config.decodeSpeed;
+    _numLODs = config.numLODs;
+    _lodTriangleRatio = config.lodTriangleRatio;
 }
 
 void BuildDracoMeshTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
@@ -252,36 +254,70 @@ void BuildDracoMeshTask::run(const baker::BakeContextPointer& context, const Inp
     std::vector<std::vector<uint16_t>> partMaterialIndicesPerMesh;
     createMaterialLists(shapes, meshes, materials, materialLists, partMaterialIndicesPerMesh);
 
-    dracoBytesPerMesh.reserve(meshes.size());
+    auto& dracoBytesPerLOD = output.edit3();
+    dracoBytesPerLOD.assign(_numLODs, std::vector<hifi::ByteArray>(meshes.size()));
+
+    dracoBytesPerMesh.resize(meshes.size());
     // vector<bool> is an exception to the std::vector conventions as it is a bit field
-    // So a bool reference to an element doesn't work
-    dracoErrorsPerMesh.resize(meshes.size());
-    for (size_t i = 0; i < meshes.size(); i++) {
+    // So a bool reference to an element doesn't work, and neither do concurrent writes to neighbouring elements
+    std::vector<uint8_t> dracoErrors(meshes.size(), 0);
+    task::runConcurrently(meshes.size(), [&](size_t i) {
         const auto& mesh = meshes[i];
         const auto& normals = baker::safeGet(normalsPerMesh, i);
         const auto& tangents = baker::safeGet(tangentsPerMesh, i);
-        dracoBytesPerMesh.emplace_back();
-        auto& dracoBytes = dracoBytesPerMesh.back();
+        auto& dracoBytes = dracoBytesPerMesh[i];
         const auto& partMaterialIndices = partMaterialIndicesPerMesh[i];
 
-        bool dracoError;
-        std::unique_ptr<draco::Mesh> dracoMesh;
-        std::tie(dracoMesh, dracoError) = createDracoMesh(mesh, normals, tangents, partMaterialIndices);
-        dracoErrorsPerMesh[i] = dracoError;
+        auto encodeMesh = [&](const hfm::Mesh& meshToEncode, hifi::ByteArray& bytes) {
+            bool dracoError;
+            std::unique_ptr<draco::Mesh> dracoMesh;
+            std::tie(dracoMesh, dracoError) = createDracoMesh(meshToEncode, normals, tangents, partMaterialIndices);
+
+            if (dracoMesh) {
+                draco::Encoder encoder;
+
+                encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+                encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 12);
+                encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
+                encoder.SetSpeedOptions(_encodeSpeed, _decodeSpeed);
+
+                draco::EncoderBuffer buffer;
+                encoder.EncodeMeshToBuffer(*dracoMesh, &buffer);
+
+                bytes = hifi::ByteArray(buffer.data(), (int)buffer.size());
+            }
+            return dracoError;
+        };
 
-        if (dracoMesh) {
-            draco::Encoder encoder;
+        dracoErrors[i] = encodeMesh(mesh, dracoBytes);
 
-            encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
-            encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 12);
-            encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
-            encoder.SetSpeedOptions(_encodeSpeed, _decodeSpeed);
+        auto countTriangles = [](const hfm::Mesh& meshToCount) {
+            int triangleCount = 0;
+            for (const auto& part : meshToCount.parts) {
+                triangleCount += part.quadTrianglesIndices.size() / 3 + part.triangleIndices.size() / 3;
+            }
+            return triangleCount;
+        };
 
-            draco::EncoderBuffer buffer;
-            encoder.EncodeMeshToBuffer(*dracoMesh, &buffer);
+        // Meshes with blendshapes are kept at full detail in every LOD, as they are mostly faces, which are seen up close
+        int triangleCount = countTriangles(mesh);
+        for (int lod = _numLODs - 1; lod >= 0; lod--) {
+            auto& lodBytes = dracoBytesPerLOD[lod][i];
+            lodBytes = dracoBytes;
+            if (dracoErrors[i] || !mesh.blendshapes.empty()) {
+                continue;
+            }
 
-            dracoBytes = hifi::ByteArray(buffer.data(), (int)buffer.size());
+            int targetTriangleCount = (int)(triangleCount * powf(_lodTriangleRatio, (float)(_numLODs - lod)));
+            hfm::Mesh lodMesh = baker::decimateMesh(mesh, targetTriangleCount);
+            if (countTriangles(lodMesh) < triangleCount) {
+                hifi::ByteArray bytes;
+                if (!encodeMesh(lodMesh, bytes) && !bytes.isEmpty()) {
+                    lodBytes = bytes;
+                }
+            }
         }
-    }
+    });
+    dracoErrorsPerMesh.assign(dracoErrors.begin(), dracoErrors.end());
 #endif // not Q_OS_ANDROID
 }
@@ -23,18 +23,25 @@ class BuildDracoMeshConfig : public baker::JobConfig {
     Q_OBJECT
     Q_PROPERTY(int encodeSpeed MEMBER encodeSpeed)
     Q_PROPERTY(int decodeSpeed MEMBER decodeSpeed)
+    Q_PROPERTY(int numLODs MEMBER numLODs)
+    Q_PROPERTY(float lodTriangleRatio MEMBER lodTriangleRatio)
 public:
     BuildDracoMeshConfig() : baker::JobConfig(false) {}
 
     int encodeSpeed { 0 };
     int decodeSpeed { 5 };
+
+    // Number of coarser versions of each mesh to build, each with lodTriangleRatio times the triangles of the next finer one
+    int numLODs { 0 };
+    float lodTriangleRatio { 0.25f };
 };
 
 class BuildDracoMeshTask {
 public:
     using Config = BuildDracoMeshConfig;
     using Input = baker::VaryingSet5<std::vector<hfm::Shape>, std::vector<hfm::Mesh>, std::vector<hfm::Material>, baker::NormalsPerMesh, baker::TangentsPerMesh>;
-    using Output = baker::VaryingSet3<std::vector<hifi::ByteArray>, std::vector<bool>, std::vector<std::vector<hifi::ByteArray>>>;
+    // The last output holds the draco meshes of each LOD, from coarsest to finest, or the full mesh where it can't be simplified
+    using Output = baker::VaryingSet4<std::vector<hifi::ByteArray>, std::vector<bool>, std::vector<std::vector<hifi::ByteArray>>, std::vector<std::vector<hifi::ByteArray>>>;
     using JobModel = baker::Job::ModelIO<BuildDracoMeshTask, Input, Output, Config>;
 
     void configure(const Config& config);
@@ -43,6 +50,8 @@ public:
 protected:
     int _encodeSpeed { 0 };
     int _decodeSpeed { 5 };
+    int _numLODs { 0 };
+    float _lodTriangleRatio { 0.25f };
 };
 
 #endif // hifi_BuildDracoMeshTask_h
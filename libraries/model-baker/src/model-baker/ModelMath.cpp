@@ -117,5 +117,104 @@ namespace baker {
             }
         }
     }
-}
 
+    static int countTriangles(const hfm::MeshPart& part) {
+        return part.quadTrianglesIndices.size() / 3 + part.triangleIndices.size() / 3;
+    }
+
+    // Maps each vertex to the first vertex of its cell, with the longest axis of the bounds split into cellsPerAxis cells
+    static std::vector<int> clusterVertices(const hfm::Mesh& mesh, const Extents& bounds, int cellsPerAxis) {
+        glm::vec3 size = bounds.maximum - bounds.minimum;
+        float cellSize = glm::max(glm::max(size.x, size.y), size.z) / (float)cellsPerAxis;
+        if (cellSize <= 0.0f) {
+            cellSize = 1.0f;
+        }
+
+        std::unordered_map<uint64_t, int> cells;
+        std::vector<int> representatives(mesh.vertices.size());
+        for (int i = 0; i < mesh.vertices.size(); i++) {
+            glm::uvec3 cell = glm::uvec3(glm::clamp((mesh.vertices[i] - bounds.minimum) / cellSize, 0.0f, (float)cellsPerAxis));
+            uint64_t key = ((uint64_t)cell.x << 42) | ((uint64_t)cell.y << 21) | (uint64_t)cell.z;
+            representatives[i] = cells.emplace(key, i).first->second;
+        }
+        return representatives;
+    }
+
+    static hfm::MeshPart decimatePart(const hfm::MeshPart& part, const std::vector<int>& representatives) {
+        hfm::MeshPart decimatedPart;
+        auto addTriangles = [&](const QVector<int>& indices) {
+            for (int i = 0; (i + 2) < indices.size(); i += 3) {
+                int index0 = representatives[indices[i]];
+                int index1 = representatives[indices[i + 1]];
+                int index2 = representatives[indices[i + 2]];
+                if (index0 != index1 && index1 != index2 && index2 != index0) {
+                    decimatedPart.triangleIndices << index0 << index1 << index2;
+                }
+            }
+        };
+        addTriangles(part.quadTrianglesIndices);
+        addTriangles(part.triangleIndices);
+
+        if (decimatedPart.triangleIndices.empty()) {
+            // keep the part, and so its material, around
+            const auto& indices = part.quadTrianglesIndices.size() >= 3 ? part.quadTrianglesIndices : part.triangleIndices;
+            if (indices.size() >= 3) {
+                decimatedPart.triangleIndices << indices[0] << indices[1] << indices[2];
+            }
+        }
+        return decimatedPart;
+    }
+
+    hfm::Mesh decimateMesh(const hfm::Mesh& mesh, int targetTriangleCount) {
+        int triangleCount = 0;
+        for (const auto& part : mesh.parts) {
+            triangleCount += countTriangles(part);
+            for (int index : part.quadTrianglesIndices + part.triangleIndices) {
+                if (index < 0 || index >= mesh.vertices.size()) {
+                    qCWarning(model_baker) << "Found a mesh part with out of range indices. The mesh will not be decimated.";
+                    return mesh;
+                }
+            }
+        }
+        if (triangleCount <= targetTriangleCount) {
+            return mesh;
+        }
+
+        Extents bounds;
+        for (const auto& vertex : mesh.vertices) {
+            bounds.addPoint(vertex);
+        }
+
+        // binary search for the finest grid which brings the mesh down to the target
+        const int MAX_CELLS_PER_AXIS = 1 << 20;
+        int lowCells = 1;
+        int highCells = MAX_CELLS_PER_AXIS;
+        std::vector<hfm::MeshPart> bestParts;
+        while (lowCells <= highCells) {
+            int cells = lowCells + (highCells - lowCells) / 2;
+            auto representatives = clusterVertices(mesh, bounds, cells);
+            std::vector<hfm::MeshPart> parts;
+            int decimatedTriangleCount = 0;
+            for (const auto& part : mesh.parts) {
+                parts.push_back(decimatePart(part, representatives));
+                decimatedTriangleCount += countTriangles(parts.back());
+            }
+
+            if (decimatedTriangleCount <= targetTriangleCount) {
+                bestParts = parts;
+                lowCells = cells + 1;
+            } else {
+                if (bestParts.empty() && cells == 1) {
+                    // the target is below one triangle per part
+                    bestParts = parts;
+                }
+                highCells = cells - 1;
+            }
+        }
+
+        // the vertex data stays implicitly shared with the original mesh
+        hfm::Mesh decimatedMesh = mesh;
+        decimatedMesh.parts = bestParts;
+        return decimatedMesh;
+    }
+}
@@ -53,4 +53,9 @@ namespace baker {
     using IndexAccessor = std::function<glm::vec3*(int firstIndex, int secondIndex, glm::vec3* outVertices, glm::vec2* outTexCoords, glm::vec3& outNormal)>;
 
     void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor);
+
+    // Returns a coarser copy of mesh with at most targetTriangleCount triangles, where possible, by vertex clustering:
+    // the vertices are snapped to the first vertex found in their cell of a uniform grid, and the triangles which collapse are dropped.
+    // No vertices are added or moved, so the vertex attributes of the mesh still apply as they are. Each part keeps at least one triangle.
+    hfm::Mesh decimateMesh(const hfm::Mesh& mesh, int targetTriangleCount);
 };
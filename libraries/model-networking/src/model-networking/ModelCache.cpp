@@ -16,13 +16,12 @@
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
 
-#include <QThreadPool>
+#include <QThread>
 
 #include <Gzip.h>
 
 #include "ModelNetworkingLogging.h"
 #include <Trace.h>
-#include <StatTracker.h>
 #include <hfm/ModelFormatRegistry.h>
 #include <FBXSerializer.h>
 #include <OBJSerializer.h>
@@ -85,16 +84,21 @@ namespace std {
     };
 }
 
-class GeometryReader : public QRunnable {
+class GeometryReader {
 public:
     GeometryReader(const ModelLoader& modelLoader, QWeakPointer<Resource>& resource, const QUrl& url, const GeometryMappingPair& mapping,
                    const QByteArray& data, bool combineParts, const QString& webMediaType) :
         _modelLoader(modelLoader), _resource(resource), _url(url), _mapping(mapping), _data(data), _combineParts(combineParts), _webMediaType(webMediaType) {
-
-        DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
     }
 
-    virtual void run() override;
+    void run();
+
+    // queues the reader on the decode stage of the resource scheduler
+    static void schedule(std::shared_ptr<GeometryReader> reader) {
+        ModelCache::schedule(ResourceScheduler::DECODE, reader->_resource, [reader] {
+            reader->run();
+        });
+    }
 
 private:
     ModelLoader _modelLoader;
@@ -107,8 +111,6 @@ private:
 };
 
 void GeometryReader::run() {
-    DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
-    CounterStat counter("Processing");
     PROFILE_RANGE_EX(resource_parse_geometry, "GeometryReader::run", 0xFF00FF00, 0, { { "url", _url.toString() } });
     auto originalPriority = QThread::currentThread()->priority();
     if (originalPriority == QThread::InheritPriority) {
@@ -181,20 +183,25 @@ void GeometryReader::run() {
         auto processedHFMModel = modelBaker.getHFMModel();
         auto materialMapping = modelBaker.getMaterialMapping();
 
-        QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
-                Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
+        // hand the geometry over on the upload stage, where the models with the highest load priority go first
+        auto weakResource = _resource;
+        ModelCache::schedule(ResourceScheduler::UPLOAD, weakResource, [weakResource, processedHFMModel, materialMapping] {
+            auto strongResource = weakResource.toStrongRef();
+            if (strongResource) {
+                QMetaObject::invokeMethod(strongResource.data(), "setGeometryDefinition",
+                    Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
+            }
+        });
     } catch (const std::exception&) {
         auto resource = _resource.toStrongRef();
         if (resource) {
-            QMetaObject::invokeMethod(resource.data(), "finishedLoading",
-                Q_ARG(bool, false));
+            QMetaObject::invokeMethod(resource.data(), "failedToParseGeometry");
         }
     } catch (QString& e) {
         qCWarning(modelnetworking) << "Exception while loading model --" << e;
         auto resource = _resource.toStrongRef();
         if (resource) {
-            QMetaObject::invokeMethod(resource.data(), "finishedLoading",
-                                      Q_ARG(bool, false));
+            QMetaObject::invokeMethod(resource.data(), "failedToParseGeometry");
         }
     }
 }
@@ -215,6 +222,7 @@ ModelResource::ModelResource(const ModelResource& other) :
     if (other._modelResource) {
         _startedLoading = false;
     }
+    resetProgressiveState();
 }
 
 void ModelResource::downloadFinished(const QByteArray& data) {
@@ -243,6 +251,12 @@ void ModelResource::downloadFinished(const QByteArray& data) {
                 _textureBaseURL = url.resolved(QUrl("."));
             }
 
+            // baked models may also come as a progressive model, which shows sooner
+            QString progressiveFilename = _mapping.value(PROGRESSIVE_FILENAME_FIELD).toString();
+            if (!progressiveFilename.isEmpty()) {
+                url = base.resolved(progressiveFilename);
+            }
+
             auto scripts = FSTReader::getScripts(base, _mapping);
             if (scripts.size() > 0) {
                 _mapping.remove(SCRIPT_FIELD);
@@ -268,27 +282,162 @@ void ModelResource::downloadFinished(const QByteArray& data) {
             GeometryExtra extra { GeometryMappingPair(base, _mapping), _textureBaseURL, false };
 
             // Get the raw ModelResource
-            _modelResource = modelCache->getResource(url, QUrl(), &extra, std::hash<GeometryExtra>()(extra)).staticCast<ModelResource>();
-            // Avoid caching nested resources - their references will be held by the parent
-            _modelResource->_isCacheable = false;
-
-            if (_modelResource->isLoaded()) {
-                onGeometryMappingLoaded(!_modelResource->getURL().isEmpty());
-            } else {
-                if (_connection) {
-                    disconnect(_connection);
-                }
-
-                _connection = connect(_modelResource.data(), &Resource::finished, this, &ModelResource::onGeometryMappingLoaded);
-            }
+            setModelResource(modelCache->getResource(url, QUrl(), &extra, std::hash<GeometryExtra>()(extra)).staticCast<ModelResource>());
         }
     } else {
         if (_url != _effectiveBaseURL) {
             _url = _effectiveBaseURL;
             _textureBaseURL = _effectiveBaseURL;
         }
-        QThreadPool::globalInstance()->start(new GeometryReader(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data, _combineParts, _request->getWebMediaType()));
+        if (ProgressiveModel::isProgressiveModelURL(_effectiveBaseURL)) {
+            handleProgressiveModelData(data);
+        } else {
+            GeometryReader::schedule(std::make_shared<GeometryReader>(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data,
+                _combineParts, _request->getWebMediaType()));
+        }
+    }
+}
+
+void ModelResource::setModelResource(const ModelResource::Pointer& modelResource) {
+    _modelResource = modelResource;
+    // Avoid caching nested resources - their references will be held by the parent
+    _modelResource->_isCacheable = false;
+    // the owners of the FST are waiting on the model it points at
+    _modelResource->setLoadPriorities(getLoadPriorities());
+
+    if (_modelResource->isLoaded()) {
+        onGeometryMappingLoaded(!_modelResource->getURL().isEmpty());
+    } else {
+        if (_connection) {
+            disconnect(_connection);
+        }
+
+        _connection = connect(_modelResource.data(), &Resource::finished, this, &ModelResource::onGeometryMappingLoaded);
+    }
+}
+
+void ModelResource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
+    Resource::setLoadPriority(owner, priority);
+    if (_modelResource) {
+        _modelResource->setLoadPriority(owner, priority);
+    }
+}
+
+void ModelResource::setLoadPriorities(const QHash<QPointer<QObject>, float>& priorities) {
+    Resource::setLoadPriorities(priorities);
+    if (_modelResource) {
+        _modelResource->setLoadPriorities(priorities);
+    }
+}
+
+void ModelResource::clearLoadPriority(const QPointer<QObject>& owner) {
+    Resource::clearLoadPriority(owner);
+    if (_modelResource) {
+        _modelResource->clearLoadPriority(owner);
+    }
+}
+
+void ModelResource::resetProgressiveState() {
+    _progressiveChunks.clear();
+    _progressiveChunkIndex = 0;
+    if (ProgressiveModel::isProgressiveModelURL(_url)) {
+        // start with the header, which tells where the chunks are
+        _requestByteRange.fromInclusive = 0;
+        _requestByteRange.toExclusive = ProgressiveModel::HEADER_SIZE;
+    }
+}
+
+void ModelResource::init(bool resetLoaded) {
+    if (resetLoaded) {
+        resetProgressiveState();
+    }
+    Resource::init(resetLoaded);
+}
+
+void ModelResource::handleProgressiveModelData(const QByteArray& data) {
+    if (_progressiveChunks.empty()) {
+        if (!ProgressiveModel::readHeader(data, _progressiveChunks)) {
+            qCWarning(modelnetworking) << "Failed to read the header of progressive model" << _url;
+            finishedLoading(false);
+            return;
+        }
+        requestProgressiveChunk(0);
+        return;
+    }
+
+    GeometryReader::schedule(std::make_shared<GeometryReader>(_modelLoader, _self, ProgressiveModel::getChunkURL(_effectiveBaseURL),
+        _mappingPair, data, _combineParts, ""));
+}
+
+void ModelResource::requestProgressiveChunk(size_t index) {
+    _progressiveChunkIndex = index;
+    const auto& chunk = _progressiveChunks[index];
+    _requestByteRange.fromInclusive = chunk.offset;
+    _requestByteRange.toExclusive = chunk.offset + chunk.size;
+
+    init(false);
+    if (_loaded) {
+        // refinements wait for the first LOD of other resources, as the mips of textures do
+        setLoadPriority(this, -(float)index);
+    }
+    // queued, as the request which brought in the header may still be cleaning up
+    QMetaObject::invokeMethod(this, "attemptRequest", Qt::QueuedConnection);
+}
+
+bool ModelResource::handleFailedRequest(ResourceRequest::Result result) {
+    if (_loaded && isRefining()) {
+        qCWarning(modelnetworking) << "Failed to download a finer LOD of" << _url << "; keeping the current one";
+        _progressiveChunks.clear();
+        return false;
+    }
+    return Resource::handleFailedRequest(result);
+}
+
+void ModelResource::failedToParseGeometry() {
+    if (_loaded && isRefining()) {
+        qCWarning(modelnetworking) << "Failed to parse a finer LOD of" << _url << "; keeping the current one";
+        _progressiveChunks.clear();
+    } else {
+        finishedLoading(false);
+    }
+}
+
+bool ModelResource::isCompatibleRefinement(const HFMModel& hfmModel) const {
+    // the render items and rig of the models using this resource are set up for its current structure
+    if (hfmModel.meshes.size() != _hfmModel->meshes.size() || hfmModel.shapes.size() != _hfmModel->shapes.size() ||
+        hfmModel.joints.size() != _hfmModel->joints.size() || hfmModel.skinDeformers.size() != _hfmModel->skinDeformers.size() ||
+        hfmModel.materials.size() != _hfmModel->materials.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < hfmModel.meshes.size(); i++) {
+        if (hfmModel.meshes[i].parts.size() != _hfmModel->meshes[i].parts.size() ||
+            hfmModel.meshes[i].blendshapes.size() != _hfmModel->meshes[i].blendshapes.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ModelResource::refineGeometry(const HFMModel::Pointer& hfmModel) {
+    if (!isCompatibleRefinement(*hfmModel)) {
+        qCWarning(modelnetworking) << "A finer LOD of" << _url << "does not match the current one; keeping the current one";
+        _progressiveChunks.clear();
+        return;
+    }
+
+    _hfmModel = hfmModel;
+    std::shared_ptr<GeometryMeshes> meshes = std::make_shared<GeometryMeshes>();
+    for (const HFMMesh& mesh : _hfmModel->meshes) {
+        meshes->emplace_back(mesh._mesh);
+    }
+    _meshes = meshes;
+
+    if (_progressiveChunkIndex + 1 < _progressiveChunks.size()) {
+        requestProgressiveChunk(_progressiveChunkIndex + 1);
+    } else {
+        _progressiveChunks.clear();
     }
+    emit refined();
 }
 
 void ModelResource::onGeometryMappingLoaded(bool success) {
@@ -298,16 +447,35 @@ void ModelResource::onGeometryMappingLoaded(bool success) {
         _meshes = _modelResource->_meshes;
         _materials = _modelResource->_materials;
 
-        // Avoid holding onto extra references
-        _modelResource.reset();
         // Make sure connection will not trigger again
         disconnect(_connection); // FIXME Should not have to do this
+        if (_modelResource->isRefining()) {
+            // Follow the finer LODs of a progressive model as they come in
+            _connection = connect(_modelResource.data(), &ModelResource::refined, this, &ModelResource::onGeometryMappingRefined);
+        } else {
+            // Avoid holding onto extra references
+            _modelResource.reset();
+        }
     }
 
     PROFILE_ASYNC_END(resource_parse_geometry, "ModelResource::downloadFinished", _url.toString());
     finishedLoading(success);
 }
 
+void ModelResource::onGeometryMappingRefined() {
+    if (!_modelResource) {
+        return;
+    }
+
+    _hfmModel = _modelResource->_hfmModel;
+    _meshes = _modelResource->_meshes;
+    if (!_modelResource->isRefining()) {
+        disconnect(_connection);
+        _modelResource.reset();
+    }
+    emit refined();
+}
+
 void ModelResource::setExtra(void* extra) {
     const GeometryExtra* geometryExtra = static_cast<const GeometryExtra*>(extra);
     _mappingPair = geometryExtra ? geometryExtra->mapping : GeometryMappingPair(QUrl(), QVariantHash());
@@ -316,6 +484,11 @@ void ModelResource::setExtra(void* extra) {
 }
 
 void ModelResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const MaterialMapping& materialMapping) {
+    if (_loaded && isRefining()) {
+        refineGeometry(hfmModel);
+        return;
+    }
+
     // Assume ownership of the processed HFMModel
     _hfmModel = hfmModel;
     _materialMapping = materialMapping;
@@ -337,6 +510,12 @@ void ModelResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const Mate
     _meshes = meshes;
 
     finishedLoading(true);
+
+    if (_progressiveChunkIndex + 1 < _progressiveChunks.size()) {
+        requestProgressiveChunk(_progressiveChunkIndex + 1);
+    } else {
+        _progressiveChunks.clear();
+    }
 }
 
 void ModelResource::deleter() {
@@ -429,6 +608,11 @@ NetworkModel::NetworkModel(const NetworkModel& networkModel) {
     _mapping = networkModel._mapping;
 }
 
+void NetworkModel::setRefinedGeometry(const NetworkModel& refinement) {
+    _hfmModel = refinement._hfmModel;
+    _meshes = refinement._meshes;
+}
+
 void NetworkModel::setTextures(const QVariantMap& textureMap) {
     if (_meshes->size() > 0) {
         for (auto& material : _materials) {
@@ -514,9 +698,12 @@ void ModelResourceWatcher::stopWatching() {
 void ModelResourceWatcher::setResource(ModelResource::Pointer resource) {
     if (_resource) {
         stopWatching();
+        disconnect(_resource.data(), &ModelResource::refined, this, &ModelResourceWatcher::resourceRefined);
     }
     _resource = resource;
     if (_resource) {
+        // a progressive model may still be refining after it has loaded
+        connect(_resource.data(), &ModelResource::refined, this, &ModelResourceWatcher::resourceRefined);
         if (_resource->isLoaded()) {
             resourceFinished(true);
         } else {
@@ -525,6 +712,13 @@ void ModelResourceWatcher::setResource(ModelResource::Pointer resource) {
     }
 }
 
+void ModelResourceWatcher::setLoadPriority(const QPointer<QObject>& owner, float priority) {
+    // the priorities are cleared once the resource has loaded, and its refinements keep their own
+    if (_resource && !_resource->isLoaded()) {
+        _resource->setLoadPriority(owner, priority);
+    }
+}
+
 void ModelResourceWatcher::resourceFinished(bool success) {
     if (success) {
         _networkModelRef = std::make_shared<NetworkModel>(*_resource);
@@ -532,6 +726,13 @@ void ModelResourceWatcher::resourceFinished(bool success) {
     emit finished(success);
 }
 
+void ModelResourceWatcher::resourceRefined() {
+    if (_networkModelRef) {
+        _networkModelRef->setRefinedGeometry(*_resource);
+        emit refined();
+    }
+}
+
 void ModelResourceWatcher::resourceRefreshed() {
     // FIXME: Model is not set up to handle a refresh
     // _instance.reset();
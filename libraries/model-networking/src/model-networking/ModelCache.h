@@ -18,6 +18,7 @@
 #include <graphics/Asset.h>
 
 #include "FBXSerializer.h"
+#include <ProgressiveModel.h>
 #include <procedural/ProceduralMaterialCache.h>
 #include <material-networking/TextureCache.h>
 #include "ModelLoader.h"
@@ -55,6 +56,9 @@ public:
     const QUrl& getAnimGraphOverrideUrl() const { return _animGraphOverrideUrl; }
     const QVariantHash& getMapping() const { return _mapping; }
 
+    // Takes on the meshes of a finer LOD of the same progressive model, keeping the materials and textures as they are
+    void setRefinedGeometry(const NetworkModel& refinement);
+
 protected:
     // Shared across all geometries, constant throughout lifetime
     HFMModel::ConstPointer _hfmModel;
@@ -77,7 +81,7 @@ class ModelResource : public Resource, public NetworkModel {
 public:
     using Pointer = QSharedPointer<ModelResource>;
 
-    ModelResource(const QUrl& url, const ModelLoader& modelLoader) : Resource(url), _modelLoader(modelLoader) {}
+    ModelResource(const QUrl& url, const ModelLoader& modelLoader) : Resource(url), _modelLoader(modelLoader) { resetProgressiveState(); }
     ModelResource(const ModelResource& other);
 
     QString getType() const override { return "Model"; }
@@ -89,13 +93,33 @@ public:
 
     virtual bool areTexturesLoaded() const override { return isLoaded() && NetworkModel::areTexturesLoaded(); }
 
+    // the model that an FST points at is what actually loads, so it takes on the priorities of the FST's owners
+    virtual void setLoadPriority(const QPointer<QObject>& owner, float priority) override;
+    virtual void setLoadPriorities(const QHash<QPointer<QObject>, float>& priorities) override;
+    virtual void clearLoadPriority(const QPointer<QObject>& owner) override;
+
+    /// Checks whether finer LODs of a progressive model are still to come, once the coarsest one has loaded,
+    /// whether the model was requested directly or through an FST.
+    bool isRefining() const { return !_progressiveChunks.empty() || (_modelResource && _modelResource->isRefining()); }
+
+signals:
+    /// Fired when the geometry of a loaded progressive model has been replaced by a finer LOD.
+    void refined();
+
 private slots:
     void onGeometryMappingLoaded(bool success);
+    void onGeometryMappingRefined();
 
 protected:
     friend class ModelCache;
+    friend class ModelResourceTests;
+    friend class ResourceSchedulerTests;
+
+    virtual void init(bool resetLoaded = true) override;
+    virtual bool handleFailedRequest(ResourceRequest::Result result) override;
 
     Q_INVOKABLE void setGeometryDefinition(HFMModel::Pointer hfmModel, const MaterialMapping& materialMapping);
+    Q_INVOKABLE void failedToParseGeometry();
 
     // Geometries may not hold onto textures while cached - that is for the texture cache
     // Instead, these methods clear and reset textures from the geometry when caching/loading
@@ -106,6 +130,13 @@ protected:
     virtual bool isCacheable() const override { return _loaded && _isCacheable; }
 
 private:
+    void setModelResource(const ModelResource::Pointer& modelResource);
+    void resetProgressiveState();
+    void handleProgressiveModelData(const QByteArray& data);
+    void requestProgressiveChunk(size_t index);
+    void refineGeometry(const HFMModel::Pointer& hfmModel);
+    bool isCompatibleRefinement(const HFMModel& hfmModel) const;
+
     ModelLoader _modelLoader;
     GeometryMappingPair _mappingPair;
     QUrl _textureBaseURL;
@@ -115,6 +146,10 @@ private:
     QMetaObject::Connection _connection;
 
     bool _isCacheable{ true };
+
+    // The chunks of a progressive model, from coarsest to finest, until the finest one has been loaded
+    std::vector<ProgressiveModel::Chunk> _progressiveChunks;
+    size_t _progressiveChunkIndex { 0 };
 };
 
 class ModelResourceWatcher : public QObject {
@@ -131,15 +166,23 @@ public:
     int getResourceDownloadAttempts() { return _resource ? _resource->getDownloadAttempts() : 0; }
     int getResourceDownloadAttemptsRemaining() { return _resource ? _resource->getDownloadAttemptsRemaining() : 0; }
 
+    /// Updates the load priority of owner for the resource, until it has loaded
+    void setLoadPriority(const QPointer<QObject>& owner, float priority);
+
+    /// Checks whether the geometry is still to be replaced by finer LODs
+    bool isRefining() const { return _resource && _resource->isRefining(); }
+
 private:
     void startWatching();
     void stopWatching();
 
 signals:
     void finished(bool success);
+    void refined();
 
 private slots:
     void resourceFinished(bool success);
+    void resourceRefined();
     void resourceRefreshed();
 
 private:
@@ -102,15 +102,18 @@ std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesDataPacket(QString c
 
 
 void MessagesClient::handleMessagesPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    bool isText { false };
-    QUuid senderID;
-    decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
-    if (isText) {
-        emit messageReceived(channel, message, senderID, false);
-    } else {
-        emit dataReceived(channel, data, senderID, false);
+    // the messages mixer batches all of the messages for a subscriber that arrive within its flush window
+    while (receivedMessage->getBytesLeftToRead() > 0) {
+        QString channel, message;
+        QByteArray data;
+        bool isText { false };
+        QUuid senderID;
+        decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+        if (isText) {
+            emit messageReceived(channel, message, senderID, false);
+        } else {
+            emit dataReceived(channel, data, senderID, false);
+        }
     }
 }
 
@@ -30,11 +30,13 @@
 
 bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
+    auto now = usecTimestampNow();
     if ((uint32_t)_loadingRequests.size() < _requestLimit) {
         _loadingRequests.append(resource);
+        _scheduler.recordStarted(ResourceScheduler::NETWORK, now);
         return true;
     } else {
-        _pendingRequests.append(resource);
+        _pendingRequests.append({ resource, now });
         return false;
     }
 }
@@ -53,8 +55,8 @@ QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() c
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
 
-    foreach (QWeakPointer<Resource> resource, _pendingRequests) {
-        auto locked = resource.lock();
+    foreach (const PendingRequest& request, _pendingRequests) {
+        auto locked = request.resource.lock();
         if (locked) {
             result.append(locked);
         }
@@ -115,9 +117,10 @@ QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
 
     for (int i = 0; i < _pendingRequests.size();) {
         // Clear any freed resources
-        auto resource = _pendingRequests.at(i).lock();
+        auto resource = _pendingRequests.at(i).resource.lock();
         if (!resource) {
             _pendingRequests.removeAt(i);
+            _scheduler.recordCancelled(ResourceScheduler::NETWORK);
             continue;
         }
 
@@ -134,7 +137,8 @@ QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
     }
 
     if (highestIndex >= 0) {
-        _pendingRequests.takeAt(highestIndex);
+        auto request = _pendingRequests.takeAt(highestIndex);
+        _scheduler.recordStarted(ResourceScheduler::NETWORK, request.queuedUsecs);
     }
 
     return highestResource;
@@ -146,6 +150,17 @@ void ResourceCacheSharedItems::clear() {
     _loadingRequests.clear();
 }
 
+ResourceScheduler::Stats ResourceCacheSharedItems::getStageStats(ResourceScheduler::Stage stage) const {
+    auto stats = _scheduler.getStats(stage);
+    if (stage == ResourceScheduler::NETWORK) {
+        // the network stage queues its requests here rather than in the scheduler
+        Lock lock(_mutex);
+        stats.queueDepth = (uint32_t)_pendingRequests.size();
+        stats.active = (uint32_t)_loadingRequests.size();
+    }
+    return stats;
+}
+
 ScriptableResourceCache::ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache) {
     _resourceCache = resourceCache;
     connect(&(*_resourceCache), &ResourceCache::dirty,
@@ -529,6 +544,18 @@ uint32_t ResourceCache::getLoadingRequestCount() {
     return DependencyManager::get<ResourceCacheSharedItems>()->getLoadingRequestsCount();
 }
 
+void ResourceCache::schedule(ResourceScheduler::Stage stage, const QWeakPointer<Resource>& resource, ResourceScheduler::Job job) {
+    DependencyManager::get<ResourceCacheSharedItems>()->getScheduler().schedule(stage, resource, job);
+}
+
+ResourceScheduler::Stats ResourceCache::getStageStats(ResourceScheduler::Stage stage) {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getStageStats(stage);
+}
+
+void ResourceCache::setMaxDecodeJobs(int maxJobs) {
+    DependencyManager::get<ResourceCacheSharedItems>()->getScheduler().setMaxDecodeJobs(maxJobs);
+}
+
 bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource) {
     Q_ASSERT(!resource.isNull());
 
@@ -570,6 +597,7 @@ Resource::Resource(const Resource& other) :
     _failedToLoad(other._failedToLoad),
     _loaded(other._loaded),
     _loadPriorities(other._loadPriorities),
+    _cachedLoadPriority(other._cachedLoadPriority.load()),
     _bytesReceived(other._bytesReceived),
     _bytesTotal(other._bytesTotal),
     _bytes(other._bytes),
@@ -595,6 +623,7 @@ Resource::~Resource() {
         _request = nullptr;
         ResourceCache::requestCompleted(_self);
     }
+    ResourceScheduler::resourceDestroyed(this);
 }
 
 void Resource::ensureLoading() {
@@ -604,42 +633,85 @@ void Resource::ensureLoading() {
 }
 
 void Resource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
-    if (!_failedToLoad) {
-        _loadPriorities.insert(owner, priority);
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+        if (!_failedToLoad) {
+            _loadPriorities.insert(owner, priority);
+            changed = updateCachedLoadPriority();
+        }
     }
+    notifyLoadPriorityChanged(changed);
 }
 
 void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& priorities) {
     if (_failedToLoad) {
         return;
     }
-    for (QHash<QPointer<QObject>, float>::const_iterator it = priorities.constBegin();
-            it != priorities.constEnd(); it++) {
-        _loadPriorities.insert(it.key(), it.value());
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+        for (QHash<QPointer<QObject>, float>::const_iterator it = priorities.constBegin();
+                it != priorities.constEnd(); it++) {
+            _loadPriorities.insert(it.key(), it.value());
+        }
+        changed = updateCachedLoadPriority();
     }
+    notifyLoadPriorityChanged(changed);
 }
 
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
-    if (!_failedToLoad) {
-        _loadPriorities.remove(owner);
+    bool changed = false;
+    {
+        std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+        if (!_failedToLoad) {
+            _loadPriorities.remove(owner);
+            changed = updateCachedLoadPriority();
+        }
     }
+    notifyLoadPriorityChanged(changed);
 }
 
 float Resource::getLoadPriority() {
-    if (_loadPriorities.size() == 0) {
-        return 0;
+    float priority;
+    bool changed;
+    {
+        std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+        changed = updateCachedLoadPriority();
+        priority = _cachedLoadPriority;
+    }
+    notifyLoadPriorityChanged(changed);
+    return priority;
+}
+
+bool Resource::updateCachedLoadPriority() {
+    float highestPriority = 0.0f;
+    if (_loadPriorities.size() > 0) {
+        highestPriority = -FLT_MAX;
+        for (QHash<QPointer<QObject>, float>::iterator it = _loadPriorities.begin(); it != _loadPriorities.end(); ) {
+            if (it.key().isNull()) {
+                it = _loadPriorities.erase(it);
+                continue;
+            }
+            highestPriority = qMax(highestPriority, it.value());
+            it++;
+        }
+        if (_loadPriorities.size() == 0) {
+            highestPriority = 0.0f;
+        }
     }
+    return _cachedLoadPriority.exchange(highestPriority) != highestPriority;
+}
 
-    float highestPriority = -FLT_MAX;
-    for (QHash<QPointer<QObject>, float>::iterator it = _loadPriorities.begin(); it != _loadPriorities.end(); ) {
-        if (it.key().isNull()) {
-            it = _loadPriorities.erase(it);
-            continue;
-        }
-        highestPriority = qMax(highestPriority, it.value());
-        it++;
+void Resource::notifyLoadPriorityChanged(bool changed) {
+    if (changed) {
+        ResourceScheduler::loadPriorityChanged(this);
     }
-    return highestPriority;
+}
+
+QHash<QPointer<QObject>, float> Resource::getLoadPriorities() {
+    std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+    return _loadPriorities;
 }
 
 void Resource::refresh() {
@@ -717,7 +789,13 @@ void Resource::attemptRequest() {
 
 void Resource::finishedLoading(bool success) {
     if (success) {
-        _loadPriorities.clear();
+        bool changed;
+        {
+            std::lock_guard<std::mutex> lock(_loadPrioritiesMutex);
+            _loadPriorities.clear();
+            changed = updateCachedLoadPriority();
+        }
+        notifyLoadPriorityChanged(changed);
         _loaded = true;
     } else {
         _failedToLoad = true;
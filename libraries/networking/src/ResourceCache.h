@@ -33,6 +33,7 @@
 #include <DependencyManager.h>
 
 #include "ResourceManager.h"
+#include "ResourceScheduler.h"
 
 Q_DECLARE_METATYPE(size_t)
 
@@ -77,14 +78,23 @@ public:
     uint32_t getLoadingRequestsCount() const;
     void clear();
 
+    ResourceScheduler& getScheduler() { return _scheduler; }
+    ResourceScheduler::Stats getStageStats(ResourceScheduler::Stage stage) const;
+
 private:
     ResourceCacheSharedItems() = default;
 
+    struct PendingRequest {
+        QWeakPointer<Resource> resource;
+        quint64 queuedUsecs;
+    };
+
     mutable Mutex _mutex;
-    QList<QWeakPointer<Resource>> _pendingRequests;
+    QList<PendingRequest> _pendingRequests;
     QList<QWeakPointer<Resource>> _loadingRequests;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+    ResourceScheduler _scheduler;
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -219,6 +229,11 @@ public:
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
 
+    /// Queues job for resource on the DECODE or UPLOAD stage of the shared scheduler, see ResourceScheduler
+    static void schedule(ResourceScheduler::Stage stage, const QWeakPointer<Resource>& resource, ResourceScheduler::Job job);
+    static ResourceScheduler::Stats getStageStats(ResourceScheduler::Stage stage);
+    static void setMaxDecodeJobs(int maxJobs);
+
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
     
@@ -432,6 +447,12 @@ public:
     /// Returns the highest load priority across all owners.
     float getLoadPriority();
 
+    /// Returns the highest load priority across all owners as of their last change, without locking
+    float getCachedLoadPriority() const { return _cachedLoadPriority; }
+
+    /// Returns the load priorities of all owners.
+    QHash<QPointer<QObject>, float> getLoadPriorities();
+
     /// Checks whether the resource has loaded.
     virtual bool isLoaded() const { return _loaded; }
 
@@ -534,7 +555,11 @@ protected:
     bool _failedToLoad = false;
     bool _loaded = false;
 
+    // guarded by _loadPrioritiesMutex, since they are read from the threads of the network stage
     QHash<QPointer<QObject>, float> _loadPriorities;
+    std::mutex _loadPrioritiesMutex;
+    // the highest of _loadPriorities, for the ResourceScheduler to order its queues by without locking
+    std::atomic<float> _cachedLoadPriority { 0.0f };
     QWeakPointer<Resource> _self;
     QPointer<ResourceCache> _cache;
 
@@ -560,6 +585,12 @@ private:
     void retry();
     void reinsert();
 
+    // recomputes _cachedLoadPriority from _loadPriorities, dropping the owners that are gone, and returns whether it
+    // changed; must be called with _loadPrioritiesMutex held
+    bool updateCachedLoadPriority();
+    // lets the scheduler move the jobs queued for us after our priority changed
+    void notifyLoadPriorityChanged(bool changed);
+
     bool isInScript() const { return _isInScript; }
     void setInScript(bool isInScript) { _isInScript = isInScript; }
     
@@ -0,0 +1,320 @@
+//
+//  ResourceScheduler.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+
+#include <glm/glm.hpp>
+
+#include <SharedUtil.h>
+#include <StatTracker.h>
+
+#include "ResourceCache.h"
+
+const quint64 ResourceScheduler::DEFAULT_UPLOAD_BUDGET_USECS = 2 * USECS_PER_MSEC;
+
+// weight of the latest wait in the average wait of a stage
+static const float WAIT_AVERAGE_WEIGHT = 0.1f;
+
+namespace {
+    // every live scheduler, so that a resource can report its priority changes to the ones holding its jobs
+    struct Schedulers {
+        std::mutex mutex;
+        std::vector<ResourceScheduler*> schedulers;
+    };
+
+    // function local, so that it is constructed before, and destroyed after, any scheduler
+    Schedulers& getSchedulers() {
+        static Schedulers schedulers;
+        return schedulers;
+    }
+}
+
+class DecodeWorker : public QRunnable {
+public:
+    DecodeWorker(ResourceScheduler* scheduler) : _scheduler(scheduler) {}
+    void run() override { _scheduler->runDecodeJobs(); }
+
+private:
+    ResourceScheduler* _scheduler;
+};
+
+ResourceScheduler::ResourceScheduler() {
+    _maxDecodeJobs = std::max(1, QThread::idealThreadCount() - 1);
+    _decodePool.setMaxThreadCount(_maxDecodeJobs);
+
+    auto& schedulers = getSchedulers();
+    std::lock_guard<std::mutex> lock(schedulers.mutex);
+    schedulers.schedulers.push_back(this);
+}
+
+ResourceScheduler::~ResourceScheduler() {
+    {
+        auto& schedulers = getSchedulers();
+        std::lock_guard<std::mutex> lock(schedulers.mutex);
+        schedulers.schedulers.erase(std::remove(schedulers.schedulers.begin(), schedulers.schedulers.end(), this),
+                                    schedulers.schedulers.end());
+    }
+    {
+        Lock lock(_mutex);
+        auto& decodeQueue = _stages[DECODE].queue;
+        if (!decodeQueue.empty()) {
+            DependencyManager::get<StatTracker>()->updateStat("PendingProcessing", -(int)decodeQueue.size());
+            decodeQueue.clear();
+        }
+        _stages[UPLOAD].queue.clear();
+        _jobsByResource.clear();
+    }
+    _decodePool.waitForDone();
+}
+
+QString ResourceScheduler::getStageName(Stage stage) {
+    switch (stage) {
+        case NETWORK:
+            return "network";
+        case DECODE:
+            return "decode";
+        case UPLOAD:
+            return "upload";
+        default:
+            return "unknown";
+    }
+}
+
+void ResourceScheduler::schedule(Stage stage, const QWeakPointer<Resource>& resource, Job job) {
+    Q_ASSERT(stage == DECODE || stage == UPLOAD);
+
+    // held until after the lock is released, in case it turns out to be the last reference to the resource
+    auto strongResource = resource.toStrongRef();
+    const Resource* resourceKey = strongResource.data();
+
+    Lock lock(_mutex);
+    // the priority is read under our lock, as loadPriorityChanged reads it, so that neither can miss a change
+    JobKey key { resourceKey ? resourceKey->getCachedLoadPriority() : 0.0f, _nextSequence++ };
+    _stages[stage].queue.emplace(key, QueuedJob { resource, resourceKey, job, usecTimestampNow() });
+    if (resourceKey) {
+        _jobsByResource.emplace(resourceKey, std::make_pair(stage, key));
+    }
+
+    if (stage == DECODE) {
+        DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
+        if (_numDecodeWorkers < _maxDecodeJobs) {
+            ++_numDecodeWorkers;
+            _decodePool.start(new DecodeWorker(this));
+        }
+    } else if (!_uploadsPending) {
+        _uploadsPending = true;
+        QMetaObject::invokeMethod(this, "processUploads", Qt::QueuedConnection);
+    }
+}
+
+void ResourceScheduler::setMaxDecodeJobs(int maxJobs) {
+    maxJobs = std::max(1, maxJobs);
+
+    Lock lock(_mutex);
+    _maxDecodeJobs = maxJobs;
+    _decodePool.setMaxThreadCount(maxJobs);
+
+    // start workers for the new slots when work is waiting for them
+    while (_numDecodeWorkers < _maxDecodeJobs && _numDecodeWorkers < (int)_stages[DECODE].queue.size()) {
+        ++_numDecodeWorkers;
+        _decodePool.start(new DecodeWorker(this));
+    }
+}
+
+int ResourceScheduler::getMaxDecodeJobs() const {
+    Lock lock(_mutex);
+    return _maxDecodeJobs;
+}
+
+ResourceScheduler::Stats ResourceScheduler::getStats(Stage stage) const {
+    Stats stats;
+    if (stage < 0 || stage >= NUM_STAGES) {
+        return stats;
+    }
+
+    Lock lock(_mutex);
+    const auto& state = _stages[stage];
+    stats.queueDepth = (uint32_t)state.queue.size();
+    stats.active = state.active;
+    stats.numStarted = state.numStarted;
+    stats.numCancelled = state.numCancelled;
+    stats.averageWaitMsecs = state.averageWaitUsecs / (float)USECS_PER_MSEC;
+    stats.maxWaitMsecs = (float)state.maxWaitUsecs / (float)USECS_PER_MSEC;
+    return stats;
+}
+
+void ResourceScheduler::resetStats() {
+    Lock lock(_mutex);
+    for (auto& state : _stages) {
+        state.maxWaitUsecs = 0;
+    }
+}
+
+void ResourceScheduler::recordStarted(Stage stage, quint64 queuedUsecs) {
+    Lock lock(_mutex);
+    recordStartedLocked(_stages[stage], queuedUsecs);
+}
+
+void ResourceScheduler::recordCancelled(Stage stage) {
+    Lock lock(_mutex);
+    ++_stages[stage].numCancelled;
+}
+
+void ResourceScheduler::waitForDecodeJobs() {
+    _decodePool.waitForDone();
+}
+
+void ResourceScheduler::loadPriorityChanged(const Resource* resource) {
+    auto& schedulers = getSchedulers();
+    std::lock_guard<std::mutex> lock(schedulers.mutex);
+    for (auto scheduler : schedulers.schedulers) {
+        scheduler->reprioritize(resource);
+    }
+}
+
+void ResourceScheduler::resourceDestroyed(const Resource* resource) {
+    auto& schedulers = getSchedulers();
+    std::lock_guard<std::mutex> lock(schedulers.mutex);
+    for (auto scheduler : schedulers.schedulers) {
+        scheduler->forgetResource(resource);
+    }
+}
+
+void ResourceScheduler::forgetResource(const Resource* resource) {
+    Lock lock(_mutex);
+    auto range = _jobsByResource.equal_range(resource);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto& queue = _stages[it->second.first].queue;
+        auto queued = queue.find(it->second.second);
+        if (queued != queue.end()) {
+            queued->second.resourceKey = nullptr;
+        }
+    }
+    _jobsByResource.erase(range.first, range.second);
+}
+
+void ResourceScheduler::reprioritize(const Resource* resource) {
+    Lock lock(_mutex);
+    auto range = _jobsByResource.equal_range(resource);
+    if (range.first == range.second) {
+        return;
+    }
+
+    float priority = resource->getCachedLoadPriority();
+    for (auto it = range.first; it != range.second; ++it) {
+        auto& queue = _stages[it->second.first].queue;
+        JobKey& key = it->second.second;
+        if (key.priority == priority) {
+            continue;
+        }
+        auto queued = queue.find(key);
+        if (queued == queue.end()) {
+            continue;
+        }
+        QueuedJob queuedJob = std::move(queued->second);
+        queue.erase(queued);
+        key.priority = priority;
+        queue.emplace(key, std::move(queuedJob));
+    }
+}
+
+void ResourceScheduler::removeFromJobsByResource(const Resource* resource, Stage stage, const JobKey& key) {
+    if (!resource) {
+        return;
+    }
+    auto range = _jobsByResource.equal_range(resource);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.first == stage && it->second.second.sequence == key.sequence) {
+            _jobsByResource.erase(it);
+            return;
+        }
+    }
+}
+
+void ResourceScheduler::recordStartedLocked(StageState& state, quint64 queuedUsecs) {
+    auto now = usecTimestampNow();
+    auto wait = now > queuedUsecs ? now - queuedUsecs : 0;
+    state.averageWaitUsecs = state.numStarted == 0 ? (float)wait :
+        glm::mix(state.averageWaitUsecs, (float)wait, WAIT_AVERAGE_WEIGHT);
+    ++state.numStarted;
+    state.maxWaitUsecs = std::max(state.maxWaitUsecs, wait);
+}
+
+bool ResourceScheduler::takeHighestPriorityJob(Stage stage, Job& job) {
+    auto& state = _stages[stage];
+
+    while (!state.queue.empty()) {
+        auto first = state.queue.begin();
+        JobKey key = first->first;
+        QueuedJob queuedJob = std::move(first->second);
+        state.queue.erase(first);
+        removeFromJobsByResource(queuedJob.resourceKey, stage, key);
+        if (stage == DECODE) {
+            DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
+        }
+
+        // Drop the jobs of resources nobody holds anymore, without taking a reference that we could end up releasing here
+        if (queuedJob.resource.isNull()) {
+            ++state.numCancelled;
+            continue;
+        }
+
+        recordStartedLocked(state, queuedJob.queuedUsecs);
+        ++state.active;
+        job = std::move(queuedJob.job);
+        return true;
+    }
+    return false;
+}
+
+void ResourceScheduler::runDecodeJobs() {
+    Lock lock(_mutex);
+    auto& state = _stages[DECODE];
+    Job job;
+    while (_numDecodeWorkers <= _maxDecodeJobs && takeHighestPriorityJob(DECODE, job)) {
+        lock.unlock();
+        {
+            CounterStat counter("Processing");
+            job();
+            job = Job();
+        }
+        lock.lock();
+        --state.active;
+    }
+    --_numDecodeWorkers;
+}
+
+void ResourceScheduler::processUploads() {
+    auto start = usecTimestampNow();
+
+    Lock lock(_mutex);
+    auto& state = _stages[UPLOAD];
+    Job job;
+    while (takeHighestPriorityJob(UPLOAD, job)) {
+        lock.unlock();
+        job();
+        job = Job();
+        lock.lock();
+        --state.active;
+
+        if (usecTimestampNow() - start > _uploadBudgetUsecs && !state.queue.empty()) {
+            // leave the rest for the next pass, so that the event loop gets to run in between
+            QMetaObject::invokeMethod(this, "processUploads", Qt::QueuedConnection);
+            return;
+        }
+    }
+    _uploadsPending = false;
+}
@@ -0,0 +1,151 @@
+//
+//  ResourceScheduler.h
+//  libraries/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ResourceScheduler_h
+#define hifi_ResourceScheduler_h
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <QtCore/QObject>
+#include <QtCore/QThreadPool>
+#include <QtCore/QWeakPointer>
+
+class Resource;
+
+// Runs the work that turns downloaded resources into usable ones, in stages that each have their own bounded set of
+// workers so that a burst of one kind of work can't starve the others:
+//  - NETWORK: downloads, queued by ResourceCacheSharedItems under its request limit, which only reports to the scheduler
+//  - DECODE: parsing and processing of the downloaded data, on a dedicated thread pool
+//  - UPLOAD: handing the results over to their resources, on the thread the scheduler lives on, within a time budget per pass
+//
+// Queued jobs start in order of the current load priority of their resource: resources report their priority changes as the
+// viewer moves, and the jobs they have waiting are moved accordingly. A job whose resource has been released by the time it
+// would start is dropped without running.
+class ResourceScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    enum Stage {
+        NETWORK = 0,
+        DECODE,
+        UPLOAD,
+        NUM_STAGES
+    };
+
+    using Job = std::function<void()>;
+
+    struct Stats {
+        uint32_t queueDepth { 0 };
+        uint32_t active { 0 };
+        uint64_t numStarted { 0 };
+        uint64_t numCancelled { 0 };
+        float averageWaitMsecs { 0.0f };
+        float maxWaitMsecs { 0.0f };
+    };
+
+    static const quint64 DEFAULT_UPLOAD_BUDGET_USECS;
+
+    ResourceScheduler();
+    ~ResourceScheduler();
+
+    static QString getStageName(Stage stage);
+
+    /// Queues job on the DECODE or UPLOAD stage, for resource
+    void schedule(Stage stage, const QWeakPointer<Resource>& resource, Job job);
+
+    /// The number of DECODE jobs that may run at the same time, one less than the number of cores by default
+    void setMaxDecodeJobs(int maxJobs);
+    int getMaxDecodeJobs() const;
+
+    /// The time the UPLOAD stage may spend running jobs before yielding back to the event loop
+    void setUploadBudget(quint64 usecs) { _uploadBudgetUsecs = usecs; }
+    quint64 getUploadBudget() const { return _uploadBudgetUsecs; }
+
+    /// The depth and activity of a stage, and how long its jobs waited to start: the average over the recent jobs and the
+    /// longest wait since the last resetStats()
+    Stats getStats(Stage stage) const;
+    void resetStats();
+
+    // the NETWORK stage keeps its own queue, and reports the jobs it starts or drops here
+    void recordStarted(Stage stage, quint64 queuedUsecs);
+    void recordCancelled(Stage stage);
+
+    /// Blocks until the DECODE stage is idle; UPLOAD jobs it queued still need the event loop to run
+    void waitForDecodeJobs();
+
+    /// Moves the jobs queued for resource, on every scheduler, to its current priority; called by Resource
+    static void loadPriorityChanged(const Resource* resource);
+
+    /// Forgets resource, on every scheduler, so that a resource later allocated at the same address can't pick up its jobs;
+    /// called by Resource when it is destroyed. Its queued jobs stay queued, to be dropped when they come up.
+    static void resourceDestroyed(const Resource* resource);
+
+private slots:
+    void processUploads();
+
+private:
+    friend class DecodeWorker;
+
+    struct QueuedJob {
+        QWeakPointer<Resource> resource;
+        const Resource* resourceKey; // only to find the entry in _jobsByResource, never dereferenced
+        Job job;
+        quint64 queuedUsecs;
+    };
+
+    // highest priority first, and the first queued first among the jobs of the same priority
+    struct JobKey {
+        float priority;
+        uint64_t sequence;
+
+        bool operator<(const JobKey& other) const {
+            return priority > other.priority || (priority == other.priority && sequence < other.sequence);
+        }
+    };
+
+    struct StageState {
+        std::map<JobKey, QueuedJob> queue;
+        uint32_t active { 0 };
+        uint64_t numStarted { 0 };
+        uint64_t numCancelled { 0 };
+        float averageWaitUsecs { 0.0f };
+        quint64 maxWaitUsecs { 0 };
+    };
+
+    using Mutex = std::mutex;
+    using Lock = std::unique_lock<Mutex>;
+
+    // pops the job of the highest priority resource from the queue of stage, dropping the jobs of released resources;
+    // must be called with _mutex held
+    bool takeHighestPriorityJob(Stage stage, Job& job);
+    void removeFromJobsByResource(const Resource* resource, Stage stage, const JobKey& key);
+    void reprioritize(const Resource* resource);
+    void forgetResource(const Resource* resource);
+    void recordStartedLocked(StageState& state, quint64 queuedUsecs);
+    void runDecodeJobs();
+
+    mutable Mutex _mutex;
+    std::array<StageState, NUM_STAGES> _stages;
+    // where the jobs of each resource are queued, so that they can be moved when its priority changes
+    std::unordered_multimap<const Resource*, std::pair<Stage, JobKey>> _jobsByResource;
+    uint64_t _nextSequence { 0 };
+    int _maxDecodeJobs { 1 };
+    int _numDecodeWorkers { 0 };
+    bool _uploadsPending { false };
+    std::atomic<quint64> _uploadBudgetUsecs { DEFAULT_UPLOAD_BUDGET_USECS };
+    QThreadPool _decodePool;
+};
+
+#endif // hifi_ResourceScheduler_h
@@ -43,7 +43,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::KillAvatar:
             return static_cast<PacketVersion>(AvatarMixerPacketVersion::ARKitBlendshapes);
         case PacketType::MessagesData:
-            return static_cast<PacketVersion>(MessageDataVersion::TextOrBinaryData);
+            return static_cast<PacketVersion>(MessageDataVersion::BatchedMessages);
         // ICE packets
         case PacketType::ICEServerPeerInformation:
             return 17;
@@ -391,7 +391,8 @@ enum class AudioVersion : PacketVersion {
 };
 
 enum class MessageDataVersion : PacketVersion {
-    TextOrBinaryData = 18
+    TextOrBinaryData = 18,
+    BatchedMessages
 };
 
 enum class IcePingVersion : PacketVersion {
@@ -30,6 +30,7 @@
 //#define UDT_CONNECTION_DEBUG
 
 class UDTTest;
+class UDTBenchmark;
 
 namespace udt {
 
@@ -112,7 +113,7 @@ private:
     void setSystemBufferSizes();
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreation = false);
    
-    // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
+    // privatized methods used by UDTTest and UDTBenchmark - they are private since they must be called on the Socket thread
     ConnectionStats::Stats sampleStatsForConnection(const HifiSockAddr& destination);
     
     std::vector<HifiSockAddr> getConnectionSockAddrs();
@@ -148,6 +149,7 @@ private:
     HifiSockAddr _lastPacketSockAddr;
     
     friend UDTTest;
+    friend UDTBenchmark;
 };
     
 } // namespace udt
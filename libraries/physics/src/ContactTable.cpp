@@ -0,0 +1,160 @@
+//
+//  ContactTable.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactTable.h"
+
+#include <assert.h>
+
+const size_t ContactTable::MIN_CAPACITY;
+
+static size_t roundUpToPowerOfTwo(size_t n) {
+    size_t result = ContactTable::MIN_CAPACITY;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
+ContactTable::ContactTable(size_t initialCapacity) {
+    size_t capacity = roundUpToPowerOfTwo(initialCapacity);
+    _slots.resize(capacity);
+    _mask = capacity - 1;
+}
+
+size_t ContactTable::hashKey(const ContactKey& key) const {
+    // the pointers are at least 8-byte aligned so mix all of their bits down into the low ones
+    uint64_t h = (uint64_t)(uintptr_t)key._a * 0x9E3779B97F4A7C15ULL + (uint64_t)(uintptr_t)key._b;
+    h ^= h >> 32;
+    h *= 0xD6E8FEB86659FD93ULL;
+    h ^= h >> 32;
+    return (size_t)h & _mask;
+}
+
+size_t ContactTable::nextOccupied(size_t index) const {
+    size_t numSlots = _slots.size();
+    while (index < numSlots && !isOccupied(_slots[index])) {
+        ++index;
+    }
+    return index;
+}
+
+ContactTable::iterator ContactTable::find(const ContactKey& key) {
+    size_t index = hashKey(key);
+    while (true) {
+        const Slot& slot = _slots[index];
+        if (isFree(slot)) {
+            return end();
+        }
+        if (!slot.erased && slot.entry.first == key) {
+            return iterator(this, index);
+        }
+        index = (index + 1) & _mask;
+    }
+}
+
+ContactInfo& ContactTable::operator[](const ContactKey& key) {
+    // keep at least a quarter of the slots free so probe sequences stay short and always terminate
+    if ((_numEntries + _numTombstones + 1) * 4 > _slots.size() * 3) {
+        size_t newCapacity = _slots.size();
+        if ((_numEntries + 1) * 2 > newCapacity) {
+            newCapacity *= 2;
+        }
+        rehash(newCapacity);
+    }
+
+    size_t index = hashKey(key);
+    Slot* tombstone = nullptr;
+    while (true) {
+        Slot& slot = _slots[index];
+        if (isFree(slot)) {
+            break;
+        }
+        if (slot.erased) {
+            if (!tombstone) {
+                tombstone = &slot;
+            }
+        } else if (slot.entry.first == key) {
+            return slot.entry.second;
+        }
+        index = (index + 1) & _mask;
+    }
+
+    Slot* slot = &_slots[index];
+    if (tombstone) {
+        slot = tombstone;
+        --_numTombstones;
+    }
+    slot->entry.first = key;
+    slot->entry.second = ContactInfo();
+    slot->generation = _generation;
+    slot->erased = false;
+    ++_numEntries;
+    return slot->entry.second;
+}
+
+ContactTable::iterator ContactTable::erase(iterator itr) {
+    assert(itr._table == this && isOccupied(_slots[itr._index]));
+    --_numEntries;
+    if (_numEntries == 0) {
+        clear();
+        return end();
+    }
+
+    Slot& slot = _slots[itr._index];
+    if (isFree(_slots[(itr._index + 1) & _mask])) {
+        // nothing probes past this slot so it can be freed outright
+        slot.generation = 0;
+    } else {
+        slot.erased = true;
+        ++_numTombstones;
+    }
+    return ++itr;
+}
+
+void ContactTable::clear() {
+    _numEntries = 0;
+    _numTombstones = 0;
+    ++_generation;
+    if (_generation == 0) {
+        // the counter wrapped so old stamps could match again: reset them all
+        for (auto& slot : _slots) {
+            slot.generation = 0;
+        }
+        _generation = 1;
+    }
+}
+
+void ContactTable::reserve(size_t numEntries) {
+    size_t capacity = roundUpToPowerOfTwo(numEntries * 2);
+    if (capacity > _slots.size()) {
+        rehash(capacity);
+    }
+}
+
+void ContactTable::rehash(size_t newCapacity) {
+    // the old slots move into _spareSlots and the next rehash of the same size reuses that storage
+    _spareSlots.swap(_slots);
+    _slots.assign(newCapacity, Slot());
+    _mask = newCapacity - 1;
+    _numTombstones = 0;
+
+    for (const auto& oldSlot : _spareSlots) {
+        if (isOccupied(oldSlot)) {
+            size_t index = hashKey(oldSlot.entry.first);
+            while (!isFree(_slots[index])) {
+                index = (index + 1) & _mask;
+            }
+            Slot& slot = _slots[index];
+            slot.entry = oldSlot.entry;
+            slot.generation = _generation;
+            slot.erased = false;
+        }
+    }
+}
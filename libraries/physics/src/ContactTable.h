@@ -0,0 +1,107 @@
+//
+//  ContactTable.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContactTable_h
+#define hifi_ContactTable_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "ContactInfo.h"
+
+// simple class for keeping track of contacts
+class ContactKey {
+public:
+    ContactKey() = delete;
+    ContactKey(void* a, void* b) : _a(a), _b(b) {}
+    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
+    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
+    void* _a; // ObjectMotionState pointer
+    void* _b; // ObjectMotionState pointer
+};
+
+// Open-addressing hash table of ContactInfo by ContactKey, used in place of std::map so that updating thousands of
+// contacts every substep touches one flat array and does not allocate once the table has grown to size.
+//
+// Each slot carries the generation it was written in: a slot is only occupied when its generation matches the
+// table's, so clear() is a counter bump.  Erased slots become tombstones rather than shifting their neighbours,
+// which keeps iterators valid across erase() the way the std::map loops in PhysicsEngine expect.
+class ContactTable {
+public:
+    struct Entry {
+        Entry() : first(nullptr, nullptr) {}
+        ContactKey first;
+        ContactInfo second;
+    };
+
+private:
+    struct Slot {
+        Entry entry;
+        uint32_t generation { 0 };
+        bool erased { false };
+    };
+
+public:
+    class iterator {
+    public:
+        iterator() {}
+        Entry& operator*() const { return _table->_slots[_index].entry; }
+        Entry* operator->() const { return &(_table->_slots[_index].entry); }
+        iterator& operator++() { _index = _table->nextOccupied(_index + 1); return *this; }
+        bool operator==(const iterator& other) const { return _index == other._index; }
+        bool operator!=(const iterator& other) const { return _index != other._index; }
+    private:
+        friend class ContactTable;
+        iterator(ContactTable* table, size_t index) : _table(table), _index(index) {}
+        ContactTable* _table { nullptr };
+        size_t _index { 0 };
+    };
+
+    explicit ContactTable(size_t initialCapacity = MIN_CAPACITY);
+
+    size_t size() const { return _numEntries; }
+    bool empty() const { return _numEntries == 0; }
+    size_t capacity() const { return _slots.size(); }
+
+    iterator begin() { return iterator(this, nextOccupied(0)); }
+    iterator end() { return iterator(this, _slots.size()); }
+
+    iterator find(const ContactKey& key);
+
+    // returns the ContactInfo for key, default-constructing it when the pair is new
+    ContactInfo& operator[](const ContactKey& key);
+
+    // returns an iterator to the entry after itr
+    iterator erase(iterator itr);
+
+    void clear();
+
+    // grow so that numEntries contacts fit without rehashing
+    void reserve(size_t numEntries);
+
+    static const size_t MIN_CAPACITY = 64;
+
+private:
+    bool isOccupied(const Slot& slot) const { return slot.generation == _generation && !slot.erased; }
+    bool isFree(const Slot& slot) const { return slot.generation != _generation; }
+    size_t nextOccupied(size_t index) const;
+    size_t hashKey(const ContactKey& key) const;
+    void rehash(size_t newCapacity);
+
+    std::vector<Slot> _slots;
+    std::vector<Slot> _spareSlots;
+    size_t _mask { 0 };
+    size_t _numEntries { 0 };
+    size_t _numTombstones { 0 };
+    uint32_t _generation { 1 };
+};
+
+#endif // hifi_ContactTable_h
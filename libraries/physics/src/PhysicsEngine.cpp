@@ -18,15 +18,21 @@
 #include <PerfStat.h>
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
 #include "PhysicsHelpers.h"
 #include "PhysicsDebugDraw.h"
+#include "PhysicsTaskScheduler.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "PhysicsLogging.h"
 
+// narrowphase pairs per job when the collision dispatcher runs multithreaded
+const int COLLISION_DISPATCHER_GRAIN_SIZE = 40;
+
 PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
         _originOffset(offset),
         _myAvatarController(nullptr) {
@@ -38,17 +44,50 @@ PhysicsEngine::~PhysicsEngine() {
     delete _collisionDispatcher;
     delete _broadphaseFilter;
     delete _constraintSolver;
+    delete _constraintSolverMt;
     delete _dynamicsWorld;
     delete _ghostPairCallback;
+    if (_taskScheduler) {
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        _taskScheduler.reset();
+    }
 }
 
-void PhysicsEngine::init() {
+void PhysicsEngine::init(int numThreads) {
     if (!_dynamicsWorld) {
+#if BT_THREADSAFE
+        bool multithreaded = numThreads > 1;
+#else
+        if (numThreads > 1) {
+            qCWarning(physics) << "PhysicsEngine: Bullet was built without BT_THREADSAFE, stepping on one thread";
+        }
+        bool multithreaded = false;
+#endif
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
-        _constraintSolver = new btSequentialImpulseConstraintSolver;
-        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+        btConstraintSolverPoolMt* solverPool = nullptr;
+        if (multithreaded) {
+            // the task scheduler is global to Bullet, so there should only ever be one multithreaded engine
+            assert(btGetTaskScheduler() == btGetSequentialTaskScheduler());
+            _taskScheduler.reset(new PhysicsTaskScheduler());
+            _taskScheduler->setNumThreads(numThreads);
+            btSetTaskScheduler(_taskScheduler.get());
+
+            _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig, COLLISION_DISPATCHER_GRAIN_SIZE);
+            solverPool = new btConstraintSolverPoolMt(_taskScheduler->getNumThreads());
+            _constraintSolver = solverPool;
+            _constraintSolverMt = new btSequentialImpulseConstraintSolverMt();
+            qCDebug(physics) << "PhysicsEngine: stepping on" << _taskScheduler->getNumThreads() << "threads";
+        } else {
+            _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+            _constraintSolver = new btSequentialImpulseConstraintSolver();
+        }
+        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, solverPool,
+                                                     _constraintSolverMt, _collisionConfig, multithreaded);
+        if (!multithreaded) {
+            // one thread solves one island at a time, so it has no use for a pool of solvers to pick from and lock
+            _dynamicsWorld->setConstraintSolver(_constraintSolver);
+        }
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -470,6 +509,7 @@ void PhysicsEngine::updateContactMap() {
 
     // update all contacts every frame
     int numManifolds = _collisionDispatcher->getNumManifolds();
+    _contactMap.reserve(_contactMap.size() + numManifolds);
     for (int i = 0; i < numManifolds; ++i) {
         btPersistentManifold* contactManifold =  _collisionDispatcher->getManifoldByIndexInternal(i);
         if (contactManifold->getNumContacts() > 0) {
@@ -547,7 +587,9 @@ void PhysicsEngine::doOwnershipInfectionForConstraints() {
 }
 
 const CollisionEvents& PhysicsEngine::getCollisionEvents() {
+    // _collisionEvents keeps its capacity from step to step and there is at most one event per contact
     _collisionEvents.clear();
+    _collisionEvents.reserve(_contactMap.size());
 
     // scan known contacts and trigger events
     ContactMap::iterator contactItr = _contactMap.begin();
@@ -577,7 +619,7 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
                 glm::vec3 velocityChange = motionStateA->getObjectLinearVelocityChange() +
                     (motionStateB ? motionStateB->getObjectLinearVelocityChange() : glm::vec3(0.0f));
                 glm::vec3 penetration = bulletToGLM(contact.distance * contact.normalWorldOnB);
-                _collisionEvents.push_back(Collision(type, idA, idB, position, penetration, velocityChange));
+                _collisionEvents.emplace_back(type, idA, idB, position, penetration, velocityChange);
             } else if (motionStateB && (motionStateB->isLocallyOwnedOrShouldBe())) {
                 QUuid idB = motionStateB->getObjectID();
                 QUuid idA;
@@ -590,7 +632,7 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
                 // NOTE: we're flipping the order of A and B (so that the first objectID is never NULL)
                 // hence we negate the penetration (because penetration always points from B to A).
                 glm::vec3 penetration = - bulletToGLM(contact.distance * contact.normalWorldOnB);
-                _collisionEvents.push_back(Collision(type, idB, idA, position, penetration, velocityChange));
+                _collisionEvents.emplace_back(type, idB, idA, position, penetration, velocityChange);
             }
         }
 
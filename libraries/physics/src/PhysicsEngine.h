@@ -21,7 +21,7 @@
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
 #include "BulletUtil.h"
-#include "ContactInfo.h"
+#include "ContactTable.h"
 #include "ObjectMotionState.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "ObjectAction.h"
@@ -31,17 +31,7 @@ const float HALF_SIMULATION_EXTENT = 512.0f; // meters
 
 class CharacterController;
 class PhysicsDebugDraw;
-
-// simple class for keeping track of contacts
-class ContactKey {
-public:
-    ContactKey() = delete;
-    ContactKey(void* a, void* b) : _a(a), _b(b) {}
-    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
-    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
-    void* _a; // ObjectMotionState pointer
-    void* _b; // ObjectMotionState pointer
-};
+class PhysicsTaskScheduler;
 
 struct ContactTestResult {
     ContactTestResult() = delete;
@@ -69,7 +59,7 @@ struct ContactTestResult {
     glm::vec3 collisionNormal;
 };
 
-using ContactMap = std::map<ContactKey, ContactInfo>;
+using ContactMap = ContactTable;
 using CollisionEvents = std::vector<Collision>;
 
 class PhysicsEngine {
@@ -94,7 +84,10 @@ public:
 
     PhysicsEngine(const glm::vec3& offset);
     ~PhysicsEngine();
-    void init();
+
+    // numThreads > 1 steps the simulation on that many threads, when Bullet was built with BT_THREADSAFE.
+    void init(int numThreads = 1);
+    bool isMultithreaded() const { return _dynamicsWorld && _dynamicsWorld->isMultithreaded(); }
 
     uint32_t getNumSubsteps() const;
     int32_t getNumCollisionObjects() const;
@@ -172,10 +165,12 @@ private:
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
-    btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolver* _constraintSolverMt = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
+    std::unique_ptr<PhysicsTaskScheduler> _taskScheduler;
 
     ContactMap _contactMap;
     CollisionEvents _collisionEvents;
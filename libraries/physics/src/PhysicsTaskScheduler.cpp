@@ -0,0 +1,78 @@
+//
+//  PhysicsTaskScheduler.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsTaskScheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <LinearMath/btQuickprof.h>
+#include <tbb/parallel_reduce.h>
+
+#include <TBBHelpers.h>
+
+namespace {
+    struct ForBodyAdapter {
+        const btIParallelForBody* body;
+
+        void operator()(const tbb::blocked_range<int>& range) const {
+            BT_PROFILE("PhysicsTaskScheduler::forLoop");
+            body->forLoop(range.begin(), range.end());
+        }
+    };
+
+    struct SumBodyAdapter {
+        const btIParallelSumBody* body;
+        btScalar sum { btScalar(0) };
+
+        SumBodyAdapter(const btIParallelSumBody* bodyIn) : body(bodyIn) {}
+        SumBodyAdapter(const SumBodyAdapter& src, tbb::split) : body(src.body) {}
+
+        void join(const SumBodyAdapter& src) { sum += src.sum; }
+        void operator()(const tbb::blocked_range<int>& range) {
+            BT_PROFILE("PhysicsTaskScheduler::sumLoop");
+            sum += body->sumLoop(range.begin(), range.end());
+        }
+    };
+}
+
+PhysicsTaskScheduler::PhysicsTaskScheduler() : btITaskScheduler("PhysicsTaskScheduler") {
+    setNumThreads(getMaxNumThreads());
+}
+
+PhysicsTaskScheduler::~PhysicsTaskScheduler() {
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const {
+    // Bullet hands out per-thread scratch by thread index, which it caps at BT_MAX_THREAD_COUNT
+    int hardwareThreads = std::max((int)std::thread::hardware_concurrency(), 1);
+    return std::min(hardwareThreads, (int)BT_MAX_THREAD_COUNT);
+}
+
+void PhysicsTaskScheduler::setNumThreads(int numThreads) {
+    _numThreads = std::max(std::min(numThreads, getMaxNumThreads()), 1);
+    // an arena bounds how many of the shared TBB workers physics may occupy at once
+    _arena.reset(new tbb::task_arena(_numThreads));
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    ForBodyAdapter adapter { &body };
+    _arena->execute([&] {
+        tbb::parallel_for(tbb::blocked_range<int>(iBegin, iEnd, grainSize), adapter);
+    });
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    SumBodyAdapter adapter(&body);
+    _arena->execute([&] {
+        tbb::parallel_reduce(tbb::blocked_range<int>(iBegin, iEnd, grainSize), adapter);
+    });
+    return adapter.sum;
+}
@@ -0,0 +1,225 @@
+//
+//  ShapeCache.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ShapeCache.h"
+
+#include <QFile>
+
+#include <HashKey.h>
+#include <SettingHandle.h>
+
+#include "PhysicsLogging.h"
+
+// Whenever a change is made to the serialized format for the shape cache that isn't backward compatible,
+// this value should be incremented.  This will force the shape cache to be wiped
+const int ShapeCache::CURRENT_VERSION = 0x01;
+const int ShapeCache::INVALID_VERSION = 0x00;
+const char* ShapeCache::SETTING_VERSION_NAME = "hifi.shape.cache_version";
+
+const std::string ShapeCache::DIRNAME { "shape_cache" };
+const std::string ShapeCache::EXT { "shape" };
+
+// Each entry is a header followed by its payload, in native byte order:
+//
+//     HULLS: for each of count hulls: uint32_t numPoints, float margin, numPoints * 3 floats
+//     BVH:   count bytes from btOptimizedBvh::serializeInPlace()
+//
+// The magic number doubles as a byte order check, and swapped entries are treated as misses.
+// sourceHash covers the points and triangles the entry was built from (see computeSourceHash()).
+enum class EntryKind : uint32_t {
+    HULLS = 1,
+    BVH = 2
+};
+
+struct EntryHeader {
+    uint32_t magic;
+    uint32_t version;
+    EntryKind kind;
+    uint32_t count;
+    uint64_t sourceHash;
+};
+
+static const uint32_t SHAPE_CACHE_MAGIC = 0x48465348; // "HFSH"
+static const size_t BVH_ALIGNMENT = 16;
+
+static std::string keyForInfo(const ShapeInfo& info) {
+    return QString::number((qulonglong)info.getHash(), 16).rightJustified(16, '0').toStdString();
+}
+
+static uint64_t computeSourceHash(const ShapeInfo& info) {
+    // hash the exact bits: HashKey::Hasher::hashVec3() quantizes to millimeters, which would miss small edits
+    HashKey::Hasher hasher;
+    for (const auto& points : info.getPointCollection()) {
+        hasher.hashUint64((uint64_t)points.size());
+        for (const auto& point : points) {
+            uint32_t bits[3];
+            memcpy(bits, &point[0], sizeof(bits));
+            hasher.hashUint64(((uint64_t)bits[0] << 32) | bits[1]);
+            hasher.hashUint64(bits[2]);
+        }
+    }
+    const ShapeInfo::TriangleIndices& triangleIndices = info.getTriangleIndices();
+    hasher.hashUint64((uint64_t)triangleIndices.size());
+    for (size_t i = 0; i < triangleIndices.size(); ++i) {
+        hasher.hashUint64((uint64_t)(uint32_t)triangleIndices[i]);
+    }
+    return hasher.getHash64();
+}
+
+static bool readHeader(const QByteArray& data, EntryKind kind, uint64_t sourceHash, EntryHeader& header) {
+    if ((size_t)data.size() < sizeof(EntryHeader)) {
+        return false;
+    }
+    memcpy(&header, data.constData(), sizeof(EntryHeader));
+    return header.magic == SHAPE_CACHE_MAGIC && header.version == (uint32_t)ShapeCache::CURRENT_VERSION &&
+        header.kind == kind && header.sourceHash == sourceHash;
+}
+
+ShapeCache::ShapeCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+void ShapeCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+QByteArray ShapeCache::readEntry(const ShapeInfo& info) {
+    QByteArray data;
+    cache::FilePointer file = getFile(keyForInfo(info));
+    if (file) {
+        QFile entry(QString::fromStdString(file->getFilepath()));
+        if (entry.open(QIODevice::ReadOnly)) {
+            data = entry.readAll();
+        }
+    }
+    return data;
+}
+
+void ShapeCache::writeEntry(const ShapeInfo& info, const QByteArray& data) {
+    // an entry is only written when the existing one is missing or stale, and overwriting it would warn every time
+    auto key = keyForInfo(info);
+    removeFile(key);
+    writeFile(data.constData(), Metadata(key, data.size()));
+}
+
+bool ShapeCache::loadHulls(const ShapeInfo& info, std::vector<btConvexHullShape*>& hulls) {
+    QByteArray data = readEntry(info);
+    EntryHeader header;
+    if (!readHeader(data, EntryKind::HULLS, computeSourceHash(info), header)) {
+        return false;
+    }
+
+    const char* cursor = data.constData() + sizeof(EntryHeader);
+    const char* end = data.constData() + data.size();
+    std::vector<btConvexHullShape*> loadedHulls;
+    loadedHulls.reserve(header.count);
+    for (uint32_t i = 0; i < header.count; ++i) {
+        uint32_t numPoints;
+        float margin;
+        if (end - cursor < (ptrdiff_t)(sizeof(numPoints) + sizeof(margin))) {
+            break;
+        }
+        memcpy(&numPoints, cursor, sizeof(numPoints));
+        cursor += sizeof(numPoints);
+        memcpy(&margin, cursor, sizeof(margin));
+        cursor += sizeof(margin);
+
+        size_t pointsSize = (size_t)numPoints * 3 * sizeof(float);
+        if ((size_t)(end - cursor) < pointsSize) {
+            break;
+        }
+        btConvexHullShape* hull = new btConvexHullShape();
+        hull->setMargin(margin);
+        for (uint32_t j = 0; j < numPoints; ++j) {
+            float point[3];
+            memcpy(point, cursor, sizeof(point));
+            cursor += sizeof(point);
+            hull->addPoint(btVector3(point[0], point[1], point[2]), false);
+        }
+        hull->recalcLocalAabb();
+        loadedHulls.push_back(hull);
+    }
+
+    if (loadedHulls.size() != header.count || cursor != end) {
+        qCWarning(physics) << "ShapeCache: discarding corrupt hulls for" << keyForInfo(info).c_str();
+        for (auto hull : loadedHulls) {
+            delete hull;
+        }
+        return false;
+    }
+    hulls.swap(loadedHulls);
+    return true;
+}
+
+void ShapeCache::saveHulls(const ShapeInfo& info, const std::vector<btConvexHullShape*>& hulls) {
+    EntryHeader header { SHAPE_CACHE_MAGIC, (uint32_t)CURRENT_VERSION, EntryKind::HULLS, (uint32_t)hulls.size(),
+        computeSourceHash(info) };
+    QByteArray data;
+    data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (auto hull : hulls) {
+        if (!hull) {
+            // something went wrong building this shape: don't remember it
+            return;
+        }
+        uint32_t numPoints = (uint32_t)hull->getNumPoints();
+        float margin = hull->getMargin();
+        data.append(reinterpret_cast<const char*>(&numPoints), sizeof(numPoints));
+        data.append(reinterpret_cast<const char*>(&margin), sizeof(margin));
+        const btVector3* points = hull->getUnscaledPoints();
+        for (uint32_t i = 0; i < numPoints; ++i) {
+            float point[3] = { (float)points[i].getX(), (float)points[i].getY(), (float)points[i].getZ() };
+            data.append(reinterpret_cast<const char*>(point), sizeof(point));
+        }
+    }
+    writeEntry(info, data);
+}
+
+btOptimizedBvh* ShapeCache::loadBvh(const ShapeInfo& info, void*& buffer) {
+    buffer = nullptr;
+    QByteArray data = readEntry(info);
+    EntryHeader header;
+    if (!readHeader(data, EntryKind::BVH, computeSourceHash(info), header) ||
+            (size_t)data.size() != sizeof(EntryHeader) + header.count) {
+        return nullptr;
+    }
+
+    // the bvh is deserialized in place, so it needs a buffer of its own with Bullet's alignment
+    buffer = btAlignedAlloc(header.count, BVH_ALIGNMENT);
+    memcpy(buffer, data.constData() + sizeof(EntryHeader), header.count);
+    btOptimizedBvh* bvh = static_cast<btOptimizedBvh*>(btOptimizedBvh::deSerializeInPlace(buffer, header.count, false));
+    if (!bvh) {
+        qCWarning(physics) << "ShapeCache: discarding corrupt bvh for" << keyForInfo(info).c_str();
+        btAlignedFree(buffer);
+        buffer = nullptr;
+    }
+    return bvh;
+}
+
+void ShapeCache::saveBvh(const ShapeInfo& info, btOptimizedBvh* bvh) {
+    if (!bvh) {
+        return;
+    }
+    uint32_t bvhSize = bvh->calculateSerializeBufferSize();
+    void* bvhBuffer = btAlignedAlloc(bvhSize, BVH_ALIGNMENT);
+    if (bvh->serializeInPlace(bvhBuffer, bvhSize, false)) {
+        EntryHeader header { SHAPE_CACHE_MAGIC, (uint32_t)CURRENT_VERSION, EntryKind::BVH, bvhSize, computeSourceHash(info) };
+        QByteArray data;
+        data.reserve(sizeof(header) + bvhSize);
+        data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        data.append(static_cast<const char*>(bvhBuffer), bvhSize);
+        writeEntry(info, data);
+    }
+    btAlignedFree(bvhBuffer);
+}
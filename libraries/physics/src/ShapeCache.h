@@ -0,0 +1,62 @@
+//
+//  ShapeCache.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ShapeCache_h
+#define hifi_ShapeCache_h
+
+#include <memory>
+#include <vector>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <ShapeInfo.h>
+#include <shared/FileCache.h>
+
+// On-disk cache of the expensive parts of collision shapes, keyed by ShapeInfo::getHash():
+// the reduced point sets of convex hulls and the BVHs of static triangle meshes.
+// ShapeFactory consults it before building either, so revisiting a domain skips that work.
+//
+// ShapeInfo::getHash() covers a mesh's url and dimensions but not its points, so each entry also
+// remembers a hash of the points it was built from and is ignored if the model has since changed.
+// The load and save methods may be called from any thread.
+class ShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the serialized format for the shape cache that isn't backward compatible,
+    // this value should be incremented.  This will force the shape cache to be wiped
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+
+    static const std::string DIRNAME;
+    static const std::string EXT;
+
+    ShapeCache(const std::string& dir = DIRNAME, const std::string& ext = EXT);
+
+    void initialize() override;
+
+    /// \return true and fill hulls, in the order they were saved, when the cache has hulls for info
+    bool loadHulls(const ShapeInfo& info, std::vector<btConvexHullShape*>& hulls);
+    void saveHulls(const ShapeInfo& info, const std::vector<btConvexHullShape*>& hulls);
+
+    /// \return the bvh saved for info, deserialized in place inside buffer, or nullptr when the cache has none.
+    /// The bvh lives in buffer, which the caller must free with btAlignedFree() once the bvh is no longer used.
+    btOptimizedBvh* loadBvh(const ShapeInfo& info, void*& buffer);
+    void saveBvh(const ShapeInfo& info, btOptimizedBvh* bvh);
+
+private:
+    QByteArray readEntry(const ShapeInfo& info);
+    void writeEntry(const ShapeInfo& info, const QByteArray& data);
+};
+
+using ShapeCachePointer = std::shared_ptr<ShapeCache>;
+
+#endif // hifi_ShapeCache_h
@@ -14,6 +14,7 @@
 #include <glm/gtx/norm.hpp>
 
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
+#include <TBBHelpers.h>
 
 #include "BulletUtil.h"
 
@@ -27,6 +28,13 @@ public:
         assert(_dataArray);
     }
 
+    // uses a bvh that was deserialized in place inside bvhBuffer rather than building a new one
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, btOptimizedBvh* bvh, void* bvhBuffer)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray), _bvhBuffer(bvhBuffer) {
+        assert(_dataArray);
+        setOptimizedBvh(bvh);
+    }
+
     ~StaticMeshShape() {
         assert(_dataArray);
         IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
@@ -42,11 +50,17 @@ public:
         meshes.clear();
         delete _dataArray;
         _dataArray = nullptr;
+        if (_bvhBuffer) {
+            // the bvh lives inside this buffer and has nothing else to free
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+        }
     }
 
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    void* _bvhBuffer { nullptr };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -198,6 +212,18 @@ btConvexHullShape* createConvexHull(const ShapeInfo::PointList& points) {
     return hull;
 }
 
+// util method
+// builds one hull per point list, in parallel, and returns them in the same order as the lists
+std::vector<btConvexHullShape*> createConvexHulls(const ShapeInfo::PointCollection& pointCollection) {
+    std::vector<btConvexHullShape*> hulls(pointCollection.size(), nullptr);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, pointCollection.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            hulls[i] = createConvexHull(pointCollection[i]);
+        }
+    });
+    return hulls;
+}
+
 // util method
 btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     assert(info.getType() == SHAPE_TYPE_STATIC_MESH); // should only get here for mesh shapes
@@ -270,7 +296,25 @@ btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     return dataArray;
 }
 
-const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info) {
+// util method
+// the hulls come from the cache when it has them, otherwise they are built and then saved there
+std::vector<btConvexHullShape*> loadOrCreateConvexHulls(const ShapeInfo& info, const ShapeInfo::PointCollection& pointCollection,
+                                                        ShapeCache* cache) {
+    std::vector<btConvexHullShape*> hulls;
+    if (cache && cache->loadHulls(info, hulls) && hulls.size() == pointCollection.size()) {
+        return hulls;
+    }
+    for (auto hull : hulls) {
+        delete hull;
+    }
+    hulls = createConvexHulls(pointCollection);
+    if (cache) {
+        cache->saveHulls(info, hulls);
+    }
+    return hulls;
+}
+
+const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info, ShapeCache* cache) {
     btCollisionShape* shape = nullptr;
     int type = info.getType();
     switch(type) {
@@ -360,17 +404,18 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
         case SHAPE_TYPE_COMPOUND:
         case SHAPE_TYPE_SIMPLE_HULL: {
             const ShapeInfo::PointCollection& pointCollection = info.getPointCollection();
-            uint32_t numSubShapes = info.getNumSubShapes();
-            if (numSubShapes == 1) {
-                if (!pointCollection.empty()) {
-                    shape = createConvexHull(pointCollection[0]);
-                }
-            } else {
+            // a single hull is reduced from the same number of points as each hull of a compound, so it is cached too
+            std::vector<btConvexHullShape*> hulls;
+            if (!pointCollection.empty()) {
+                hulls = loadOrCreateConvexHulls(info, pointCollection, cache);
+            }
+            if (hulls.size() == 1) {
+                shape = hulls[0];
+            } else if (type == SHAPE_TYPE_COMPOUND) {
                 auto compound = new btCompoundShape();
                 btTransform trans;
                 trans.setIdentity();
-                foreach (const ShapeInfo::PointList& hullPoints, pointCollection) {
-                    btConvexHullShape* hull = createConvexHull(hullPoints);
+                for (auto hull : hulls) {
                     compound->addChildShape(trans, hull);
                 }
                 shape = compound;
@@ -384,35 +429,44 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
             uint32_t numMeshes = info.getNumSubShapes();
             const uint32_t MIN_NUM_SIMPLE_COMPOUND_INDICES = 2; // END_OF_MESH_PART + END_OF_MESH
             if (numMeshes > 0 && numIndices > MIN_NUM_SIMPLE_COMPOUND_INDICES) {
-                uint32_t i = 0;
                 std::vector<btConvexHullShape*> hulls;
-                for (auto& points : pointCollection) {
-                    // build a hull around each part
-                    while (i < numIndices) {
-                        ShapeInfo::PointList hullPoints;
-                        hullPoints.reserve(points.size());
+                if (!(cache && cache->loadHulls(info, hulls))) {
+                    uint32_t i = 0;
+                    ShapeInfo::PointCollection partPoints;
+                    for (auto& points : pointCollection) {
+                        // gather the points of each part
                         while (i < numIndices) {
-                            int32_t j = triangleIndices[i];
-                            ++i;
-                            if (j == END_OF_MESH_PART) {
-                                // end of part
+                            ShapeInfo::PointList hullPoints;
+                            hullPoints.reserve(points.size());
+                            while (i < numIndices) {
+                                int32_t j = triangleIndices[i];
+                                ++i;
+                                if (j == END_OF_MESH_PART) {
+                                    // end of part
+                                    break;
+                                }
+                                hullPoints.push_back(points[j]);
+                            }
+                            if (hullPoints.size() > 0) {
+                                partPoints.push_back(std::move(hullPoints));
+                            }
+
+                            assert(i < numIndices);
+                            if (triangleIndices[i] == END_OF_MESH) {
+                                // end of mesh
+                                ++i;
                                 break;
                             }
-                            hullPoints.push_back(points[j]);
-                        }
-                        if (hullPoints.size() > 0) {
-                            btConvexHullShape* hull = createConvexHull(hullPoints);
-                            hulls.push_back(hull);
                         }
+                    }
 
-                        assert(i < numIndices);
-                        if (triangleIndices[i] == END_OF_MESH) {
-                            // end of mesh
-                            ++i;
-                            break;
-                        }
+                    // then build a hull around each part
+                    hulls = createConvexHulls(partPoints);
+                    if (cache) {
+                        cache->saveHulls(info, hulls);
                     }
                 }
+
                 uint32_t numHulls = (uint32_t)hulls.size();
                 if (numHulls == 1) {
                     shape = hulls[0];
@@ -431,7 +485,18 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
         case SHAPE_TYPE_STATIC_MESH: {
             btTriangleIndexVertexArray* dataArray = createStaticMeshArray(info);
             if (dataArray) {
-                shape = new StaticMeshShape(dataArray);
+                // the triangles are cheap to rebuild from the ShapeInfo but their bvh is not
+                void* bvhBuffer = nullptr;
+                btOptimizedBvh* bvh = cache ? cache->loadBvh(info, bvhBuffer) : nullptr;
+                if (bvh) {
+                    shape = new StaticMeshShape(dataArray, bvh, bvhBuffer);
+                } else {
+                    StaticMeshShape* meshShape = new StaticMeshShape(dataArray);
+                    if (cache) {
+                        cache->saveBvh(info, meshShape->getOptimizedBvh());
+                    }
+                    shape = meshShape;
+                }
             }
         }
         break;
@@ -488,7 +553,19 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     delete nonConstShape;
 }
 
+bool ShapeFactory::isExpensiveToCreate(ShapeType type) {
+    switch (type) {
+        case SHAPE_TYPE_COMPOUND:
+        case SHAPE_TYPE_SIMPLE_HULL:
+        case SHAPE_TYPE_SIMPLE_COMPOUND:
+        case SHAPE_TYPE_STATIC_MESH:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    shape = ShapeFactory::createShapeFromInfo(shapeInfo, shapeCache.get());
     emit submitWork(this);
 }
@@ -19,18 +19,25 @@
 
 #include <ShapeInfo.h>
 
+#include "ShapeCache.h"
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
-    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
+    // when cache is not null the expensive parts of hulls and triangle meshes are read from it, or saved to it once built
+    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info, ShapeCache* cache = nullptr);
     void deleteShape(const btCollisionShape* shape);
 
+    // hulls and triangle meshes take long enough to build that they should be created off the simulation thread
+    bool isExpensiveToCreate(ShapeType type);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
         Worker(const ShapeInfo& info) : shapeInfo(info), shape(nullptr) {}
         void run() override;
         ShapeInfo shapeInfo;
+        ShapeCachePointer shapeCache;
         const btCollisionShape* shape;
     signals:
         void submitWork(Worker*);
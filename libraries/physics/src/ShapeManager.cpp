@@ -37,6 +37,14 @@ ShapeManager::~ShapeManager() {
 }
 
 const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
+    return getOrBuildShape(info, info.getType() == SHAPE_TYPE_STATIC_MESH);
+}
+
+const btCollisionShape* ShapeManager::getShapeDeferred(const ShapeInfo& info) {
+    return getOrBuildShape(info, ShapeFactory::isExpensiveToCreate(info.getType()));
+}
+
+const btCollisionShape* ShapeManager::getOrBuildShape(const ShapeInfo& info, bool buildOnWorker) {
     if (info.getType() == SHAPE_TYPE_NONE) {
         return nullptr;
     }
@@ -47,17 +55,17 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    if (buildOnWorker) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
         // starting or waiting on a thread.
         ++_workRequestCount;
 
-        const auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), hash);
-        if (itr == _pendingMeshShapes.end()) {
+        const auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), hash);
+        if (itr == _pendingShapes.end()) {
             // start a worker
-            _pendingMeshShapes.push_back(hash);
+            _pendingShapes.push_back(hash);
             // try to recycle old deadWorker
             ShapeFactory::Worker* worker = _deadWorker;
             if (!worker) {
@@ -66,6 +74,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->shapeCache = _shapeCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
@@ -73,7 +82,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         }
         // else we're still waiting for the shape to be created on another thread
     } else {
-        shape = ShapeFactory::createShapeFromInfo(info);
+        shape = ShapeFactory::createShapeFromInfo(info, _shapeCache.get());
         if (shape) {
             ShapeReference newRef;
             newRef.refCount = 1;
@@ -208,8 +217,8 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
 
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
-    auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
-    if (itr == _pendingMeshShapes.end()) {
+    auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), worker->shapeInfo.getHash());
+    if (itr == _pendingShapes.end()) {
         // we've received a shape but don't remember asking for it
         // (should not fall in here, but if we do: delete the unwanted shape)
         if (worker->shape) {
@@ -217,18 +226,21 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
         }
     } else {
         // clear pending status
-        *itr = _pendingMeshShapes.back();
-        _pendingMeshShapes.pop_back();
+        *itr = _pendingShapes.back();
+        _pendingShapes.pop_back();
 
-        // cache the new shape
-        if (worker->shape) {
+        HashKey newKey(worker->shapeInfo.getHash());
+        if (worker->shape && _shapeMap.find(newKey)) {
+            // someone asked for this shape synchronously while the worker was busy, so we already have it
+            ShapeFactory::deleteShape(worker->shape);
+        } else if (worker->shape) {
+            // cache the new shape
             ShapeReference newRef;
             // refCount is zero because nothing is using the shape yet
             newRef.refCount = 0;
             newRef.shape = worker->shape;
             newRef.key = worker->shapeInfo.getHash();
-            HashKey hashKey(newRef.key);
-            _shapeMap.insert(hashKey, newRef);
+            _shapeMap.insert(newKey, newRef);
 
             // This shape's refCount is zero because an object requested it but is not yet using it.  We expect it to be
             // used later but there is a possibility it will never be used (e.g. the object that wanted it was removed
@@ -276,6 +288,7 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     }
     // save this dead worker for later
     worker->shapeInfo.clear();
+    worker->shapeCache.reset();
     worker->shape = nullptr;
     _deadWorker = worker;
     ++_workDeliveryCount;
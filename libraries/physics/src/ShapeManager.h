@@ -41,6 +41,11 @@
 // and returns the pointer.  If not it asks the ShapeFactory to create it, adds an
 // entry in the map with a ref-count of 1, and returns the pointer.
 //
+// Hulls and triangle meshes can take many milliseconds to build, so those may instead
+// be handed to a ShapeFactory::Worker on the global thread pool.  The request returns
+// nullptr and the caller asks again by key once the worker has delivered the shape.
+// When a ShapeCache is set those hulls and BVHs are also kept on disk between sessions.
+//
 // When a body stops using a shape the ShapeManager must be informed so it can
 // decrement its ref-count.  When a ref-count drops to zero the ShapeManager
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
@@ -55,8 +60,13 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
+    /// \return pointer to shape, or nullptr while a triangle mesh is built on a worker thread
     const btCollisionShape* getShape(const ShapeInfo& info);
+
+    /// \return pointer to shape, or nullptr while any shape that is expensive to create (hulls and triangle meshes)
+    /// is built on a worker thread.  getWorkRequestCount() is bumped when that happens and getWorkDeliveryCount()
+    /// when the shape arrives, after which getShapeByKey() will find it.
+    const btCollisionShape* getShapeDeferred(const ShapeInfo& info);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
 
@@ -66,6 +76,10 @@ public:
     /// delete shapes that have zero references
     void collectGarbage();
 
+    /// hulls and triangle mesh BVHs are read from this cache, and saved to it once built
+    void setShapeCache(const ShapeCachePointer& shapeCache) { _shapeCache = shapeCache; }
+    const ShapeCachePointer& getShapeCache() const { return _shapeCache; }
+
     // validation methods
     int getNumShapes() const { return _shapeMap.size(); }
     int getNumReferences(const ShapeInfo& info) const;
@@ -78,6 +92,7 @@ protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
 
 private:
+    const btCollisionShape* getOrBuildShape(const ShapeInfo& info, bool buildOnWorker);
     void addToGarbage(uint64_t key);
     bool releaseShapeByKey(uint64_t key);
 
@@ -100,8 +115,9 @@ private:
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
     std::vector<uint64_t> _garbageRing;
-    std::vector<uint64_t> _pendingMeshShapes;
+    std::vector<uint64_t> _pendingShapes;
     std::vector<KeyExpiry> _orphans;
+    ShapeCachePointer _shapeCache;
     ShapeFactory::Worker* _deadWorker { nullptr };
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
@@ -24,9 +24,22 @@
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
-        btConstraintSolver* constraintSolver,
-        btCollisionConfiguration* collisionConfiguration)
-    :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
+        btConstraintSolverPoolMt* solverPool,
+        btConstraintSolver* solverMt,
+        btCollisionConfiguration* collisionConfiguration,
+        bool multithreaded)
+    :   btDiscreteDynamicsWorldMt(dispatcher, pairCache, solverPool, solverMt, collisionConfiguration),
+        _multithreaded(multithreaded) {
+}
+
+void ThreadSafeDynamicsWorld::solveConstraints(btContactSolverInfo& solverInfo) {
+    if (_multithreaded) {
+        btDiscreteDynamicsWorldMt::solveConstraints(solverInfo);
+    } else {
+        // the Mt island manager batches small islands together, which changes the solver order,
+        // so keep the original one-island-at-a-time path when running on one thread.
+        btDiscreteDynamicsWorld::solveConstraints(solverInfo);
+    }
 }
 
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
@@ -78,6 +91,11 @@ int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep
             internalSingleStepSimulation(fixedTimeStep);
             onSubStep();
         }
+
+        if (_multithreaded) {
+            // same as btDiscreteDynamicsWorldMt::stepSimulation(): let the workers go idle until the next step
+            btGetTaskScheduler()->sleepWorkerThreadsHint();
+        }
     }
 
     // NOTE: We do NOT call synchronizeMotionStates() after each substep (to avoid multiple locks on the
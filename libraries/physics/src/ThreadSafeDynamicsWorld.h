@@ -19,7 +19,7 @@
 #define hifi_ThreadSafeDynamicsWorld_h
 
 #include <BulletDynamics/Dynamics/btRigidBody.h>
-#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 
 #include "ObjectMotionState.h"
 
@@ -27,15 +27,24 @@
 
 using SubStepCallback = std::function<void()>;
 
-ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorld {
+// ThreadSafeDynamicsWorld derives from btDiscreteDynamicsWorldMt so the same world can run either way:
+// when isMultithreaded() the per-body loops and island solving are spread over Bullet's task scheduler,
+// otherwise constraints are solved one island at a time exactly as btDiscreteDynamicsWorld does.
+ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorldMt {
 public:
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
+    // solverPool and solverMt are only used when multithreaded, and may be null otherwise: call setConstraintSolver()
+    // with the solver to use on one thread
     ThreadSafeDynamicsWorld(
             btDispatcher* dispatcher,
             btBroadphaseInterface* pairCache,
-            btConstraintSolver* constraintSolver,
-            btCollisionConfiguration* collisionConfiguration);
+            btConstraintSolverPoolMt* solverPool,
+            btConstraintSolver* solverMt,
+            btCollisionConfiguration* collisionConfiguration,
+            bool multithreaded);
+
+    bool isMultithreaded() const { return _multithreaded; }
 
     int getNumSubsteps() const { return _numSubsteps; }
     int stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps = 1,
@@ -55,6 +64,9 @@ public:
     void addChangedMotionState(ObjectMotionState* motionState) { _changedMotionStates.push_back(motionState); }
     virtual void debugDrawObject(const btTransform& worldTransform, const btCollisionShape* shape, const btVector3& color) override;
 
+protected:
+    virtual void solveConstraints(btContactSolverInfo& solverInfo) override;
+
 private:
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
@@ -66,6 +78,7 @@ private:
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
     int _numSubsteps { 0 };
+    bool _multithreaded { false };
 };
 
 #endif // hifi_ThreadSafeDynamicsWorld_h
@@ -10,12 +10,35 @@
 //
 #pragma once
 
+#include <string.h>
+
 #include "Plugin.h"
 
 class Encoder {
 public:
     virtual ~Encoder() { }
     virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) = 0;
+
+    // encode into a caller-owned buffer
+    // returns the number of bytes written to encodedBuffer, or -1 if they would not fit in encodedCapacity
+    // the default adapts the QByteArray interface above, encoders that can write in place should override it
+    virtual int encodeInto(const char* decodedBuffer, int decodedSize, char* encodedBuffer, int encodedCapacity) {
+        QByteArray decoded = QByteArray::fromRawData(decodedBuffer, decodedSize);
+        QByteArray encoded;
+        encode(decoded, encoded);
+        if (encoded.size() > encodedCapacity) {
+            return -1;
+        }
+        memcpy(encodedBuffer, encoded.constData(), encoded.size());
+        return encoded.size();
+    }
+
+    // upper bound on the size of an encoded frame, used by callers to size the buffer passed to encodeInto
+    virtual int getMaxEncodedSize(int decodedSize) const { return decodedSize; }
+
+    // true if the encoded output depends only on the current frame, in which case
+    // identical frames encoded by encoders of the same codec produce identical payloads
+    virtual bool isStateless() const { return false; }
 };
 
 class Decoder {
@@ -24,6 +47,32 @@ public:
     virtual void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) = 0;
 
     virtual void lostFrame(QByteArray& decodedBuffer) = 0;
+
+    // decode into a caller-owned buffer that is reused from frame to frame
+    // returns the number of bytes written at the start of decodedBuffer, which is grown when the frame does not fit
+    // and never shrunk, so that it stops allocating once it is large enough
+    // each frame is decoded exactly once, so that stateful decoders stay in step with the stream
+    // the default adapts the QByteArray interface above, decoders that can write in place should override it
+    virtual int decodeInto(const char* encodedBuffer, int encodedSize, QByteArray& decodedBuffer) {
+        QByteArray encoded = QByteArray::fromRawData(encodedBuffer, encodedSize);
+        QByteArray decoded;
+        decode(encoded, decoded);
+        if (decoded.size() > decodedBuffer.size()) {
+            decodedBuffer.resize(decoded.size());
+        }
+        memcpy(decodedBuffer.data(), decoded.constData(), decoded.size());
+        return decoded.size();
+    }
+};
+
+// a single frame of a batch encode, all buffers are owned by the caller
+struct EncodeBatchEntry {
+    Encoder* encoder { nullptr };
+    const char* decodedBuffer { nullptr };
+    int decodedSize { 0 };
+    char* encodedBuffer { nullptr };
+    int encodedCapacity { 0 };
+    int encodedSize { -1 }; // written by encodeBatch, -1 on failure
 };
 
 class CodecPlugin : public Plugin {
@@ -32,4 +81,14 @@ public:
     virtual Decoder* createDecoder(int sampleRate, int numChannels) = 0;
     virtual void releaseEncoder(Encoder* encoder) = 0;
     virtual void releaseDecoder(Decoder* decoder) = 0;
+
+    // encode a batch of frames, each with an encoder created by this plugin
+    // codecs that can share work across frames (e.g. SIMD over several streams) should override this
+    virtual void encodeBatch(EncodeBatchEntry* entries, int numEntries) {
+        for (int i = 0; i < numEntries; ++i) {
+            EncodeBatchEntry& entry = entries[i];
+            entry.encodedSize = entry.encoder->encodeInto(entry.decodedBuffer, entry.decodedSize,
+                                                          entry.encodedBuffer, entry.encodedCapacity);
+        }
+    }
 };
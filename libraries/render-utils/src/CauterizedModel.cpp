@@ -206,7 +206,7 @@ void CauterizedModel::updateRenderItems() {
                     const auto& meshState = self->getMeshState(skinDeformerIndex);
                     const auto& cauterizedMeshState = self->getCauterizeMeshState(skinDeformerIndex);
 
-                    transaction.updateItem<ModelMeshPartPayload>(itemID,
+                    transaction.updateItemParallel<ModelMeshPartPayload>(itemID,
                         [modelTransform, shapeState, meshState, useDualQuaternionSkinning, cauterizedMeshState, invalidatePayloadShapeKey,
                             primitiveMode, renderItemKeyGlobalFlags, enableCauterization](ModelMeshPartPayload& mmppData) {
                         CauterizedMeshPartPayload& data = static_cast<CauterizedMeshPartPayload&>(mmppData);
@@ -225,11 +225,11 @@ void CauterizedModel::updateRenderItems() {
                         data.updateTransformAndBound(modelTransform.worldTransform(shapeState._rootFromJointTransform));
 
                         data.setEnableCauterization(enableCauterization);
-                        data.updateKey(renderItemKeyGlobalFlags);
-                        data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
+                        data.updateKeyFromCurrentMaterials(renderItemKeyGlobalFlags);
+                        data.setShapeKeyFromCurrentMaterials(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
                     });
                 } else {
-                    transaction.updateItem<ModelMeshPartPayload>(itemID,
+                    transaction.updateItemParallel<ModelMeshPartPayload>(itemID,
                         [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags, enableCauterization]
                              (ModelMeshPartPayload& mmppData) {
                         CauterizedMeshPartPayload& data = static_cast<CauterizedMeshPartPayload&>(mmppData);
@@ -241,8 +241,8 @@ void CauterizedModel::updateRenderItems() {
                         data.updateTransformForCauterizedMesh(renderTransform);
 
                         data.setEnableCauterization(enableCauterization);
-                        data.updateKey(renderItemKeyGlobalFlags);
-                        data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, false);
+                        data.updateKeyFromCurrentMaterials(renderItemKeyGlobalFlags);
+                        data.setShapeKeyFromCurrentMaterials(invalidatePayloadShapeKey, primitiveMode, false);
                     });
                     
                 }
@@ -339,6 +339,13 @@ void ModelMeshPartPayload::updateClusterBuffer(const std::vector<Model::Transfor
 
 // Note that this method is called for models but not for shapes
 void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
+    if (_drawMaterials.shouldUpdate()) {
+        RenderPipelines::updateMultiMaterial(_drawMaterials);
+    }
+    updateKeyFromCurrentMaterials(key);
+}
+
+void ModelMeshPartPayload::updateKeyFromCurrentMaterials(const render::ItemKey& key) {
     ItemKey::Builder builder(key);
     builder.withTypeShape();
 
@@ -346,10 +353,6 @@ void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
         builder.withDeformed();
     }
 
-    if (_drawMaterials.shouldUpdate()) {
-        RenderPipelines::updateMultiMaterial(_drawMaterials);
-    }
-
     auto matKey = _drawMaterials.getMaterialKey();
     if (matKey.isTranslucent()) {
         builder.withTransparent();
@@ -359,15 +362,19 @@ void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
 }
 
 void ModelMeshPartPayload::setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning) {
+    if (!invalidateShapeKey && _drawMaterials.shouldUpdate()) {
+        RenderPipelines::updateMultiMaterial(_drawMaterials);
+    }
+    setShapeKeyFromCurrentMaterials(invalidateShapeKey, primitiveMode, useDualQuaternionSkinning);
+}
+
+void ModelMeshPartPayload::setShapeKeyFromCurrentMaterials(bool invalidateShapeKey, PrimitiveMode primitiveMode,
+                                                           bool useDualQuaternionSkinning) {
     if (invalidateShapeKey) {
         _shapeKey = ShapeKey::Builder::invalid();
         return;
     }
 
-    if (_drawMaterials.shouldUpdate()) {
-        RenderPipelines::updateMultiMaterial(_drawMaterials);
-    }
-
     ShapeKey::Builder builder;
     graphics::MaterialPointer material = _drawMaterials.empty() ? nullptr : _drawMaterials.top().material;
     graphics::MaterialKey drawMaterialKey = _drawMaterials.getMaterialKey();
@@ -110,6 +110,12 @@ public:
     void setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning);
     void setCauterized(bool cauterized) { _cauterized = cauterized; }
 
+    // Like updateKey and setShapeKey, but without bringing the materials up to date, which can touch materials shared
+    // with other items.  Safe in updates queued with updateItemParallel: bindMaterials updates the materials when the
+    // item renders, and the next update picks up their new keys.
+    void updateKeyFromCurrentMaterials(const render::ItemKey& key);
+    void setShapeKeyFromCurrentMaterials(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning);
+
     // ModelMeshPartPayload functions to perform render
     void bindMesh(gpu::Batch& batch) override;
     void bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const override;
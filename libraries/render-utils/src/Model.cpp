@@ -75,6 +75,7 @@ Model::Model(QObject* parent, SpatiallyNestable* spatiallyNestableOverride, uint
     setSnapModelToRegistrationPoint(true, glm::vec3(0.5f));
 
     connect(&_renderWatcher, &ModelResourceWatcher::finished, this, &Model::loadURLFinished);
+    connect(&_renderWatcher, &ModelResourceWatcher::refined, this, &Model::loadURLRefined);
 }
 
 Model::~Model() {
@@ -243,7 +244,7 @@ void Model::updateRenderItems() {
                 const auto& meshState = self->getMeshState(skinDeformerIndex);
                 bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
 
-                transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, meshState, useDualQuaternionSkinning,
+                transaction.updateItemParallel<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, meshState, useDualQuaternionSkinning,
                                                                       invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags, cauterized](ModelMeshPartPayload& data) {
                     if (useDualQuaternionSkinning) {
                         data.updateClusterBuffer(meshState.clusterDualQuaternions);
@@ -256,18 +257,18 @@ void Model::updateRenderItems() {
                     data.updateTransformAndBound(modelTransform.worldTransform(shapeState._rootFromJointTransform));
 
                     data.setCauterized(cauterized);
-                    data.updateKey(renderItemKeyGlobalFlags);
-                    data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
+                    data.updateKeyFromCurrentMaterials(renderItemKeyGlobalFlags);
+                    data.setShapeKeyFromCurrentMaterials(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
                 });
             } else {
-                transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags](ModelMeshPartPayload& data) {
+                transaction.updateItemParallel<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags](ModelMeshPartPayload& data) {
                     
                     Transform renderTransform = modelTransform;
                     renderTransform = modelTransform.worldTransform(shapeState._rootFromJointTransform);
                     data.updateTransform(renderTransform);
 
-                    data.updateKey(renderItemKeyGlobalFlags);
-                    data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, false);
+                    data.updateKeyFromCurrentMaterials(renderItemKeyGlobalFlags);
+                    data.setShapeKeyFromCurrentMaterials(invalidatePayloadShapeKey, primitiveMode, false);
                 }); 
             }
         }
@@ -1184,6 +1185,12 @@ void Model::setTextures(const QVariantMap& textures) {
     }
 }
 
+void Model::setLoadingPriority(float priority) {
+    _loadingPriority = priority;
+    // while the model is still loading, its pending work is reordered by the new priority
+    _renderWatcher.setLoadPriority(this, priority);
+}
+
 void Model::setURL(const QUrl& url) {
     // don't recreate the geometry if it's the same URL
     if (_url == url && _renderWatcher.getURL() == url) {
@@ -1229,6 +1236,14 @@ void Model::loadURLFinished(bool success) {
     emit setURLFinished(success);
 }
 
+void Model::loadURLRefined() {
+    // a finer LOD of a progressive model came in; the render items hold onto the meshes they were made with,
+    // so have them recreated, while the rig and shape states carry on as they are
+    _needsFixupInScene = true;
+    invalidCalculatedMeshBoxes();
+    emit requestRenderUpdate();
+}
+
 bool Model::getJointPositionInWorldFrame(int jointIndex, glm::vec3& position) const {
     return _rig.getJointPositionInWorldFrame(jointIndex, position, _translation, _rotation);
 }
@@ -164,6 +164,8 @@ public:
     bool maybeStartBlender();
 
     bool isLoaded() const { return (bool)_renderGeometry && _renderGeometry->isHFMModelLoaded(); }
+    // whether a progressive model has loaded, but finer LODs of its geometry are still to come
+    bool isRefining() const { return _renderWatcher.isRefining(); }
     bool isAddedToScene() const { return _addedToScene; }
 
     void setPrimitiveMode(PrimitiveMode primitiveMode);
@@ -289,7 +291,7 @@ public:
     // returns 'true' if needs fullUpdate after geometry change
     virtual bool updateGeometry();
 
-    void setLoadingPriority(float priority) { _loadingPriority = priority; }
+    void setLoadingPriority(float priority);
 
     size_t getRenderInfoVertexCount() const { return _renderInfoVertexCount; }
     size_t getRenderInfoTextureSize();
@@ -376,6 +378,7 @@ public:
 
 public slots:
     void loadURLFinished(bool success);
+    void loadURLRefined();
 
 signals:
     void setURLFinished(bool success);
@@ -78,14 +78,9 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
     const auto sortedPipelines = task.addJob<PipelineSortShapes>("PipelineSortShadow", culledShadowItems);
     const auto sortedShapes = task.addJob<DepthSortShapes>("DepthSortShadow", sortedPipelines, true);
 
-    render::Varying cascadeFrustums[SHADOW_CASCADE_MAX_COUNT] = {
-        ViewFrustumPointer()
-#if SHADOW_CASCADE_MAX_COUNT>1
-        ,ViewFrustumPointer(),
-        ViewFrustumPointer(),
-        ViewFrustumPointer()
-#endif
-    };
+    // CPU jobs: cull the items of every cascade concurrently
+    const auto cullCascadesInputs = CullShadowCascades::Inputs(sortedShapes, shadowFrame, currentKeyLight).asVarying();
+    const auto culledCascades = task.addJob<CullShadowCascades>("CullShadowCascades", cullCascadesInputs, shadowCasterReceiverFilter);
 
     CascadeBoxes cascadeSceneBBoxes;
 
@@ -94,15 +89,7 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
         sprintf(jobName, "ShadowCascadeSetup%d", i);
         const auto cascadeSetupOutput = task.addJob<RenderShadowCascadeSetup>(jobName, shadowFrame, i, shadowCasterReceiverFilter);
         const auto shadowFilter = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(0);
-        auto antiFrustum = render::Varying(ViewFrustumPointer());
-        cascadeFrustums[i] = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(1);
-        if (i > 1) {
-            antiFrustum = cascadeFrustums[i - 2];
-        }
-
-        const auto cullInputs = CullShadowBounds::Inputs(sortedShapes, shadowFilter, antiFrustum, currentKeyLight, cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(2)).asVarying();
-        sprintf(jobName, "CullShadowCascade%d", i);
-        const auto culledShadowItemsAndBounds = task.addJob<CullShadowBounds>(jobName, cullInputs);
+        const auto culledShadowItemsAndBounds = culledCascades.getN<CullShadowCascades::Outputs>(i);
 
         // GPU jobs: Render to shadow map
         sprintf(jobName, "RenderShadowMap%d", i);
@@ -630,3 +617,45 @@ void CullShadowBounds::run(const render::RenderContextPointer& renderContext, co
         }
     }
 }
+
+void FetchShadowCascadeFrustum::run(const render::RenderContextPointer& renderContext, const Input& input, Output& output) {
+    const auto shadowFrame = input;
+    output = ViewFrustumPointer();
+    if (shadowFrame && !shadowFrame->_objects.empty() && shadowFrame->_objects[0]) {
+        const auto globalShadow = shadowFrame->_objects[0];
+        if (_cascadeIndex < globalShadow->getCascadeCount()) {
+            output = globalShadow->getCascade(_cascadeIndex).getFrustum();
+        }
+    }
+}
+
+void CullShadowCascade::build(JobModel& task, const render::Varying& inputs, render::Varying& outputs, unsigned int cascadeIndex, render::ItemFilter filter) {
+    const auto sortedShapes = inputs.getN<Inputs>(0);
+    const auto shadowFrame = inputs.getN<Inputs>(1);
+    const auto currentKeyLight = inputs.getN<Inputs>(2);
+
+    const auto cascadeSetupOutput = task.addJob<RenderShadowCascadeSetup>("ShadowCascadeSetup", shadowFrame, cascadeIndex, filter);
+    const auto shadowFilter = cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(0);
+
+    // Items already drawn in the cascade before the previous one are left out
+    auto antiFrustum = render::Varying(ViewFrustumPointer());
+    if (cascadeIndex > 1) {
+        antiFrustum = task.addJob<FetchShadowCascadeFrustum>("FetchAntiFrustum", shadowFrame, cascadeIndex - 2);
+    }
+
+    const auto cullInputs = CullShadowBounds::Inputs(sortedShapes, shadowFilter, antiFrustum, currentKeyLight,
+        cascadeSetupOutput.getN<RenderShadowCascadeSetup::Outputs>(2)).asVarying();
+    outputs = task.addJob<CullShadowBounds>("CullShadowBounds", cullInputs);
+
+    task.addJob<RenderShadowCascadeTeardown>("ShadowCascadeTeardown", shadowFilter);
+}
+
+void CullShadowCascades::build(JobModel& task, const render::Varying& inputs, render::Varying& outputs, render::ItemFilter filter) {
+    Outputs culledCascades;
+    for (auto i = 0; i < SHADOW_CASCADE_MAX_COUNT; i++) {
+        char jobName[64];
+        sprintf(jobName, "CullShadowCascade%d", i);
+        culledCascades[i] = task.addJob<CullShadowCascade>(jobName, inputs, i, filter);
+    }
+    outputs = culledCascades;
+}
@@ -182,4 +182,38 @@ public:
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs);
 };
 
+class FetchShadowCascadeFrustum {
+public:
+    using Input = LightStage::ShadowFramePointer;
+    using Output = ViewFrustumPointer;
+    using JobModel = render::Job::ModelIO<FetchShadowCascadeFrustum, Input, Output>;
+
+    FetchShadowCascadeFrustum(unsigned int cascadeIndex) : _cascadeIndex(cascadeIndex) {}
+
+    void run(const render::RenderContextPointer& renderContext, const Input& input, Output& output);
+
+private:
+    unsigned int _cascadeIndex;
+};
+
+// Culls the shadow casters of one cascade against its frustum, which is only pushed for the duration of the cull
+class CullShadowCascade {
+public:
+    using Inputs = render::VaryingSet3<render::ShapeBounds, LightStage::ShadowFramePointer, graphics::LightPointer>;
+    using Outputs = CullShadowBounds::Outputs;
+    using JobModel = render::Task::ModelIO<CullShadowCascade, Inputs, Outputs>;
+
+    void build(JobModel& task, const render::Varying& inputs, render::Varying& outputs, unsigned int cascadeIndex, render::ItemFilter filter);
+};
+
+// Culls all the cascades at once, each on its own copy of the render args
+class CullShadowCascades {
+public:
+    using Inputs = CullShadowCascade::Inputs;
+    using Outputs = render::VaryingArray<CullShadowCascade::Outputs, SHADOW_CASCADE_MAX_COUNT>;
+    using JobModel = render::Task::ConcurrentModelIO<CullShadowCascades, Inputs, Outputs>;
+
+    void build(JobModel& task, const render::Varying& inputs, render::Varying& outputs, render::ItemFilter filter);
+};
+
 #endif // hifi_RenderShadowTask_h
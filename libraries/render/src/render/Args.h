@@ -38,6 +38,14 @@ namespace render {
             int _outOfView = 0;
             int _tooSmall = 0;
             int _rendered = 0;
+
+            Item& operator+=(const Item& other) {
+                _considered += other._considered;
+                _outOfView += other._outOfView;
+                _tooSmall += other._tooSmall;
+                _rendered += other._rendered;
+                return *this;
+            }
         };
 
         int _materialSwitches = 0;
@@ -57,6 +65,15 @@ namespace render {
                     return _other;
             }
         }
+
+        RenderDetails& operator+=(const RenderDetails& other) {
+            _materialSwitches += other._materialSwitches;
+            _trianglesRendered += other._trianglesRendered;
+            _item += other._item;
+            _shadow += other._shadow;
+            _other += other._other;
+            return *this;
+        }
     };
 
 
@@ -16,9 +16,46 @@
 
 #include <PerfStat.h>
 #include <OctreeUtils.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
+// Culling hands long lists of items to the worker threads in chunks of this many
+const size_t CULL_CHUNK_SIZE = 1024;
+
+// Calls cullChunk on consecutive ranges of inItems, each appending the bounds it keeps to its own list and counting what
+// it rejects in its own details, then appends those lists to outItems in order so the result matches a serial cull.
+template <class CullChunk>
+static void cullItemIDs(const ItemIDs& inItems, bool multithreaded, ItemBounds& outItems, RenderDetails::Item& details,
+                        const CullChunk& cullChunk) {
+    size_t numChunks = (inItems.size() + CULL_CHUNK_SIZE - 1) / CULL_CHUNK_SIZE;
+    if (!multithreaded || numChunks < 2) {
+        cullChunk(inItems.data(), inItems.data() + inItems.size(), outItems, details);
+        return;
+    }
+
+    std::vector<ItemBounds> chunkItems(numChunks);
+    std::vector<RenderDetails::Item> chunkDetails(numChunks);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks, 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+            size_t begin = chunk * CULL_CHUNK_SIZE;
+            size_t end = std::min(begin + CULL_CHUNK_SIZE, inItems.size());
+            chunkItems[chunk].reserve(end - begin);
+            cullChunk(inItems.data() + begin, inItems.data() + end, chunkItems[chunk], chunkDetails[chunk]);
+        }
+    });
+
+    size_t numOutItems = outItems.size();
+    for (const auto& items : chunkItems) {
+        numOutItems += items.size();
+    }
+    outItems.reserve(numOutItems);
+    for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+        outItems.insert(outItems.end(), chunkItems[chunk].begin(), chunkItems[chunk].end());
+        details += chunkDetails[chunk];
+    }
+}
+
 CullTest::CullTest(CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum) :
     _functor(functor),
     _args(pargs),
@@ -173,6 +210,7 @@ void CullSpatialSelection::configure(const Config& config) {
     _justFrozeFrustum = _justFrozeFrustum || (config.freezeFrustum && !_freezeFrustum);
     _freezeFrustum = config.freezeFrustum;
     _skipCulling = config.skipCulling;
+    _multithreaded = config.multithreaded;
 }
 
 void CullSpatialSelection::run(const RenderContextPointer& renderContext,
@@ -195,8 +233,6 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         args->pushViewFrustum(_frozenFrustum); // replace the true view frustum by the frozen one
     }
 
-    CullTest test(_cullFunctor, args, details);
-
     // Now we have a selection of items to render
     outItems.clear();
     outItems.reserve(inSelection.numItems());
@@ -209,136 +245,51 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         // filter individually against the _filter
         // visibility cull if partially selected ( octree cell contianing it was partial)
         // distance cull if was a subcell item ( octree cell is way bigger than the item bound itself, so now need to test per item)
-        if (_skipCulling) {
-            // inside & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // inside & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // partial & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // partial & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-        } else {
-
-            // inside & fit items: easy, just filter
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // inside & subcell items: filter & distance cull
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
+        // unless culling is disabled, in which case every list is filtered only
+        bool testFrustum = !_skipCulling;
+        bool testSolidAngle = !_skipCulling;
+        auto cullSelectedItems = [&](const ItemIDs& inItems, bool frustumTest, bool solidAngleTest) {
+            cullItemIDs(inItems, _multithreaded, outItems, details,
+                [&](const ItemID* first, const ItemID* last, ItemBounds& chunkItems, RenderDetails::Item& chunkDetails) {
+                CullTest test(_cullFunctor, args, chunkDetails);
+                for (auto id = first; id != last; ++id) {
+                    auto& item = scene->getItem(*id);
                     if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
+                        ItemBound itemBound(*id, item.getBound());
+                        if ((!frustumTest || test.frustumTest(itemBound.bound)) &&
+                                (!solidAngleTest || test.solidAngleTest(itemBound.bound))) {
+                            chunkItems.emplace_back(itemBound);
                             if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
+                                item.fetchMetaSubItemBounds(chunkItems, (*scene));
                             }
                         }
                     }
                 }
-            }
+            });
+        };
 
-            // partial & fit items: filter & frustum cull
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
-            }
+        // inside & fit items: easy, just filter
+        {
+            PerformanceTimer perfTimer("insideFitItems");
+            cullSelectedItems(inSelection.insideItems, false, false);
+        }
 
-            // partial & subcell items:: filter & frutum cull & solidangle cull
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            if (test.solidAngleTest(itemBound.bound)) {
-                                outItems.emplace_back(itemBound);
-                                if (item.getKey().isMetaCullGroup()) {
-                                    item.fetchMetaSubItemBounds(outItems, (*scene));
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+        // inside & subcell items: filter & distance cull
+        {
+            PerformanceTimer perfTimer("insideSmallItems");
+            cullSelectedItems(inSelection.insideSubcellItems, false, testSolidAngle);
+        }
+
+        // partial & fit items: filter & frustum cull
+        {
+            PerformanceTimer perfTimer("partialFitItems");
+            cullSelectedItems(inSelection.partialItems, testFrustum, false);
+        }
+
+        // partial & subcell items:: filter & frutum cull & solidangle cull
+        {
+            PerformanceTimer perfTimer("partialSmallItems");
+            cullSelectedItems(inSelection.partialSubcellItems, testFrustum, testSolidAngle);
         }
     }
 
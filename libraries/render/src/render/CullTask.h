@@ -86,15 +86,18 @@ namespace render {
         Q_PROPERTY(int numItems READ getNumItems)
         Q_PROPERTY(bool freezeFrustum MEMBER freezeFrustum WRITE setFreezeFrustum)
         Q_PROPERTY(bool skipCulling MEMBER skipCulling WRITE setSkipCulling)
+        Q_PROPERTY(bool multithreaded MEMBER multithreaded WRITE setMultithreaded)
     public:
         int numItems{ 0 };
         int getNumItems() { return numItems; }
 
         bool freezeFrustum{ false };
         bool skipCulling{ false };
+        bool multithreaded{ true };
     public slots:
         void setFreezeFrustum(bool enabled) { freezeFrustum = enabled; emit dirty(); }
         void setSkipCulling(bool enabled) { skipCulling = enabled; emit dirty(); }
+        void setMultithreaded(bool enabled) { multithreaded = enabled; emit dirty(); }
     signals:
         void dirty();
     };
@@ -103,6 +106,7 @@ namespace render {
         bool _freezeFrustum{ false }; // initialized by Config
         bool _justFrozeFrustum{ false };
         bool _skipCulling{ false };
+        bool _multithreaded{ true };
         ViewFrustum _frozenFrustum;
     public:
         using Config = CullSpatialSelectionConfig;
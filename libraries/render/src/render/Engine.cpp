@@ -36,6 +36,16 @@ public:
     }
 };
 
+void RenderContext::detachForConcurrentJob() {
+    _concurrentArgs = std::make_shared<RenderArgs>(*args);
+    _concurrentArgs->_details = RenderDetails();
+    args = _concurrentArgs.get();
+}
+
+void RenderContext::joinConcurrentJob(const task::JobContext& concurrentContext) {
+    args->_details += static_cast<const RenderContext&>(concurrentContext).args->_details;
+}
+
 RenderEngine::RenderEngine() : Engine(EngineTask::JobModel::create("Engine"), std::make_shared<RenderContext>())
 {
 }
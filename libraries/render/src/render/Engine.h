@@ -28,8 +28,15 @@ namespace render {
         RenderContext() : task::JobContext() {}
         virtual ~RenderContext() {}
 
+        // jobs of a concurrent task each get a copy of the args, so they can push view frustums and count render details
+        void detachForConcurrentJob() override;
+        void joinConcurrentJob(const task::JobContext& concurrentContext) override;
+
         RenderArgs* args;
         ScenePointer _scene;
+
+    protected:
+        std::shared_ptr<RenderArgs> _concurrentArgs;
     };
     using RenderContextPointer = std::shared_ptr<RenderContext>;
 
@@ -64,5 +64,15 @@ void EngineStats::run(const RenderContextPointer& renderContext) {
     config->frameSetPipelineCount = _gpuStats._PSNumSetPipelines;
     config->frameSetInputFormatCount = _gpuStats._ISNumFormatChanges;
 
+    if (renderContext->_scene) {
+        auto transactionStats = renderContext->_scene->getTransactionStats();
+        config->transactionCount = transactionStats.numTransactions;
+        config->transactionResetCount = transactionStats.numResets;
+        config->transactionUpdateCount = transactionStats.numUpdates;
+        config->transactionUpdatedItemCount = transactionStats.numUpdatedItems;
+        config->transactionRemoveCount = transactionStats.numRemoves;
+        config->transactionApplyTime = transactionStats.applyTime;
+    }
+
     // These new stat values are notified with the "newStats" signal triggered by the timer
 }
@@ -61,6 +61,13 @@ namespace render {
         Q_PROPERTY(quint32 frameSetPipelineCount MEMBER frameSetPipelineCount NOTIFY newStats)
         Q_PROPERTY(quint32 frameSetInputFormatCount MEMBER frameSetInputFormatCount NOTIFY newStats)
 
+        Q_PROPERTY(quint32 transactionCount MEMBER transactionCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionResetCount MEMBER transactionResetCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionUpdateCount MEMBER transactionUpdateCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionUpdatedItemCount MEMBER transactionUpdatedItemCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionRemoveCount MEMBER transactionRemoveCount NOTIFY newStats)
+        Q_PROPERTY(quint64 transactionApplyTime MEMBER transactionApplyTime NOTIFY newStats)
+
 
     public:
         EngineStatsConfig() : Job::Config(true) {}
@@ -101,6 +108,13 @@ namespace render {
         quint32 frameSetPipelineCount{ 0 };
 
         quint32 frameSetInputFormatCount{ 0 };
+
+        quint32 transactionCount{ 0 };
+        quint32 transactionResetCount{ 0 };
+        quint32 transactionUpdateCount{ 0 };
+        quint32 transactionUpdatedItemCount{ 0 };
+        quint32 transactionRemoveCount{ 0 };
+        quint64 transactionApplyTime{ 0 }; // usecs
     };
 
     class EngineStats {
@@ -10,8 +10,16 @@
 //
 #include "Scene.h"
 
+#include <algorithm>
 #include <numeric>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/spin_mutex.h>
+
 #include <gpu/Batch.h>
+#include <SharedUtil.h>
+#include <TBBHelpers.h>
+
 #include "Logging.h"
 #include "TransitionStage.h"
 #include "HighlightStage.h"
@@ -48,7 +56,12 @@ void Transaction::setTransitionFinishedOperator(ItemID id, TransitionFinishedFun
 }
 
 void Transaction::updateItem(ItemID id, const UpdateFunctorPointer& functor) {
-    _updatedItems.emplace_back(id, functor);
+    _updatedItems.emplace_back(id, functor, false);
+}
+
+void Transaction::updateItemParallel(ItemID id, const UpdateFunctorPointer& functor) {
+    // the flag goes with this update rather than with the functor, which callers may queue elsewhere too
+    _updatedItems.emplace_back(id, functor, true);
 }
 
 void Transaction::resetSelection(const Selection& selection) {
@@ -181,7 +194,51 @@ void Transaction::clear() {
 }
 
 
+// Transactions enqueued by one thread since the last frame
+struct TransactionBuffer {
+    tbb::spin_mutex mutex; // only ever contended by Scene::enqueueFrame, once per frame
+    TransactionQueue queue;
+};
+using TransactionBufferPointer = std::shared_ptr<TransactionBuffer>;
+
+// The per thread transaction buffers of a Scene
+class render::TransactionBuffers {
+public:
+    TransactionBuffer& local() {
+        bool exists = false;
+        auto& buffer = _threadBuffers.local(exists);
+        if (!exists) {
+            // first transaction from this thread, register its buffer so enqueueFrame can find it
+            buffer = std::make_shared<TransactionBuffer>();
+            std::unique_lock<std::mutex> lock(_buffersMutex);
+            _buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    // Move the transactions of every thread into queue, returns how many there were
+    size_t takeAll(TransactionQueue& queue) {
+        std::unique_lock<std::mutex> lock(_buffersMutex);
+        for (auto& buffer : _buffers) {
+            tbb::spin_mutex::scoped_lock bufferLock(buffer->mutex);
+            if (queue.empty()) {
+                queue.swap(buffer->queue);
+            } else {
+                queue.insert(queue.end(), std::make_move_iterator(buffer->queue.begin()), std::make_move_iterator(buffer->queue.end()));
+                buffer->queue.clear();
+            }
+        }
+        return queue.size();
+    }
+
+private:
+    tbb::enumerable_thread_specific<TransactionBufferPointer> _threadBuffers;
+    std::mutex _buffersMutex; // guards _buffers, taken when a thread enqueues its first transaction and by takeAll
+    std::vector<TransactionBufferPointer> _buffers;
+};
+
 Scene::Scene(glm::vec3 origin, float size) :
+    _transactionBuffers(std::make_unique<TransactionBuffers>()),
     _masterSpatialTree(origin, size)
 {
     _items.push_back(Item()); // add the itemID #0 to nothing
@@ -202,28 +259,28 @@ bool Scene::isAllocatedID(const ItemID& id) const {
 
 /// Enqueue change batch to the scene
 void Scene::enqueueTransaction(const Transaction& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(transaction);
+    auto& buffer = _transactionBuffers->local();
+    tbb::spin_mutex::scoped_lock lock(buffer.mutex);
+    buffer.queue.emplace_back(transaction);
 }
 
 void Scene::enqueueTransaction(Transaction&& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(std::move(transaction));
+    auto& buffer = _transactionBuffers->local();
+    tbb::spin_mutex::scoped_lock lock(buffer.mutex);
+    buffer.queue.emplace_back(std::move(transaction));
 }
 
 uint32_t Scene::enqueueFrame() {
     PROFILE_RANGE(render, __FUNCTION__);
     TransactionQueue localTransactionQueue;
-    {
-        std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-        localTransactionQueue.swap(_transactionQueue);
-    }
+    auto numTransactions = (uint32_t)_transactionBuffers->takeAll(localTransactionQueue);
 
     Transaction consolidatedTransaction;
     consolidatedTransaction.merge(std::move(localTransactionQueue));
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(consolidatedTransaction));
+        _numFramedTransactions += numTransactions;
     }
 
     return ++_transactionFrameNumber;
@@ -234,21 +291,35 @@ void Scene::processTransactionQueue() {
     PROFILE_RANGE(render, __FUNCTION__);
 
     static TransactionFrames queuedFrames;
+    TransactionStats stats;
     {
         // capture the queued frames and clear the queue
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
         queuedFrames.swap(_transactionFrames);
+        stats.numTransactions = _numFramedTransactions;
+        _numFramedTransactions = 0;
     }
 
     // go through the queue of frames and process them
+    auto startTime = usecTimestampNow();
     for (auto& frame : queuedFrames) {
-        processTransactionFrame(frame);
+        processTransactionFrame(frame, stats);
     }
+    stats.applyTime = usecTimestampNow() - startTime;
+    stats.numFrames = (uint32_t)queuedFrames.size();
 
     queuedFrames.clear();
+
+    std::unique_lock<std::mutex> lock(_transactionStatsMutex);
+    _transactionStats = stats;
 }
 
-void Scene::processTransactionFrame(const Transaction& transaction) {
+TransactionStats Scene::getTransactionStats() const {
+    std::unique_lock<std::mutex> lock(_transactionStatsMutex);
+    return _transactionStats;
+}
+
+void Scene::processTransactionFrame(const Transaction& transaction, TransactionStats& stats) {
     PROFILE_RANGE(render, __FUNCTION__);
     {
         std::unique_lock<std::mutex> lock(_itemsMutex);
@@ -268,7 +339,7 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
         _numAllocatedItems.exchange(maxID);
 
         // updates
-        updateItems(transaction._updatedItems);
+        stats.numUpdatedItems += updateItems(transaction._updatedItems);
 
         // removes
         removeItems(transaction._removedItems);
@@ -283,6 +354,10 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
         _numAllocatedItems.exchange(maxID);
     }
 
+    stats.numResets += (uint32_t)transaction._resetItems.size();
+    stats.numUpdates += (uint32_t)transaction._updatedItems.size();
+    stats.numRemoves += (uint32_t)transaction._removedItems.size();
+
     resetSelections(transaction._resetSelections);
 
     resetHighlights(transaction._highlightResets);
@@ -335,27 +410,81 @@ void Scene::removeItems(const Transaction::Removes& transactions) {
     }
 }
 
-void Scene::updateItems(const Transaction::Updates& transactions) {
-    for (auto& update : transactions) {
-        auto updateID = std::get<0>(update);
+// Below this many updated items the cost of spawning tasks outweighs the concurrent payload updates
+const size_t MIN_ITEMS_TO_UPDATE_IN_PARALLEL = 256;
+
+uint32_t Scene::updateItems(const Transaction::Updates& transactions) {
+    // Coalesce the updates per item: sorting on (id, index) groups each item's updates while keeping their order
+    std::vector<std::pair<ItemID, uint32_t>> orderedUpdates;
+    orderedUpdates.reserve(transactions.size());
+    for (uint32_t i = 0; i < (uint32_t)transactions.size(); ++i) {
+        auto updateID = std::get<0>(transactions[i]);
         if (updateID == Item::INVALID_ITEM_ID) {
             continue;
         }
-
-        // Access the true item
-        auto& item = _items[updateID];
-
         // If item doesn't exist it cannot be updated
-        if (!item.exist()) {
+        if (!_items[updateID].exist()) {
             continue;
         }
+        orderedUpdates.emplace_back(updateID, i);
+    }
+    std::sort(orderedUpdates.begin(), orderedUpdates.end());
 
-        // Good to go, deal with the update
-        auto oldCell = item.getCell();
-        auto oldKey = item.getKey();
+    // The first update of each item, and its key before any of them applied
+    std::vector<uint32_t> itemFirstUpdates;
+    for (uint32_t i = 0; i < (uint32_t)orderedUpdates.size(); ++i) {
+        if (i == 0 || orderedUpdates[i].first != orderedUpdates[i - 1].first) {
+            itemFirstUpdates.push_back(i);
+        }
+    }
+    const auto numItems = itemFirstUpdates.size();
+    itemFirstUpdates.push_back((uint32_t)orderedUpdates.size());
+    std::vector<ItemKey> oldKeys(numItems);
+
+    auto updatePayload = [&](size_t i) {
+        auto& item = _items[orderedUpdates[itemFirstUpdates[i]].first];
+        oldKeys[i] = item.getKey();
+        for (auto u = itemFirstUpdates[i]; u < itemFirstUpdates[i + 1]; ++u) {
+            item.update(std::get<1>(transactions[orderedUpdates[u].second]));
+        }
+    };
+
+    // Only the items whose updates were all queued with updateItemParallel may be updated on worker threads, the others
+    // are updated here in order, since their functors may touch state shared with other items
+    std::vector<size_t> parallelItems;
+    if (_parallelUpdatesEnabled) {
+        parallelItems.reserve(numItems);
+    }
+    for (size_t i = 0; i < numItems; ++i) {
+        bool isParallel = _parallelUpdatesEnabled;
+        for (auto u = itemFirstUpdates[i]; isParallel && u < itemFirstUpdates[i + 1]; ++u) {
+            const auto& update = transactions[orderedUpdates[u].second];
+            isParallel = !std::get<1>(update) || std::get<2>(update);
+        }
+        if (isParallel) {
+            parallelItems.push_back(i);
+        } else {
+            updatePayload(i);
+        }
+    }
+    if (parallelItems.size() >= MIN_ITEMS_TO_UPDATE_IN_PARALLEL) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, parallelItems.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                updatePayload(parallelItems[i]);
+            }
+        });
+    } else {
+        for (auto i : parallelItems) {
+            updatePayload(i);
+        }
+    }
 
-        // Update the item
-        item.update(std::get<1>(update));
+    // The containers are shared, update them once per item
+    for (size_t i = 0; i < numItems; ++i) {
+        auto updateID = orderedUpdates[itemFirstUpdates[i]].first;
+        auto& item = _items[updateID];
+        auto oldCell = item.getCell();
+        auto oldKey = oldKeys[i];
         auto newKey = item.getKey();
 
         // Update the item's container
@@ -378,6 +507,8 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
             }
         }
     }
+
+    return (uint32_t)numItems;
 }
 
 void Scene::resetTransitionItems(const Transaction::TransitionResets& transactions) {
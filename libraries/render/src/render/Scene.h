@@ -23,6 +23,7 @@ namespace render {
 
 class RenderEngine;
 class Scene;
+class TransactionBuffers;
 
 // Transaction is the mechanism to make any change to the scene.
 // Whenever a new item need to be reset,
@@ -56,6 +57,13 @@ public:
     void updateItem(ItemID id, const UpdateFunctorPointer& functor);
     void updateItem(ItemID id) { updateItem(id, nullptr); }
 
+    // Same as updateItem, for functors that only touch their own item's payload: the scene may then run them on worker
+    // threads, concurrently with the updates of other items. Updates queued with updateItem always run on the scene thread.
+    template <class T> void updateItemParallel(ItemID id, std::function<void(T&)> func) {
+        updateItemParallel(id, std::make_shared<UpdateFunctor<T>>(func));
+    }
+    void updateItemParallel(ItemID id, const UpdateFunctorPointer& functor);
+
     // Transition (applied to an item) transactions
     void resetTransitionOnItem(ItemID id, Transition::Type transition, ItemID boundId = render::Item::INVALID_ITEM_ID);
     void removeTransitionFromItem(ItemID id);
@@ -80,7 +88,7 @@ protected:
 
     using Reset = std::tuple<ItemID, PayloadPointer>;
     using Remove = ItemID;
-    using Update = std::tuple<ItemID, UpdateFunctorPointer>;
+    using Update = std::tuple<ItemID, UpdateFunctorPointer, bool>; // the flag is set for the updates that may run in parallel
 
     using TransitionReset = std::tuple<ItemID, Transition::Type, ItemID>;
     using TransitionRemove = ItemID;
@@ -125,6 +133,17 @@ protected:
 };
 typedef std::vector<Transaction> TransactionQueue;
 
+// Counts and cost of the transactions applied by the last Scene::processTransactionQueue
+struct TransactionStats {
+    uint32_t numFrames { 0 };
+    uint32_t numTransactions { 0 };
+    uint32_t numResets { 0 };
+    uint32_t numUpdates { 0 };
+    uint32_t numUpdatedItems { 0 }; // distinct items the updates were coalesced into
+    uint32_t numRemoves { 0 };
+    uint64_t applyTime { 0 }; // usecs
+};
+
 
 // Scene is a container for Items
 // Items are introduced, modified or erased in the scene through Transaction
@@ -147,6 +166,8 @@ public:
     size_t getNumItems() const { return _numAllocatedItems.load(); }
 
     // Enqueue transaction to the scene
+    // Each calling thread accumulates into its own buffer, so concurrent callers don't contend with each other.
+    // Transactions keep their order per thread, not across threads.
     void enqueueTransaction(const Transaction& transaction);
 
     // Enqueue transaction to the scene
@@ -158,6 +179,15 @@ public:
     // Process the pending transactions queued
     void processTransactionQueue();
 
+    // Stats of the last processTransactionQueue
+    // Thread safe
+    TransactionStats getTransactionStats() const;
+
+    // Apply the updates queued with Transaction::updateItemParallel concurrently, on by default.
+    // Items with any update queued through Transaction::updateItem are still updated serially, on the calling thread.
+    void setParallelUpdatesEnabled(bool enabled) { _parallelUpdatesEnabled = enabled; }
+    bool isParallelUpdatesEnabled() const { return _parallelUpdatesEnabled; }
+
     // Access a particular selection (empty if doesn't exist)
     // Thread safe
     Selection getSelection(const Selection::Name& name) const;
@@ -199,17 +229,21 @@ protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
-    std::mutex _transactionQueueMutex;
-    TransactionQueue _transactionQueue;
+    std::unique_ptr<TransactionBuffers> _transactionBuffers;
 
-    
     std::mutex _transactionFramesMutex;
     using TransactionFrames = std::vector<Transaction>;
     TransactionFrames _transactionFrames;
+    uint32_t _numFramedTransactions{ 0 };
     uint32_t _transactionFrameNumber{ 0 };
 
+    mutable std::mutex _transactionStatsMutex;
+    TransactionStats _transactionStats;
+
+    std::atomic<bool> _parallelUpdatesEnabled{ true };
+
     // Process one transaction frame 
-    void processTransactionFrame(const Transaction& transaction);
+    void processTransactionFrame(const Transaction& transaction, TransactionStats& stats);
 
     // The actual database
     // database of items is protected for editing by a mutex
@@ -221,7 +255,8 @@ protected:
     void resetItems(const Transaction::Resets& transactions);
     void resetTransitionFinishedOperator(const Transaction::TransitionFinishedOperators& transactions);
     void removeItems(const Transaction::Removes& transactions);
-    void updateItems(const Transaction::Updates& transactions);
+    // Returns the number of distinct items updated
+    uint32_t updateItems(const Transaction::Updates& transactions);
 
     void resetTransitionItems(const Transaction::TransitionResets& transactions);
     void removeTransitionItems(const Transaction::TransitionRemoves& transactions);
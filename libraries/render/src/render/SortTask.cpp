@@ -14,9 +14,14 @@
 
 #include <assert.h>
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
+#include <tbb/parallel_sort.h>
 
 using namespace render;
 
+// Below this many items sorting on the calling thread beats handing the work to the worker threads
+const size_t MIN_ITEMS_TO_SORT_IN_PARALLEL = 4096;
+
 struct ItemBoundSort {
     float _centerDepth = 0.0f;
     float _nearDepth = 0.0f;
@@ -29,13 +34,13 @@ struct ItemBoundSort {
 };
 
 struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
+    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) const {
         return (left._centerDepth < right._centerDepth);
     }
 };
 
 struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
+    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) const {
         return (left._centerDepth > right._centerDepth);
     }
 };
@@ -45,34 +50,48 @@ void render::depthSortItems(const RenderContextPointer& renderContext, bool fron
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
-    auto& scene = renderContext->_scene;
     RenderArgs* args = renderContext->args;
-
+    const ViewFrustum& frustum = args->getViewFrustum();
 
     // Allocate and simply copy
     outItems.clear();
     outItems.reserve(inItems.size());
 
-
     // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
-
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound();
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    std::vector<ItemBoundSort> itemBoundSorts(inItems.size());
+    auto evalItemBoundSort = [&](size_t i) {
+        const auto& bound = inItems[i].bound;
+        float distanceSquared = frustum.distanceToCameraSquared(bound.calcCenter());
+        itemBoundSorts[i] = ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, inItems[i].id, bound);
+    };
+    bool parallel = inItems.size() >= MIN_ITEMS_TO_SORT_IN_PARALLEL;
+    if (parallel) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, inItems.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                evalItemBoundSort(i);
+            }
+        });
+    } else {
+        for (size_t i = 0; i < inItems.size(); ++i) {
+            evalItemBoundSort(i);
+        }
     }
 
     // sort against Z
     if (frontToBack) {
         FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        if (parallel) {
+            tbb::parallel_sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        } else {
+            std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        }
     } else {
         BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        if (parallel) {
+            tbb::parallel_sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        } else {
+            std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        }
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
@@ -118,42 +137,46 @@ void PipelineSortShapes::run(const RenderContextPointer& renderContext, const It
     }
 }
 
-void DepthSortShapes::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes) {
+// Every pipeline's items are sorted on their own, so the pipelines are handed to the worker threads as a whole
+static void depthSortShapes(const RenderContextPointer& renderContext, bool frontToBack, const ShapeBounds& inShapes,
+                            ShapeBounds& outShapes, AABox* outBounds) {
     outShapes.clear();
     outShapes.reserve(inShapes.size());
 
+    std::vector<std::pair<const ItemBounds*, ItemBounds*>> pipelines;
+    pipelines.reserve(inShapes.size());
     for (auto& pipeline : inShapes) {
-        auto& inItems = pipeline.second;
         auto outItems = outShapes.find(pipeline.first);
         if (outItems == outShapes.end()) {
             outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
         }
-
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second);
+        pipelines.emplace_back(&pipeline.second, &outItems->second);
     }
-}
-
-void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs) {
-    auto& outShapes = outputs.edit0();
-    auto& outBounds = outputs.edit1();
-
-    outShapes.clear();
-    outShapes.reserve(inShapes.size());
-    outBounds = AABox();
 
-    for (auto& pipeline : inShapes) {
-        auto& inItems = pipeline.second;
-        auto outItems = outShapes.find(pipeline.first);
-        if (outItems == outShapes.end()) {
-            outItems = outShapes.insert(std::make_pair(pipeline.first, ItemBounds{})).first;
+    std::vector<AABox> pipelineBounds(outBounds ? pipelines.size() : 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, pipelines.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            depthSortItems(renderContext, frontToBack, *pipelines[i].first, *pipelines[i].second,
+                outBounds ? &pipelineBounds[i] : nullptr);
         }
-        AABox bounds;
+    });
 
-        depthSortItems(renderContext, _frontToBack, inItems, outItems->second, &bounds);
-        outBounds += bounds;
+    if (outBounds) {
+        *outBounds = AABox();
+        for (const auto& bounds : pipelineBounds) {
+            *outBounds += bounds;
+        }
     }
 }
 
+void DepthSortShapes::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, ShapeBounds& outShapes) {
+    depthSortShapes(renderContext, _frontToBack, inShapes, outShapes, nullptr);
+}
+
+void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs) {
+    depthSortShapes(renderContext, _frontToBack, inShapes, outputs.edit0(), &outputs.edit1());
+}
+
 void DepthSortItems::run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems) {
     depthSortItems(renderContext, _frontToBack, inItems, outItems);
 }
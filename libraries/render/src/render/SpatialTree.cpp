@@ -11,6 +11,7 @@
 #include "SpatialTree.h"
 
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -627,26 +628,46 @@ int ItemSpatialTree::selectCells(CellSelection& selection, const ViewFrustum& fr
     }
 }
 
-int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
-                                     float threshold) const {
-    selectCells(selection.cellSelection, frustum, threshold);
+// Below this many items the selected bricks are cheaper to copy on the calling thread
+const size_t MIN_ITEMS_TO_GATHER_IN_PARALLEL = 16384;
 
-    // Just grab the items in every selected bricks
-    for (auto brickId : selection.cellSelection.insideBricks) {
-        auto& brickItems = getConcreteBrick(brickId).items;
-        selection.insideItems.insert(selection.insideItems.end(), brickItems.begin(), brickItems.end());
+// Appends the item list picked by brickItems from every brick to items.  The lists are laid out end to end, so with
+// enough items they can be copied on the worker threads once their offsets are known.
+static void gatherBrickItems(const ItemSpatialTree& tree, const Octree::Indices& bricks, std::vector<ItemID> Brick::*brickItems,
+                             ItemIDs& items) {
+    std::vector<size_t> offsets(bricks.size() + 1);
+    offsets[0] = items.size();
+    for (size_t i = 0; i < bricks.size(); ++i) {
+        offsets[i + 1] = offsets[i] + (tree.getConcreteBrick(bricks[i]).*brickItems).size();
+    }
 
-        auto& brickSubcellItems = getConcreteBrick(brickId).subcellItems;
-        selection.insideSubcellItems.insert(selection.insideSubcellItems.end(), brickSubcellItems.begin(), brickSubcellItems.end());
+    if (offsets.back() - offsets.front() < MIN_ITEMS_TO_GATHER_IN_PARALLEL) {
+        items.reserve(offsets.back());
+        for (auto brickId : bricks) {
+            auto& brick = tree.getConcreteBrick(brickId);
+            items.insert(items.end(), (brick.*brickItems).begin(), (brick.*brickItems).end());
+        }
+        return;
     }
 
-    for (auto brickId : selection.cellSelection.partialBricks) {
-        auto& brickItems = getConcreteBrick(brickId).items;
-        selection.partialItems.insert(selection.partialItems.end(), brickItems.begin(), brickItems.end());
+    items.resize(offsets.back());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, bricks.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            auto& brick = tree.getConcreteBrick(bricks[i]);
+            std::copy((brick.*brickItems).begin(), (brick.*brickItems).end(), items.begin() + offsets[i]);
+        }
+    });
+}
 
-        auto& brickSubcellItems = getConcreteBrick(brickId).subcellItems;
-        selection.partialSubcellItems.insert(selection.partialSubcellItems.end(), brickSubcellItems.begin(), brickSubcellItems.end());
-    }
+int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
+                                     float threshold) const {
+    selectCells(selection.cellSelection, frustum, threshold);
+
+    // Just grab the items in every selected bricks
+    gatherBrickItems(*this, selection.cellSelection.insideBricks, &Brick::items, selection.insideItems);
+    gatherBrickItems(*this, selection.cellSelection.insideBricks, &Brick::subcellItems, selection.insideSubcellItems);
+    gatherBrickItems(*this, selection.cellSelection.partialBricks, &Brick::items, selection.partialItems);
+    gatherBrickItems(*this, selection.cellSelection.partialBricks, &Brick::subcellItems, selection.partialSubcellItems);
 
     return (int) selection.numItems();
 }
@@ -18,6 +18,7 @@
 
 #include <QtCore/QDateTime>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QSaveFile>
 #include <QtCore/QStorageInfo>
 
@@ -156,15 +157,9 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
     std::string filepath = getFilepath(metadata.key);
 
     // if file already exists, return it
-    file = getFile(metadata.key);
+    file = getFileToKeep(metadata.key, overwrite);
     if (file) {
-        if (!overwrite) {
-            qCWarning(file_cache, "[%s] Attempted to overwrite %s", _dirname.c_str(), metadata.key.c_str());
-            return file;
-        } else {
-            qCWarning(file_cache, "[%s] Overwriting %s", _dirname.c_str(), metadata.key.c_str());
-            file.reset();
-        }
+        return file;
     }
 
     QSaveFile saveFile(QString::fromStdString(filepath));
@@ -181,6 +176,89 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
 }
 
 
+FilePointer FileCache::writeFile(const Writer& writer, Metadata&& metadata, bool overwrite) {
+    FilePointer file;
+
+    if (0 == metadata.length) {
+        qCWarning(file_cache) << "Cannot store empty files in the cache";
+        return file;
+    }
+
+    Lock lock(_mutex);
+
+    if (!_initialized) {
+        qCWarning(file_cache) << "File cache used before initialization";
+        return file;
+    }
+
+    std::string filepath = getFilepath(metadata.key);
+
+    // if file already exists, return it
+    file = getFileToKeep(metadata.key, overwrite);
+    if (file) {
+        return file;
+    }
+
+    // like QSaveFile, write under another name and only move the file into place once it is complete
+    auto finalPath = QString::fromStdString(filepath);
+    auto partialPath = finalPath + ".partial";
+    bool written = false;
+    {
+        QFile partialFile(partialPath);
+        if (partialFile.open(QIODevice::ReadWrite | QIODevice::Truncate) && partialFile.resize(metadata.length)) {
+            auto mapped = partialFile.map(0, metadata.length);
+            if (mapped) {
+                written = writer(mapped, metadata.length);
+                written = partialFile.unmap(mapped) && written;
+            }
+        }
+    }
+    if (written) {
+        QFile::remove(finalPath);
+        written = QFile::rename(partialPath, finalPath);
+    }
+
+    if (written) {
+        file = addFile(std::move(metadata), filepath);
+    } else {
+        QFile::remove(partialPath);
+        qCWarning(file_cache, "[%s] Failed to write %s", _dirname.c_str(), metadata.key.c_str());
+    }
+    assert(!file || (file->_locked && file->_parent.lock()));
+    return file;
+}
+
+FilePointer FileCache::getFileToKeep(const Key& key, bool overwrite) {
+    auto file = getFile(key);
+    if (file) {
+        if (!overwrite) {
+            qCWarning(file_cache, "[%s] Attempted to overwrite %s", _dirname.c_str(), key.c_str());
+            return file;
+        } else {
+            qCWarning(file_cache, "[%s] Overwriting %s", _dirname.c_str(), key.c_str());
+        }
+    }
+    return FilePointer();
+}
+
+void FileCache::removeFile(const Key& key) {
+    Lock lock(_mutex);
+
+    const auto it = _files.find(key);
+    if (it == _files.cend()) {
+        return;
+    }
+    FilePointer file = it->second.lock();
+    if (!file) {
+        return;
+    }
+
+    // the file is unlinked here rather than when the entry is released, by which time a replacement may have taken its path
+    file->_shouldPersist = true;
+    eject(file);
+    QFile::remove(QString::fromStdString(file->getFilepath()));
+}
+
 FilePointer FileCache::getFile(const Key& key) {
     Lock lock(_mutex);
 
@@ -13,6 +13,7 @@
 #include <atomic>
 #include <memory>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <unordered_set>
 #include <mutex>
@@ -97,12 +98,24 @@ public:
 
     // Add file to the cache and return the cache entry.  
     FilePointer writeFile(const char* data, Metadata&& metadata, bool overwrite = false);
+
+    // Add a file of metadata.length bytes to the cache, which writer fills in place through a mapping of the new file.
+    // The file starts out zeroed, so content that is mostly left blank never needs to be built up in memory first.
+    using Writer = std::function<bool(uint8_t* data, size_t size)>;
+    FilePointer writeFile(const Writer& writer, Metadata&& metadata, bool overwrite = false);
     FilePointer getFile(const Key& key);
 
+    // Remove the entry for key and its file, so that a replacement can be written without overwriting it.
+    // Anyone still holding the entry keeps a pointer to a file that no longer exists.
+    void removeFile(const Key& key);
+
     /// create a file
     virtual std::unique_ptr<File> createFile(Metadata&& metadata, const std::string& filepath);
 
 private:
+    // returns the existing entry for key when it should be kept rather than overwritten
+    FilePointer getFileToKeep(const Key& key, bool overwrite);
+
     using Mutex = std::recursive_mutex;
     using Lock = std::unique_lock<Mutex>;
     using Map = std::unordered_map<Key, std::weak_ptr<File>>;
@@ -36,6 +36,22 @@ StoragePointer Storage::toMemoryStorage() const {
     return std::make_shared<MemoryStorage>(size(), data());
 }
 
+void Storage::touchPages() const {
+    // the smallest page size in use, so no page is skipped where they are larger
+    static const size_t PAGE_BYTES = 4096;
+    auto bytes = data();
+    auto byteCount = size();
+    if (!bytes || byteCount == 0) {
+        return;
+    }
+    volatile uint8_t sink = 0;
+    for (size_t offset = 0; offset < byteCount; offset += PAGE_BYTES) {
+        sink ^= bytes[offset];
+    }
+    sink ^= bytes[byteCount - 1];
+    (void)sink;
+}
+
 StoragePointer Storage::toFileStorage(const QString& filename) const {
     return FileStorage::create(filename, size(), data());
 }
@@ -40,6 +40,10 @@ namespace storage {
         StoragePointer toFileStorage(const QString& filename) const;
         StoragePointer toMemoryStorage() const;
 
+        // Reads a byte of every page, so that the pages of a mapped file are resident before the storage is handed to
+        // a thread that shouldn't wait on the disk
+        void touchPages() const;
+
         // Aliases to prevent having to re-write a ton of code
         inline size_t getSize() const { return size(); }
         inline const uint8_t* readData() const { return data(); }
@@ -10,6 +10,8 @@
 //
 #include "Task.h"
 
+#include <TBBHelpers.h>
+
 using namespace task;
 
 JobContext::JobContext() {
@@ -29,3 +31,12 @@ void TaskFlow::abortTask() {
 bool TaskFlow::doAbortTask() const {
     return _doAbortTask;
 }
+
+void task::runConcurrently(size_t numJobs, const std::function<void(size_t)>& runJob) {
+    // one job per range: jobs are whole subtasks, far coarser than tbb's default grain
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numJobs, 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            runJob(i);
+        }
+    });
+}
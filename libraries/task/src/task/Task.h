@@ -15,6 +15,7 @@
 #include "Config.h"
 #include "Varying.h"
 
+#include <functional>
 #include <unordered_map>
 
 namespace task {
@@ -60,10 +61,19 @@ public:
     // Task flow control
     TaskFlow taskFlow{};
 
+    // A concurrent task runs each of its jobs on its own copy of the context.  detachForConcurrentJob() is called on
+    // every copy so that it stops sharing whatever its job may write to, and once all the jobs are done the original
+    // context joins the copies back in the order their jobs were added.
+    virtual void detachForConcurrentJob() {}
+    virtual void joinConcurrentJob(const JobContext& concurrentContext) {}
+
 protected:
 };
 using JobContextPointer = std::shared_ptr<JobContext>;
 
+// Calls runJob(0) to runJob(numJobs - 1) on the worker threads and returns once all of them have completed
+void runConcurrently(size_t numJobs, const std::function<void(size_t)>& runJob);
+
 // The guts of a job
 class JobConcept {
 public:
@@ -345,6 +355,61 @@ public:
     template <class T, class O, class C = Config> using ModelO = TaskModel<T, C, None, O>;
     template <class T, class I, class O, class C = Config> using ModelIO = TaskModel<T, C, I, O>;
 
+    // A concurrent task runs all of its jobs at once on the worker threads instead of one after the other.
+    // Its jobs must not consume each other's outputs nor record gpu commands, and each of them runs on its own copy of
+    // the context (see JobContext::detachForConcurrentJob).  Aborting from within one of them only ends that job.
+    template <class T, class C = Config, class I = None, class O = None> class ConcurrentTaskModel : public TaskModel<T, C, I, O> {
+    public:
+        ConcurrentTaskModel(const std::string& name, const Varying& input, QConfigPointer config) :
+            TaskModel<T, C, I, O>(name, input, config) {}
+
+        template <class... A>
+        static std::shared_ptr<ConcurrentTaskModel> create(const std::string& name, const Varying& input, A&&... args) {
+            auto model = std::make_shared<ConcurrentTaskModel>(name, input, std::make_shared<C>());
+
+            {
+                TimeProfiler probe("build::" + model->getName());
+                model->_data.build(*(model), model->_input, model->_output, std::forward<A>(args)...);
+            }
+
+            return model;
+        }
+
+        template <class... A>
+        static std::shared_ptr<ConcurrentTaskModel> create(const std::string& name, A&&... args) {
+            const auto input = Varying(I());
+            return create(name, input, std::forward<A>(args)...);
+        }
+
+        void run(const ContextPointer& jobContext) override {
+            auto config = std::static_pointer_cast<C>(Concept::_config);
+            if (config->isEnabled()) {
+                auto& jobs = TaskConcept::_jobs;
+                std::vector<ContextPointer> jobContexts;
+                jobContexts.reserve(jobs.size());
+                for (size_t i = 0; i < jobs.size(); ++i) {
+                    auto concurrentContext = std::make_shared<Context>(*jobContext);
+                    concurrentContext->jobConfig.reset();
+                    concurrentContext->taskFlow.reset();
+                    concurrentContext->detachForConcurrentJob();
+                    jobContexts.push_back(concurrentContext);
+                }
+
+                runConcurrently(jobs.size(), [&](size_t i) {
+                    jobs[i].run(jobContexts[i]);
+                });
+
+                for (const auto& concurrentContext : jobContexts) {
+                    jobContext->joinConcurrentJob(*concurrentContext);
+                }
+            }
+        }
+    };
+    template <class T, class C = Config> using ConcurrentModel = ConcurrentTaskModel<T, C, None, None>;
+    template <class T, class I, class C = Config> using ConcurrentModelI = ConcurrentTaskModel<T, C, I, None>;
+    template <class T, class O, class C = Config> using ConcurrentModelO = ConcurrentTaskModel<T, C, None, O>;
+    template <class T, class I, class O, class C = Config> using ConcurrentModelIO = ConcurrentTaskModel<T, C, I, O>;
+
     // Create a new job in the Task's queue; returns the job's output
     template <class T, class... A> const Varying addJob(std::string name, const Varying& input, A&&... args) {
         return std::static_pointer_cast<TaskConcept>(JobType::_concept)->template addJob<T>(name, input, std::forward<A>(args)...);
@@ -0,0 +1,130 @@
+//
+//  ProxyGrid.cpp
+//  libraries/workload/src/workload
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ProxyGrid.h"
+
+using namespace workload;
+
+const float ProxyGrid::CELL_SIZE = 16.0f;
+
+// cells are packed 21 bits per axis, the all-ones key can't be a cell and holds the large proxies
+const uint64_t CELL_COORD_BITS = 21;
+const int32_t CELL_COORD_OFFSET = 1 << (CELL_COORD_BITS - 1);
+const uint64_t CELL_COORD_MASK = (1ULL << CELL_COORD_BITS) - 1;
+const uint64_t LARGE_PROXIES_KEY = ~0ULL;
+
+ProxyGrid::CellKey ProxyGrid::evalCellKey(const glm::ivec3& cell) {
+    uint64_t x = (uint64_t)(cell.x + CELL_COORD_OFFSET) & CELL_COORD_MASK;
+    uint64_t y = (uint64_t)(cell.y + CELL_COORD_OFFSET) & CELL_COORD_MASK;
+    uint64_t z = (uint64_t)(cell.z + CELL_COORD_OFFSET) & CELL_COORD_MASK;
+    return x | (y << CELL_COORD_BITS) | (z << (2 * CELL_COORD_BITS));
+}
+
+glm::ivec3 ProxyGrid::evalCell(const glm::vec3& position) {
+    const float MAX_CELL_COORD = (float)(CELL_COORD_OFFSET - 1);
+    glm::vec3 cell = glm::clamp(glm::floor(position / CELL_SIZE), -MAX_CELL_COORD, MAX_CELL_COORD);
+    return glm::ivec3(cell);
+}
+
+void ProxyGrid::insert(ProxyID id, CellKey key) {
+    auto& cell = _cells[key];
+    auto& location = _locations[id];
+    location.key = key;
+    location.slot = (uint32_t)cell.size();
+    location.inGrid = true;
+    cell.push_back(id);
+}
+
+void ProxyGrid::reset(ProxyID id, const Sphere& sphere) {
+    if (id < 0) {
+        return;
+    }
+    if (id >= (ProxyID)_locations.size()) {
+        _locations.resize(id + 1);
+    }
+    // proxies larger than a cell would have to be found from too many cells away
+    CellKey key = (sphere.w > CELL_SIZE) ? LARGE_PROXIES_KEY : evalCellKey(evalCell(glm::vec3(sphere)));
+    const auto& location = _locations[id];
+    if (location.inGrid) {
+        if (location.key == key) {
+            return;
+        }
+        remove(id);
+    }
+    insert(id, key);
+}
+
+void ProxyGrid::remove(ProxyID id) {
+    if (id < 0 || id >= (ProxyID)_locations.size() || !_locations[id].inGrid) {
+        return;
+    }
+    auto& location = _locations[id];
+    auto cellItr = _cells.find(location.key);
+    assert(cellItr != _cells.end());
+    auto& cell = cellItr->second;
+
+    // swap the last proxy of the cell into the freed slot
+    ProxyID lastID = cell.back();
+    cell[location.slot] = lastID;
+    _locations[lastID].slot = location.slot;
+    cell.pop_back();
+    if (cell.empty()) {
+        _cells.erase(cellItr);
+    }
+    location = Location();
+}
+
+void ProxyGrid::clear() {
+    _cells.clear();
+    _locations.clear();
+}
+
+void ProxyGrid::appendCell(CellKey key, IndexVector& proxies) const {
+    auto cellItr = _cells.find(key);
+    if (cellItr != _cells.end()) {
+        proxies.insert(proxies.end(), cellItr->second.begin(), cellItr->second.end());
+    }
+}
+
+void ProxyGrid::selectProxies(const Sphere& sphere, IndexVector& proxies) const {
+    appendCell(LARGE_PROXIES_KEY, proxies);
+
+    // the other proxies are no larger than a cell, so they touch the sphere only if their center is within a cell of it
+    glm::vec3 center(sphere);
+    float reach = sphere.w + CELL_SIZE;
+    glm::ivec3 minCell = evalCell(center - glm::vec3(reach));
+    glm::ivec3 maxCell = evalCell(center + glm::vec3(reach));
+    glm::dvec3 span = glm::dvec3(maxCell - minCell) + glm::dvec3(1.0);
+    double numCellsInRange = span.x * span.y * span.z;
+
+    if (numCellsInRange <= (double)_cells.size()) {
+        for (int32_t x = minCell.x; x <= maxCell.x; ++x) {
+            for (int32_t y = minCell.y; y <= maxCell.y; ++y) {
+                for (int32_t z = minCell.z; z <= maxCell.z; ++z) {
+                    appendCell(evalCellKey(glm::ivec3(x, y, z)), proxies);
+                }
+            }
+        }
+    } else {
+        // the sphere spans more cells than are occupied: visit the occupied ones instead
+        for (const auto& cell : _cells) {
+            if (cell.first == LARGE_PROXIES_KEY) {
+                continue;
+            }
+            glm::ivec3 coords(
+                (int32_t)(cell.first & CELL_COORD_MASK) - CELL_COORD_OFFSET,
+                (int32_t)((cell.first >> CELL_COORD_BITS) & CELL_COORD_MASK) - CELL_COORD_OFFSET,
+                (int32_t)((cell.first >> (2 * CELL_COORD_BITS)) & CELL_COORD_MASK) - CELL_COORD_OFFSET);
+            if (glm::all(glm::greaterThanEqual(coords, minCell)) && glm::all(glm::lessThanEqual(coords, maxCell))) {
+                proxies.insert(proxies.end(), cell.second.begin(), cell.second.end());
+            }
+        }
+    }
+}
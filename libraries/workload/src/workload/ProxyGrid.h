@@ -0,0 +1,57 @@
+//
+//  ProxyGrid.h
+//  libraries/workload/src/workload
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_workload_ProxyGrid_h
+#define hifi_workload_ProxyGrid_h
+
+#include <cassert>
+#include <unordered_map>
+
+#include "Transaction.h"
+
+namespace workload {
+
+// Uniform grid over the proxies of a Space, so the proxies around a region can be found without visiting them all.
+// A proxy lives in the cell holding its center, or in a separate list when it is larger than a cell.
+class ProxyGrid {
+public:
+    static const float CELL_SIZE;
+
+    // Insert the proxy, or move it to the cell of its new sphere
+    void reset(ProxyID id, const Sphere& sphere);
+    void remove(ProxyID id);
+    void clear();
+
+    // Append every proxy that might touch sphere, possibly with a few that don't
+    void selectProxies(const Sphere& sphere, IndexVector& proxies) const;
+
+    uint32_t getNumCells() const { return (uint32_t)_cells.size(); }
+
+private:
+    using CellKey = uint64_t;
+    static CellKey evalCellKey(const glm::ivec3& cell);
+    static glm::ivec3 evalCell(const glm::vec3& position);
+
+    struct Location {
+        CellKey key { 0 };
+        uint32_t slot { 0 };
+        bool inGrid { false };
+    };
+
+    void insert(ProxyID id, CellKey key);
+    void appendCell(CellKey key, IndexVector& proxies) const;
+
+    std::unordered_map<CellKey, IndexVector> _cells;
+    std::vector<Location> _locations; // indexed by ProxyID
+};
+
+} // namespace workload
+
+#endif // hifi_workload_ProxyGrid_h
@@ -15,11 +15,50 @@
 #include "Space.h"
 #include <cstring>
 #include <algorithm>
+#include <numeric>
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
+// A view's region must move or resize by more than this fraction of its radius to reclassify the proxies around it
+const float REGION_CHANGE_TOLERANCE = 0.02f;
+
+// Below this many proxies the cost of spawning tasks outweighs the parallel classification
+const size_t MIN_PROXIES_TO_CLASSIFY_IN_PARALLEL = 1024;
+
+static bool hasViewChanged(const View& classifiedView, const View& view) {
+    for (uint32_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+        const auto& classifiedRegion = classifiedView.regions[k];
+        const auto& region = view.regions[k];
+        float change = glm::distance(glm::vec3(classifiedRegion), glm::vec3(region)) + fabsf(classifiedRegion.w - region.w);
+        if (!(change <= REGION_CHANGE_TOLERANCE * classifiedRegion.w)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint8_t classifyProxy(const Proxy& proxy, const Views& views) {
+    glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
+    float proxyRadius = proxy.sphere.w;
+    uint8_t region = Region::R4;
+    for (uint32_t j = 0; j < (uint32_t)views.size(); ++j) {
+        auto& view = views[j];
+        // for each 'view' we need only increment 'k' below the current value of 'region'
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = proxyRadius + view.regions[k].w;
+            if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
 Space::Space() : Collection() {
 }
 
@@ -31,6 +70,7 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     if (maxID > (Index) _proxies.size()) {
         _proxies.resize(maxID + 100); // allocate the maxId and more
         _owners.resize(maxID + 100);
+        _dirtyFlags.resize(maxID + 100, 0);
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -56,6 +96,9 @@ void Space::processResets(const Transaction::Resets& transactions) {
         item.prevRegion = item.region = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
+
+        _grid.reset(proxyID, item.sphere);
+        markDirty(proxyID);
     }
 }
 
@@ -72,6 +115,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         // Kill it
         item.prevRegion = item.region = Region::INVALID;
         _owners[removedID] = Owner();
+
+        _grid.remove(removedID);
     }
 }
 
@@ -86,38 +131,111 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
         auto& item = _proxies[updateID];
 
         // Update the item
-        item.sphere = (std::get<1>(update));
+        const auto& sphere = std::get<1>(update);
+        if (item.sphere != sphere) {
+            item.sphere = sphere;
+            if (item.region != Region::INVALID) {
+                _grid.reset(updateID, sphere);
+                markDirty(updateID);
+            }
+        }
+    }
+}
+
+void Space::markDirty(ProxyID id) {
+    if (!_dirtyFlags[id]) {
+        _dirtyFlags[id] = 1;
+        _dirtyProxies.push_back(id);
+    }
+}
+
+void Space::markDirtyAround(const Sphere& region) {
+    IndexVector proxies;
+    _grid.selectProxies(region, proxies);
+    for (auto id : proxies) {
+        markDirty(id);
     }
 }
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // the proxies that changed region last time have settled in it
+    for (auto id : _changedProxies) {
+        Proxy& proxy = _proxies[id];
         if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
-            uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
-                        region = k;
-                        break;
-                    }
+            proxy.prevRegion = proxy.region;
+        }
+    }
+    _changedProxies.clear();
+
+    // a view that changed significantly may have moved any proxy touching its regions, before or after
+    bool reclassifyAll = (_views.size() != _classifiedViews.size());
+    if (!reclassifyAll) {
+        for (uint32_t j = 0; j < (uint32_t)_views.size(); ++j) {
+            if (hasViewChanged(_classifiedViews[j], _views[j])) {
+                for (uint32_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+                    markDirtyAround(_classifiedViews[j].regions[k]);
+                    markDirtyAround(_views[j].regions[k]);
                 }
+                _classifiedViews[j] = _views[j];
             }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+        }
+    }
+
+    IndexVector proxies;
+    proxies.swap(_dirtyProxies);
+    for (auto id : proxies) {
+        _dirtyFlags[id] = 0;
+    }
+    if (reclassifyAll) {
+        _classifiedViews = _views;
+        proxies.resize(_proxies.size());
+        std::iota(proxies.begin(), proxies.end(), 0);
+    } else {
+        // keep the changes in proxy order
+        std::sort(proxies.begin(), proxies.end());
+    }
+
+    // proxies are classified independently of each other
+    auto classifyProxies = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Proxy& proxy = _proxies[proxies[i]];
+            if (proxy.region < Region::INVALID) {
+                proxy.prevRegion = proxy.region;
+                proxy.region = classifyProxy(proxy, _classifiedViews);
             }
         }
+    };
+    if (proxies.size() >= MIN_PROXIES_TO_CLASSIFY_IN_PARALLEL) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, proxies.size()), [&](const tbb::blocked_range<size_t>& range) {
+            classifyProxies(range.begin(), range.end());
+        });
+    } else {
+        classifyProxies(0, proxies.size());
+    }
+
+    for (auto id : proxies) {
+        Proxy& proxy = _proxies[id];
+        if (proxy.region < Region::INVALID && proxy.region != proxy.prevRegion) {
+            changes.emplace_back(Space::Change((int32_t)id, proxy.region, proxy.prevRegion));
+            _changedProxies.push_back(id);
+        }
     }
+
+    _classificationTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - startTime);
+    _numClassifiedProxies = (uint32_t)proxies.size();
+}
+
+std::chrono::nanoseconds Space::getClassificationTime() const {
+    std::unique_lock<std::mutex> lock(_proxiesMutex);
+    return _classificationTime;
+}
+
+uint32_t Space::getNumClassifiedProxies() const {
+    std::unique_lock<std::mutex> lock(_proxiesMutex);
+    return _numClassifiedProxies;
 }
 
 uint32_t Space::copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const {
@@ -161,7 +279,12 @@ void Space::clear() {
     _IDAllocator.clear();
     _proxies.clear();
     _owners.clear();
+    _grid.clear();
+    _dirtyFlags.clear();
+    _dirtyProxies.clear();
+    _changedProxies.clear();
     _views.clear();
+    _classifiedViews.clear();
 }
 
 void Space::setViews(const Views& views) {
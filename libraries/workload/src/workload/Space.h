@@ -15,10 +15,12 @@
 #ifndef hifi_workload_Space_h
 #define hifi_workload_Space_h
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <glm/glm.hpp>
 
+#include "ProxyGrid.h"
 #include "Transaction.h"
 
 namespace workload {
@@ -45,6 +47,8 @@ public:
     uint32_t getNumObjects() const { return _IDAllocator.getNumLiveIndices(); }
     uint32_t getNumAllocatedProxies() const { return (uint32_t)(_IDAllocator.getNumAllocatedIndices()); }
 
+    // Only reclassifies the proxies that moved, and those around the views that changed significantly.
+    // A view that changed less than that stays classified against as it was.
     void categorizeAndGetChanges(std::vector<Change>& changes);
     uint32_t copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const;
     uint32_t copySelectedProxyValues(Proxy::Vector& proxies, const workload::indexed_container::Indices& indices) const;
@@ -52,6 +56,10 @@ public:
     const Owner getOwner(int32_t proxyID) const;
     uint8_t getRegion(int32_t proxyID) const;
 
+    // Duration of the last categorizeAndGetChanges, and how many proxies it reclassified
+    std::chrono::nanoseconds getClassificationTime() const;
+    uint32_t getNumClassifiedProxies() const;
+
     void clear() override;
 private:
 
@@ -60,12 +68,25 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
+    void markDirty(ProxyID id);
+    void markDirtyAround(const Sphere& region);
+
     // The database of proxies is protected for editing by a mutex
     mutable std::mutex _proxiesMutex;
     Proxy::Vector _proxies;
     std::vector<Owner> _owners;
 
+    // Proxies waiting to be reclassified, and those whose region changed on the last classification
+    ProxyGrid _grid;
+    std::vector<uint8_t> _dirtyFlags;
+    IndexVector _dirtyProxies;
+    IndexVector _changedProxies;
+
     Views _views;
+    Views _classifiedViews; // the views the proxies are currently classified against
+
+    std::chrono::nanoseconds _classificationTime { 0 };
+    uint32_t _numClassifiedProxies { 0 };
 };
 
 using SpacePointer = std::shared_ptr<Space>;
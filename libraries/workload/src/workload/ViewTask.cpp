@@ -123,9 +123,14 @@ void ControlViews::run(const workload::WorkloadContextPointer& runContext, const
         // inTimings[3] = postPhysics
         // inTimings[4] = non-physical kinematics
         // inTimings[5] = game loop
+        // inTimings[6] = space classification
         _dataExport.timings[workload::Region::R1] = std::chrono::duration<float, std::milli>(inTimings[2] + inTimings[3]).count();
         _dataExport.timings[workload::Region::R2] = _dataExport.timings[workload::Region::R1];
         _dataExport.timings[workload::Region::R3] = std::chrono::duration<float, std::milli>(inTimings[4]).count();
+        _dataExport._timings.clear();
+        for (const auto& timing : inTimings) {
+            _dataExport._timings.push_back(std::chrono::duration<qreal, std::milli>(timing).count());
+        }
         doExport = true;
     }
 
@@ -180,6 +185,7 @@ void ControlViews::regulateViews(workload::Views& outViews, const workload::Timi
     // timings[3] = postPhysics
     // timings[4] = non-physical kinematics
     // timings[5] = game loop
+    // timings[6] = space classification
 
     auto loopDuration = timings[5];
     regionBackFronts[workload::Region::R1] = regionRegulators[workload::Region::R1].run(loopDuration, timings[2] + timings[3], regionBackFronts[workload::Region::R1]);
@@ -40,14 +40,27 @@ bool HiFiCodec::isSupported() const {
 class HiFiEncoder : public Encoder, public AudioEncoder {
 public:
     HiFiEncoder(int sampleRate, int numChannels) : AudioEncoder(sampleRate, numChannels) { 
-        _encodedSize = (AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL * sizeof(int16_t) * numChannels) / 4;  // codec reduces by 1/4th
+        _decodedSize = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL * sizeof(int16_t) * numChannels;
+        _encodedSize = _decodedSize / 4;  // codec reduces by 1/4th
     }
 
     virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) override {
         encodedBuffer.resize(_encodedSize);
         AudioEncoder::process((const int16_t*)decodedBuffer.constData(), (int16_t*)encodedBuffer.data(), AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
     }
+
+    virtual int encodeInto(const char* decodedBuffer, int decodedSize, char* encodedBuffer, int encodedCapacity) override {
+        // the codec always reads a whole frame
+        if (decodedSize < _decodedSize || _encodedSize > encodedCapacity) {
+            return -1;
+        }
+        AudioEncoder::process((const int16_t*)decodedBuffer, (int16_t*)encodedBuffer, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        return _encodedSize;
+    }
+
+    virtual int getMaxEncodedSize(int decodedSize) const override { return _encodedSize; }
 private:
+    int _decodedSize;
     int _encodedSize;
 };
 
@@ -62,6 +75,14 @@ public:
         AudioDecoder::process((const int16_t*)encodedBuffer.constData(), (int16_t*)decodedBuffer.data(), AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL, true);
     }
 
+    virtual int decodeInto(const char* encodedBuffer, int encodedSize, QByteArray& decodedBuffer) override {
+        if (_decodedSize > decodedBuffer.size()) {
+            decodedBuffer.resize(_decodedSize);
+        }
+        AudioDecoder::process((const int16_t*)encodedBuffer, (int16_t*)decodedBuffer.data(), AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL, true);
+        return _decodedSize;
+    }
+
     virtual void lostFrame(QByteArray& decodedBuffer) override {
         decodedBuffer.resize(_decodedSize);
         // this performs packet loss interpolation
@@ -43,10 +43,28 @@ public:
         decodedBuffer = encodedBuffer;
     }
 
+    virtual int encodeInto(const char* decodedBuffer, int decodedSize, char* encodedBuffer, int encodedCapacity) override {
+        if (decodedSize > encodedCapacity) {
+            return -1;
+        }
+        memcpy(encodedBuffer, decodedBuffer, decodedSize);
+        return decodedSize;
+    }
+
+    virtual int decodeInto(const char* encodedBuffer, int encodedSize, QByteArray& decodedBuffer) override {
+        if (encodedSize > decodedBuffer.size()) {
+            decodedBuffer.resize(encodedSize);
+        }
+        memcpy(decodedBuffer.data(), encodedBuffer, encodedSize);
+        return encodedSize;
+    }
+
     virtual void lostFrame(QByteArray& decodedBuffer) override {
         memset(decodedBuffer.data(), 0, decodedBuffer.size());
     }
 
+    virtual bool isStateless() const override { return true; }
+
 private:
     static const char* NAME;
 };
@@ -76,6 +94,13 @@ public:
         encodedBuffer = qCompress(decodedBuffer);
     }
 
+    // qCompress adds a 4 byte length header, and deflate can expand incompressible input by a few bytes per block
+    virtual int getMaxEncodedSize(int decodedSize) const override {
+        const int QCOMPRESS_HEADER_SIZE = 4;
+        const int DEFLATE_OVERHEAD = 64;
+        return decodedSize + decodedSize / 1000 + QCOMPRESS_HEADER_SIZE + DEFLATE_OVERHEAD;
+    }
+
     virtual void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) override {
         decodedBuffer = qUncompress(encodedBuffer);
     }
@@ -84,6 +109,8 @@ public:
         memset(decodedBuffer.data(), 0, decodedBuffer.size());
     }
 
+    virtual bool isStateless() const override { return true; }
+
 private:
     static const char* NAME;
 };
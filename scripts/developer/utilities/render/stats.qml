@@ -97,6 +97,35 @@ Item {
             ]
         }
 
+        PlotPerf {
+            title: "Scene Transactions"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            plots: [
+                {
+                    prop: "transactionCount",
+                    label: "Transactions",
+                    color: "#00B4EF"
+                },
+                {
+                    prop: "transactionUpdateCount",
+                    label: "Updates",
+                    color: "#E2334D"
+                },
+                {
+                    prop: "transactionUpdatedItemCount",
+                    label: "Updated Items",
+                    color: "#1AC567"
+                },
+                {
+                    prop: "transactionApplyTime",
+                    label: "Apply",
+                    color: "#FED959",
+                    unit: "us"
+                }
+            ]
+        }
+
         property var drawOpaqueConfig: Render.getConfig("RenderMainView.DrawOpaqueDeferred")
         property var drawTransparentConfig: Render.getConfig("RenderMainView.DrawTransparentDeferred")
         property var drawLightConfig: Render.getConfig("RenderMainView.DrawLight")
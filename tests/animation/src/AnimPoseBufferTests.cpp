@@ -0,0 +1,213 @@
+//
+//  AnimPoseBufferTests.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseBufferTests.h"
+
+#include <AnimPoseBuffer.h>
+#include <AnimUtil.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(AnimPoseBufferTests)
+
+// roughly the size of a full avatar skeleton, with fingers
+const int NUM_TEST_JOINTS = 100;
+const float TEST_EPSILON = 0.0001f;
+
+static float randFloat(float min, float max) {
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static AnimPose randomPose() {
+    glm::vec3 axis = glm::normalize(glm::vec3(randFloat(-1.0f, 1.0f), randFloat(-1.0f, 1.0f), randFloat(0.1f, 1.0f)));
+    glm::quat rot = glm::angleAxis(randFloat(-PI, PI), axis);
+    glm::vec3 trans(randFloat(-0.5f, 0.5f), randFloat(-0.5f, 0.5f), randFloat(-0.5f, 0.5f));
+    return AnimPose(glm::vec3(1.0f), rot, trans);
+}
+
+static AnimPoseVec randomPoses(int numPoses) {
+    AnimPoseVec poses;
+    for (int i = 0; i < numPoses; i++) {
+        poses.push_back(randomPose());
+    }
+    return poses;
+}
+
+// a branching hierarchy with every parent listed before its children, as AnimSkeleton expects.
+static std::vector<int> randomParentIndices(int numJoints) {
+    std::vector<int> parentIndices;
+    parentIndices.push_back(-1);
+    for (int i = 1; i < numJoints; i++) {
+        parentIndices.push_back(rand() % i);
+    }
+    return parentIndices;
+}
+
+// rotations may come out with either sign
+static void comparePoses(const AnimPose& actual, const AnimPose& expected) {
+    QCOMPARE_WITH_ABS_ERROR(actual.scale(), expected.scale(), TEST_EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(actual.trans(), expected.trans(), TEST_EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(fabsf(glm::dot(actual.rot(), expected.rot())), 1.0f, TEST_EPSILON);
+}
+
+void AnimPoseBufferTests::testRoundTrip() {
+    AnimPoseVec poses = randomPoses(13);
+    AnimPoseBuffer buffer;
+    buffer.fromPoses(poses);
+    QCOMPARE(buffer.size(), 13);
+    QCOMPARE(buffer.getStride(), 16);
+
+    AnimPoseVec result;
+    buffer.toPoses(result);
+    QCOMPARE((int)result.size(), 13);
+    for (int i = 0; i < 13; i++) {
+        comparePoses(result[i], poses[i]);
+    }
+
+    // the padding is identity
+    QCOMPARE(buffer.component(AnimPoseBuffer::RotW)[15], 1.0f);
+    QCOMPARE(buffer.component(AnimPoseBuffer::ScaleY)[15], 1.0f);
+    QCOMPARE(buffer.component(AnimPoseBuffer::TransX)[15], 0.0f);
+
+    // shrinking re-pads with identity
+    buffer.resize(10);
+    QCOMPARE(buffer.component(AnimPoseBuffer::TransZ)[12], 0.0f);
+    QCOMPARE(buffer.component(AnimPoseBuffer::RotW)[12], 1.0f);
+}
+
+void AnimPoseBufferTests::testBlend() {
+    const float ALPHA = 0.3f;
+    AnimPoseVec a = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec b = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec expected(NUM_TEST_JOINTS);
+    ::blend(NUM_TEST_JOINTS, a.data(), b.data(), ALPHA, expected.data());
+
+    AnimPoseBuffer aBuffer, bBuffer, resultBuffer;
+    aBuffer.fromPoses(a);
+    bBuffer.fromPoses(b);
+    ::blend(aBuffer, bBuffer, ALPHA, resultBuffer);
+
+    for (int i = 0; i < NUM_TEST_JOINTS; i++) {
+        comparePoses(resultBuffer.getPose(i), expected[i]);
+    }
+}
+
+void AnimPoseBufferTests::testMultiply() {
+    AnimPoseVec a = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec b = randomPoses(NUM_TEST_JOINTS);
+
+    AnimPoseBuffer aBuffer, bBuffer, resultBuffer;
+    aBuffer.fromPoses(a);
+    bBuffer.fromPoses(b);
+    ::multiply(aBuffer, bBuffer, resultBuffer);
+
+    for (int i = 0; i < NUM_TEST_JOINTS; i++) {
+        comparePoses(resultBuffer.getPose(i), a[i] * b[i]);
+    }
+}
+
+void AnimPoseBufferTests::testHierarchy() {
+    // 0 is the root, with children 1 and 4, and 1 has children 2 and 3
+    std::vector<int> parentIndices = { -1, 0, 1, 1, 0 };
+    AnimPoseHierarchy hierarchy(parentIndices);
+
+    QCOMPARE(hierarchy.getNumLevels(), 3);
+    QCOMPARE(hierarchy.getOrder(), std::vector<int>({ 0, 1, 4, 2, 3 }));
+    QCOMPARE(hierarchy.getLevelOffsets(), std::vector<int>({ 0, 1, 3, 5 }));
+    QCOMPARE(hierarchy.getParentSlots(), std::vector<int>({ -1, 0, 0, 1, 1 }));
+}
+
+void AnimPoseBufferTests::testRelativeToAbsolute() {
+    std::vector<int> parentIndices = randomParentIndices(NUM_TEST_JOINTS);
+    AnimPoseHierarchy hierarchy(parentIndices);
+    AnimPoseVec poses = randomPoses(NUM_TEST_JOINTS);
+
+    // same loop as AnimSkeleton::convertRelativePosesToAbsolute
+    AnimPoseVec expected = poses;
+    for (int i = 0; i < NUM_TEST_JOINTS; i++) {
+        if (parentIndices[i] != -1) {
+            expected[i] = expected[parentIndices[i]] * expected[i];
+        }
+    }
+
+    AnimPoseBuffer buffer;
+    buffer.fromPoses(poses, hierarchy.getOrder());
+    ::convertRelativePosesToAbsolute(hierarchy, buffer);
+    AnimPoseVec result(NUM_TEST_JOINTS);
+    buffer.toPoses(result, hierarchy.getOrder());
+
+    for (int i = 0; i < NUM_TEST_JOINTS; i++) {
+        comparePoses(result[i], expected[i]);
+    }
+}
+
+void AnimPoseBufferTests::benchmarkBlend_data() {
+    QTest::addColumn<bool>("useBuffer");
+    QTest::newRow("AnimPoseVec") << false;
+    QTest::newRow("AnimPoseBuffer") << true;
+}
+
+void AnimPoseBufferTests::benchmarkBlend() {
+    QFETCH(bool, useBuffer);
+    const float ALPHA = 0.3f;
+
+    AnimPoseVec a = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec b = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec result(NUM_TEST_JOINTS);
+    AnimPoseBuffer aBuffer, bBuffer, resultBuffer;
+    aBuffer.fromPoses(a);
+    bBuffer.fromPoses(b);
+    resultBuffer.resize(NUM_TEST_JOINTS);
+
+    if (useBuffer) {
+        QBENCHMARK {
+            ::blend(aBuffer, bBuffer, ALPHA, resultBuffer);
+        }
+    } else {
+        QBENCHMARK {
+            ::blend(NUM_TEST_JOINTS, a.data(), b.data(), ALPHA, result.data());
+        }
+    }
+}
+
+void AnimPoseBufferTests::benchmarkRelativeToAbsolute_data() {
+    QTest::addColumn<bool>("useBuffer");
+    QTest::newRow("AnimPoseVec") << false;
+    QTest::newRow("AnimPoseBuffer") << true;
+}
+
+void AnimPoseBufferTests::benchmarkRelativeToAbsolute() {
+    QFETCH(bool, useBuffer);
+
+    std::vector<int> parentIndices = randomParentIndices(NUM_TEST_JOINTS);
+    AnimPoseHierarchy hierarchy(parentIndices);
+    AnimPoseVec relativePoses = randomPoses(NUM_TEST_JOINTS);
+    AnimPoseVec poses(NUM_TEST_JOINTS);
+    AnimPoseBuffer buffer;
+
+    if (useBuffer) {
+        // include the conversion in and out of hierarchy order, which is what a caller holding AnimPoseVecs would pay.
+        QBENCHMARK {
+            buffer.fromPoses(relativePoses, hierarchy.getOrder());
+            ::convertRelativePosesToAbsolute(hierarchy, buffer);
+            buffer.toPoses(poses, hierarchy.getOrder());
+        }
+    } else {
+        QBENCHMARK {
+            poses = relativePoses;
+            for (int i = 0; i < NUM_TEST_JOINTS; i++) {
+                if (parentIndices[i] != -1) {
+                    poses[i] = poses[parentIndices[i]] * poses[i];
+                }
+            }
+        }
+    }
+}
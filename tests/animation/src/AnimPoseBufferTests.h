@@ -0,0 +1,30 @@
+//
+//  AnimPoseBufferTests.h
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseBufferTests_h
+#define hifi_AnimPoseBufferTests_h
+
+#include <QtTest/QtTest>
+
+class AnimPoseBufferTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testRoundTrip();
+    void testBlend();
+    void testMultiply();
+    void testHierarchy();
+    void testRelativeToAbsolute();
+
+    void benchmarkBlend_data();
+    void benchmarkBlend();
+    void benchmarkRelativeToAbsolute_data();
+    void benchmarkRelativeToAbsolute();
+};
+
+#endif // hifi_AnimPoseBufferTests_h
@@ -0,0 +1,253 @@
+//
+//  AnimVariantTests.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimVariantTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <AnimVariant.h>
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(AnimVariantTests)
+
+// roughly the number of variables Rig sets on _animVars every frame
+const int NUM_BENCHMARK_VARS = 400;
+const float TEST_EPSILON = 0.0001f;
+const int NUM_TEST_THREADS = 8;
+
+void AnimVariantTests::testKeyMatchesName() {
+    AnimVariantMap map;
+    AnimVariantKey floatKey("animVariantTestFloat");
+    AnimVariantKey vecKey("animVariantTestVec");
+    AnimVariantKey missingKey("animVariantTestMissing");
+
+    map.set("animVariantTestFloat", 2.5f);
+    map.set(vecKey, glm::vec3(1.0f, 2.0f, 3.0f));
+    map.set("animVariantTestString", QString("idle"));
+
+    QCOMPARE(map.lookup(floatKey, 0.0f), 2.5f);
+    QCOMPARE_WITH_ABS_ERROR(map.lookupRaw("animVariantTestVec", glm::vec3()), glm::vec3(1.0f, 2.0f, 3.0f), TEST_EPSILON);
+    QCOMPARE(map.lookup(AnimVariantKey("animVariantTestString"), QString()), QString("idle"));
+    QVERIFY(map.hasKey(floatKey));
+    QVERIFY(map.hasKey("animVariantTestVec"));
+
+    // keys that were interned but never set, and names that were never interned, both fall back to the default.
+    QVERIFY(!map.hasKey(missingKey));
+    QCOMPARE(map.lookup(missingKey, 7), 7);
+    QCOMPARE(map.lookup(QString("animVariantTestNeverInterned"), 7), 7);
+    QVERIFY(AnimVariantNames::find("animVariantTestNeverInterned") == INVALID_ANIM_VARIANT_ID);
+
+    // an empty key always answers the default
+    QCOMPARE(map.lookup(AnimVariantKey(), true), true);
+    QCOMPARE(map.lookup(QString(), 3), 3);
+
+    map.setTrigger(AnimVariantKey("animVariantTestTrigger"));
+    QVERIFY(map.lookup("animVariantTestTrigger", false));
+
+    QCOMPARE(AnimVariantNames::getName(floatKey.getID()), QString("animVariantTestFloat"));
+    QCOMPARE(AnimVariantKey("animVariantTestFloat").getID(), floatKey.getID());
+}
+
+void AnimVariantTests::testUnsetAndCopy() {
+    AnimVariantMap source;
+    source.set("animVariantTestA", 1);
+    source.set("animVariantTestB", true);
+    source.unset("animVariantTestB");
+    QVERIFY(source.hasKey("animVariantTestA"));
+    QVERIFY(!source.hasKey("animVariantTestB"));
+
+    AnimVariantMap dest;
+    dest.set("animVariantTestC", 3.0f);
+    dest.copyVariantsFrom(source);
+    QCOMPARE(dest.lookup("animVariantTestA", 0), 1);
+    QCOMPARE(dest.lookup("animVariantTestC", 0.0f), 3.0f);
+    QVERIFY(!dest.hasKey("animVariantTestB"));
+
+    std::map<QString, QString> debugMap = dest.toDebugMap();
+    QCOMPARE((int)debugMap.size(), 2);
+    QCOMPARE(debugMap["animVariantTestA"], QString("1"));
+
+    dest.clearMap();
+    QVERIFY(!dest.hasKey("animVariantTestA"));
+}
+
+// Rig unsets a handful of vars and sets them again every frame, which must not move any of the values.
+void AnimVariantTests::testUnsetThenSetKeepsSlots() {
+    AnimVariantMap map;
+    AnimVariantKey firstKey("animVariantTestSlotFirst");
+    AnimVariantKey secondKey("animVariantTestSlotSecond");
+    map.set(firstKey, glm::vec3(1.0f, 0.0f, 0.0f));
+    map.set(secondKey, QString("left"));
+    const AnimVariant* first = &map.get(firstKey);
+    const AnimVariant* second = &map.get(secondKey);
+
+    for (int i = 0; i < 10; i++) {
+        map.unset(firstKey);
+        QVERIFY(!map.hasKey(firstKey));
+        QVERIFY(&map.get(secondKey) == second);
+
+        map.set(firstKey, glm::vec3((float)i, 0.0f, 0.0f));
+        QVERIFY(&map.get(firstKey) == first);
+        QVERIFY(&map.get(secondKey) == second);
+    }
+    QCOMPARE(map.lookup(secondKey, QString()), QString("left"));
+}
+
+// Names only scripts set don't get an ID, until a graph loaded later holds a key for them.
+void AnimVariantTests::testUninternedNames() {
+    AnimVariantMap map;
+    map.set("animVariantTestScriptOnly", 4);
+    QVERIFY(AnimVariantNames::find("animVariantTestScriptOnly") == INVALID_ANIM_VARIANT_ID);
+    QCOMPARE(map.lookup("animVariantTestScriptOnly", 0), 4);
+
+    AnimVariantKey key("animVariantTestScriptOnly");
+    QCOMPARE(map.lookup(key, 0), 4);
+    map.set("animVariantTestScriptOnly", 5);
+    QCOMPARE(map.lookup(key, 0), 5);
+
+    AnimVariantMap copy;
+    copy.copyVariantsFrom(map);
+    QCOMPARE(copy.lookup(key, 0), 5);
+
+    map.unset(key);
+    QVERIFY(!map.hasKey("animVariantTestScriptOnly"));
+    QCOMPARE((int)map.toDebugMap().size(), 0);
+}
+
+// Rigs load their graphs and evaluate on several threads at once, so names get interned while other threads look
+// them up; every thread must agree on the IDs.
+void AnimVariantTests::testConcurrentIntern() {
+    const int NUM_NAMES = 500;
+    std::vector<std::vector<AnimVariantID>> ids(NUM_TEST_THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_TEST_THREADS; ++t) {
+        threads.emplace_back([t, &ids] {
+            // start each thread at a different name, so they race to intern the same ones
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                QString name = QString("animVariantConcurrentVar%1").arg((i + t * 37) % NUM_NAMES);
+                AnimVariantID id = AnimVariantNames::intern(name);
+                if (AnimVariantNames::find(name) != id || AnimVariantNames::getName(id) != name) {
+                    id = INVALID_ANIM_VARIANT_ID;
+                }
+                ids[t].push_back(id);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < NUM_TEST_THREADS; ++t) {
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            QString name = QString("animVariantConcurrentVar%1").arg((i + t * 37) % NUM_NAMES);
+            QVERIFY(ids[t][i] != INVALID_ANIM_VARIANT_ID);
+            QCOMPARE(ids[t][i], AnimVariantNames::find(name));
+        }
+    }
+}
+
+void AnimVariantTests::benchmarkLookup_data() {
+    QTest::addColumn<bool>("useKeys");
+    QTest::newRow("byName") << false;
+    QTest::newRow("byKey") << true;
+}
+
+// Every node in the anim graph reads a handful of variables each frame; compare doing that by name with using
+// keys resolved when the graph was loaded.
+void AnimVariantTests::benchmarkLookup() {
+    QFETCH(bool, useKeys);
+
+    AnimVariantMap map;
+    std::vector<QString> names;
+    std::vector<AnimVariantKey> keys;
+    for (int i = 0; i < NUM_BENCHMARK_VARS; i++) {
+        QString name = QString("animVariantBenchmarkVar%1").arg(i);
+        map.set(name, (float)i);
+        names.push_back(name);
+        keys.push_back(AnimVariantKey(name));
+    }
+
+    float sum = 0.0f;
+    if (useKeys) {
+        QBENCHMARK {
+            for (auto& key : keys) {
+                sum += map.lookup(key, 0.0f);
+            }
+        }
+    } else {
+        QBENCHMARK {
+            for (auto& name : names) {
+                sum += map.lookup(name, 0.0f);
+            }
+        }
+    }
+    QVERIFY(sum > 0.0f);
+}
+
+void AnimVariantTests::benchmarkConcurrentLookup_data() {
+    QTest::addColumn<int>("numThreads");
+    QTest::addColumn<bool>("useKeys");
+    for (int numThreads : { 1, 4, NUM_TEST_THREADS }) {
+        QTest::newRow(qPrintable(QString("%1 threads, byName").arg(numThreads))) << numThreads << false;
+        QTest::newRow(qPrintable(QString("%1 threads, byKey").arg(numThreads))) << numThreads << true;
+    }
+}
+
+// Like benchmarkLookup, but with each thread reading its own map the way Rig::updateAnimationsBatch evaluates
+// many rigs at once, so that any contention on the shared name table shows up as time that doesn't scale.
+void AnimVariantTests::benchmarkConcurrentLookup() {
+    QFETCH(int, numThreads);
+    QFETCH(bool, useKeys);
+    const int NUM_ITERATIONS = 100;
+
+    std::vector<QString> names;
+    std::vector<AnimVariantKey> keys;
+    for (int i = 0; i < NUM_BENCHMARK_VARS; i++) {
+        QString name = QString("animVariantBenchmarkVar%1").arg(i);
+        names.push_back(name);
+        keys.push_back(AnimVariantKey(name));
+    }
+    std::vector<AnimVariantMap> maps(numThreads);
+    for (auto& map : maps) {
+        for (auto& key : keys) {
+            map.set(key, 1.0f);
+        }
+    }
+
+    std::vector<float> sums(numThreads, 0.0f);
+    QBENCHMARK {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&, t] {
+                const AnimVariantMap& map = maps[t];
+                float sum = 0.0f;
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    if (useKeys) {
+                        for (auto& key : keys) {
+                            sum += map.lookup(key, 0.0f);
+                        }
+                    } else {
+                        for (auto& name : names) {
+                            sum += map.lookup(name, 0.0f);
+                        }
+                    }
+                }
+                sums[t] += sum;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    for (float sum : sums) {
+        QVERIFY(sum > 0.0f);
+    }
+}
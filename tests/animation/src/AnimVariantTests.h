@@ -0,0 +1,29 @@
+//
+//  AnimVariantTests.h
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimVariantTests_h
+#define hifi_AnimVariantTests_h
+
+#include <QtTest/QtTest>
+
+class AnimVariantTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testKeyMatchesName();
+    void testUnsetAndCopy();
+    void testUnsetThenSetKeepsSlots();
+    void testUninternedNames();
+    void testConcurrentIntern();
+    void benchmarkLookup_data();
+    void benchmarkLookup();
+    void benchmarkConcurrentLookup_data();
+    void benchmarkConcurrentLookup();
+};
+
+#endif // hifi_AnimVariantTests_h
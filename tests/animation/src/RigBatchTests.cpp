@@ -0,0 +1,210 @@
+//
+//  RigBatchTests.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RigBatchTests.h"
+
+#include <glm/gtx/transform.hpp>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AnimationCache.h>
+#include <GLMHelpers.h>
+#include <NodeList.h>
+#include <NumericalConstants.h>
+#include <ResourceManager.h>
+#include <ResourceRequestObserver.h>
+#include <Rig.h>
+#include <StatTracker.h>
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(RigBatchTests)
+
+const QUrl AVATAR_GRAPH_URL { "qrc:///data/avatar.json" };
+const float FRAME_DELTA_TIME = 1.0f / 90.0f;
+const float POSE_EPSILON = 0.0001f;
+
+struct TestJoint {
+    const char* name;
+    int parentIndex;
+    glm::vec3 translation;
+};
+
+// a small humanoid skeleton with the joints avatar.json drives
+const TestJoint TEST_SKELETON[] = {
+    { "Hips", -1, { 0.0f, 1.0f, 0.0f } },
+    { "Spine", 0, { 0.0f, 0.1f, 0.0f } },
+    { "Spine1", 1, { 0.0f, 0.1f, 0.0f } },
+    { "Spine2", 2, { 0.0f, 0.1f, 0.0f } },
+    { "Neck", 3, { 0.0f, 0.15f, 0.0f } },
+    { "Head", 4, { 0.0f, 0.1f, 0.0f } },
+    { "LeftEye", 5, { 0.03f, 0.08f, 0.08f } },
+    { "RightEye", 5, { -0.03f, 0.08f, 0.08f } },
+    { "LeftShoulder", 3, { 0.05f, 0.1f, 0.0f } },
+    { "LeftArm", 8, { 0.1f, 0.0f, 0.0f } },
+    { "LeftForeArm", 9, { 0.25f, 0.0f, 0.0f } },
+    { "LeftHand", 10, { 0.25f, 0.0f, 0.0f } },
+    { "RightShoulder", 3, { -0.05f, 0.1f, 0.0f } },
+    { "RightArm", 12, { -0.1f, 0.0f, 0.0f } },
+    { "RightForeArm", 13, { -0.25f, 0.0f, 0.0f } },
+    { "RightHand", 14, { -0.25f, 0.0f, 0.0f } },
+    { "LeftUpLeg", 0, { 0.1f, -0.05f, 0.0f } },
+    { "LeftLeg", 16, { 0.0f, -0.45f, 0.0f } },
+    { "LeftFoot", 17, { 0.0f, -0.45f, 0.0f } },
+    { "LeftToeBase", 18, { 0.0f, -0.05f, 0.1f } },
+    { "RightUpLeg", 0, { -0.1f, -0.05f, 0.0f } },
+    { "RightLeg", 20, { 0.0f, -0.45f, 0.0f } },
+    { "RightFoot", 21, { 0.0f, -0.45f, 0.0f } },
+    { "RightToeBase", 22, { 0.0f, -0.05f, 0.1f } }
+};
+
+static void makeTestSkeleton(HFMModel& hfmModel) {
+    HFMJoint joint;
+    joint.isFree = false;
+    joint.distanceToParent = 1.0f;
+    joint.preTransform = glm::mat4();
+    joint.preRotation = glm::quat();
+    joint.rotation = glm::quat();
+    joint.postRotation = glm::quat();
+    joint.postTransform = glm::mat4();
+    joint.rotationMin = glm::vec3(-PI);
+    joint.rotationMax = glm::vec3(PI);
+    joint.inverseDefaultRotation = glm::quat();
+    joint.inverseBindRotation = glm::quat();
+    joint.isSkeletonJoint = true;
+
+    for (const auto& testJoint : TEST_SKELETON) {
+        joint.name = testJoint.name;
+        joint.parentIndex = testJoint.parentIndex;
+        joint.translation = testJoint.translation;
+
+        // World = ParentWorld * T * (Roff * Rp) * Rpre * R * Rpost * (Rp-1 * Soff * Sp * S * Sp-1)
+        glm::mat4 parentTransform = joint.parentIndex >= 0 ? hfmModel.joints[joint.parentIndex].transform : glm::mat4();
+        joint.transform = parentTransform * glm::translate(joint.translation);
+        joint.bindTransform = joint.transform;
+
+        hfmModel.jointIndices[joint.name] = (int)hfmModel.joints.size() + 1;
+        hfmModel.joints.push_back(joint);
+    }
+}
+
+void RigBatchTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<AnimationCache>();
+    DependencyManager::set<ResourceRequestObserver>();
+    DependencyManager::set<ResourceCacheSharedItems>();
+    DependencyManager::set<StatTracker>();
+}
+
+void RigBatchTests::cleanupTestCase() {
+    DependencyManager::get<ResourceManager>()->cleanup();
+}
+
+std::vector<std::unique_ptr<Rig>> RigBatchTests::createRigs(int numRigs) {
+    HFMModel hfmModel;
+    makeTestSkeleton(hfmModel);
+
+    std::vector<std::unique_ptr<Rig>> rigs;
+    for (int i = 0; i < numRigs; ++i) {
+        std::unique_ptr<Rig> rig { new Rig() };
+        rig->initJointStates(hfmModel, glm::mat4());
+
+        QSignalSpy loadSpy(rig.get(), &Rig::onLoadComplete);
+        rig->initAnimGraph(AVATAR_GRAPH_URL);
+        if (loadSpy.isEmpty() && !loadSpy.wait()) {
+            qWarning() << "Timed out loading" << AVATAR_GRAPH_URL;
+            return {};
+        }
+
+        rigs.push_back(std::move(rig));
+    }
+    return rigs;
+}
+
+void RigBatchTests::simulateFrame(std::vector<std::unique_ptr<Rig>>& rigs, int frame, bool batch) {
+    std::vector<Rig::AnimationUpdate> updates;
+    updates.reserve(rigs.size());
+
+    for (size_t i = 0; i < rigs.size(); ++i) {
+        // give every rig its own walk, so the state machines don't all take the same path
+        float phase = (float)frame * FRAME_DELTA_TIME + (float)i;
+        glm::vec3 position((float)i, 0.0f, 0.0f);
+        glm::vec3 velocity(sinf(phase), 0.0f, 1.5f * cosf(phase));
+        glm::quat rotation = glm::angleAxis(0.1f * phase, Vectors::UNIT_Y);
+        rigs[i]->computeMotionAnimationState(FRAME_DELTA_TIME, position, velocity, rotation,
+                                             Rig::CharacterControllerState::Ground, 1.0f);
+
+        glm::mat4 rigToWorld = glm::translate(position) * glm::mat4_cast(rotation);
+        if (batch) {
+            updates.push_back({ rigs[i].get(), FRAME_DELTA_TIME, glm::mat4(), rigToWorld });
+        } else {
+            rigs[i]->updateAnimations(FRAME_DELTA_TIME, glm::mat4(), rigToWorld);
+        }
+    }
+
+    if (batch) {
+        Rig::updateAnimationsBatch(updates);
+    }
+}
+
+void RigBatchTests::testBatchMatchesSerial() {
+    const int NUM_RIGS = 8;
+    const int NUM_FRAMES = 30;
+
+    auto serialRigs = createRigs(NUM_RIGS);
+    auto batchRigs = createRigs(NUM_RIGS);
+    QCOMPARE((int)serialRigs.size(), NUM_RIGS);
+    QCOMPARE((int)batchRigs.size(), NUM_RIGS);
+
+    for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+        simulateFrame(serialRigs, frame, false);
+        simulateFrame(batchRigs, frame, true);
+    }
+
+    // rigs don't share state while they evaluate, so the batch must land on exactly the serial poses
+    for (int i = 0; i < NUM_RIGS; ++i) {
+        int numJoints = serialRigs[i]->getJointStateCount();
+        QCOMPARE(batchRigs[i]->getJointStateCount(), numJoints);
+        for (int j = 0; j < numJoints; ++j) {
+            AnimPose serialPose, batchPose;
+            QVERIFY(serialRigs[i]->getAbsoluteJointPoseInRigFrame(j, serialPose));
+            QVERIFY(batchRigs[i]->getAbsoluteJointPoseInRigFrame(j, batchPose));
+            QCOMPARE_WITH_ABS_ERROR(batchPose.trans(), serialPose.trans(), POSE_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(batchPose.rot(), serialPose.rot(), POSE_EPSILON);
+        }
+    }
+}
+
+void RigBatchTests::benchmarkUpdateAnimations_data() {
+    QTest::addColumn<int>("numRigs");
+    QTest::addColumn<bool>("batch");
+
+    QTest::newRow("50 rigs, serial") << 50 << false;
+    QTest::newRow("50 rigs, batch") << 50 << true;
+    QTest::newRow("200 rigs, serial") << 200 << false;
+    QTest::newRow("200 rigs, batch") << 200 << true;
+}
+
+void RigBatchTests::benchmarkUpdateAnimations() {
+    QFETCH(int, numRigs);
+    QFETCH(bool, batch);
+
+    auto rigs = createRigs(numRigs);
+    QCOMPARE((int)rigs.size(), numRigs);
+
+    // one iteration is one frame of animation for every rig
+    int frame = 0;
+    QBENCHMARK {
+        simulateFrame(rigs, frame++, batch);
+    }
+}
@@ -0,0 +1,34 @@
+//
+//  RigBatchTests.h
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RigBatchTests_h
+#define hifi_RigBatchTests_h
+
+#include <memory>
+#include <vector>
+
+#include <QtTest/QtTest>
+
+class Rig;
+
+class RigBatchTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testBatchMatchesSerial();
+    void benchmarkUpdateAnimations_data();
+    void benchmarkUpdateAnimations();
+
+private:
+    std::vector<std::unique_ptr<Rig>> createRigs(int numRigs);
+    void simulateFrame(std::vector<std::unique_ptr<Rig>>& rigs, int frame, bool batch);
+};
+
+#endif // hifi_RigBatchTests_h
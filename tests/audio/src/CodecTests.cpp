@@ -0,0 +1,159 @@
+//
+//  CodecTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CodecTests.h"
+
+#include <cmath>
+
+#include <AudioConstants.h>
+#include <plugins/CodecPlugin.h>
+
+#include <HiFiCodec.h>
+#include <PCMCodecManager.h>
+
+QTEST_MAIN(CodecTests)
+
+namespace {
+    const int FRAME_BYTES = AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL;
+
+    // a decoder whose output depends on how many frames it decoded before, like any codec with prediction
+    class CountingDecoder : public Decoder {
+    public:
+        CountingDecoder(int frameSize) : _frameSize(frameSize) {}
+
+        void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) override {
+            decodedBuffer = QByteArray(_frameSize, (char)_numDecoded++);
+        }
+        void lostFrame(QByteArray& decodedBuffer) override { decodedBuffer.fill(0); }
+
+        int getNumDecoded() const { return _numDecoded; }
+
+    private:
+        int _frameSize;
+        int _numDecoded { 0 };
+    };
+
+    class FixedSizeEncoder : public Encoder {
+    public:
+        FixedSizeEncoder(int encodedSize) : _encodedSize(encodedSize) {}
+
+        void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) override {
+            encodedBuffer = QByteArray(_encodedSize, 'e');
+        }
+
+    private:
+        int _encodedSize;
+    };
+
+    QByteArray makeToneFrame(int frame) {
+        QByteArray decoded(FRAME_BYTES, 0);
+        int16_t* samples = (int16_t*)decoded.data();
+        for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+            int sample = frame * AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL + i;
+            samples[i] = (int16_t)(8000.0f * sinf(sample * 0.05f));
+        }
+        return decoded;
+    }
+}
+
+// The default decodeInto adapts decode, which a stateful codec must only see once per frame, even when the frame
+// doesn't fit the buffer it was handed.
+void CodecTests::testDecodeIntoGrowsBuffer() {
+    const int DECODED_SIZE = 64;
+    CountingDecoder decoder(DECODED_SIZE);
+    QByteArray encoded(8, 'x');
+
+    QByteArray decodedBuffer(DECODED_SIZE / 4, 0);
+    QCOMPARE(decoder.decodeInto(encoded.constData(), encoded.size(), decodedBuffer), DECODED_SIZE);
+    QCOMPARE(decoder.getNumDecoded(), 1);
+    QCOMPARE(decodedBuffer, QByteArray(DECODED_SIZE, (char)0));
+
+    // once large enough, the buffer is reused as is
+    const char* data = decodedBuffer.constData();
+    QCOMPARE(decoder.decodeInto(encoded.constData(), encoded.size(), decodedBuffer), DECODED_SIZE);
+    QCOMPARE(decoder.getNumDecoded(), 2);
+    QVERIFY(decodedBuffer.constData() == data);
+    QCOMPARE(decodedBuffer, QByteArray(DECODED_SIZE, (char)1));
+
+    // and never shrunk, only the returned size counts
+    QByteArray largeBuffer(DECODED_SIZE * 2, 'y');
+    QCOMPARE(decoder.decodeInto(encoded.constData(), encoded.size(), largeBuffer), DECODED_SIZE);
+    QCOMPARE(largeBuffer.size(), DECODED_SIZE * 2);
+    QCOMPARE(largeBuffer.left(DECODED_SIZE), QByteArray(DECODED_SIZE, (char)2));
+}
+
+void CodecTests::testEncodeIntoCapacity() {
+    const int ENCODED_SIZE = 16;
+    FixedSizeEncoder encoder(ENCODED_SIZE);
+    QByteArray decoded(FRAME_BYTES, 0);
+    char encoded[ENCODED_SIZE];
+
+    QCOMPARE(encoder.encodeInto(decoded.constData(), decoded.size(), encoded, ENCODED_SIZE - 1), -1);
+    QCOMPARE(encoder.encodeInto(decoded.constData(), decoded.size(), encoded, ENCODED_SIZE), ENCODED_SIZE);
+    QCOMPARE(QByteArray(encoded, ENCODED_SIZE), QByteArray(ENCODED_SIZE, 'e'));
+}
+
+void CodecTests::testPCMCodec() {
+    PCMCodec codec;
+    Encoder* encoder = codec.createEncoder(AudioConstants::SAMPLE_RATE, 1);
+    Decoder* decoder = codec.createDecoder(AudioConstants::SAMPLE_RATE, 1);
+    QByteArray decoded = makeToneFrame(0);
+
+    QByteArray encoded(encoder->getMaxEncodedSize(FRAME_BYTES), 0);
+    QCOMPARE(encoder->encodeInto(decoded.constData(), FRAME_BYTES, encoded.data(), FRAME_BYTES - 1), -1);
+    QCOMPARE(encoder->encodeInto(decoded.constData(), FRAME_BYTES, encoded.data(), encoded.size()), FRAME_BYTES);
+
+    QByteArray decodedBuffer;
+    QCOMPARE(decoder->decodeInto(encoded.constData(), FRAME_BYTES, decodedBuffer), FRAME_BYTES);
+    QCOMPARE(decodedBuffer, decoded);
+
+    codec.releaseEncoder(encoder);
+    codec.releaseDecoder(decoder);
+}
+
+// The in place overrides must produce the same stream as the QByteArray interface they replace.
+void CodecTests::testHiFiCodec() {
+    const int NUM_FRAMES = 8;
+    HiFiCodec codec;
+    Encoder* encoder = codec.createEncoder(AudioConstants::SAMPLE_RATE, 1);
+    Encoder* referenceEncoder = codec.createEncoder(AudioConstants::SAMPLE_RATE, 1);
+    Decoder* decoder = codec.createDecoder(AudioConstants::SAMPLE_RATE, 1);
+    Decoder* referenceDecoder = codec.createDecoder(AudioConstants::SAMPLE_RATE, 1);
+
+    int maxEncodedSize = encoder->getMaxEncodedSize(FRAME_BYTES);
+    QByteArray encoded(maxEncodedSize, 0);
+    QByteArray frame = makeToneFrame(0);
+
+    // a partial frame, or too small an output, is refused rather than read or written past
+    QCOMPARE(encoder->encodeInto(frame.constData(), FRAME_BYTES / 2, encoded.data(), maxEncodedSize), -1);
+    QCOMPARE(encoder->encodeInto(frame.constData(), FRAME_BYTES, encoded.data(), maxEncodedSize - 1), -1);
+
+    QByteArray decodedBuffer;
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        frame = makeToneFrame(i);
+
+        int encodedSize = encoder->encodeInto(frame.constData(), FRAME_BYTES, encoded.data(), maxEncodedSize);
+        QCOMPARE(encodedSize, maxEncodedSize);
+        QByteArray referenceEncoded;
+        referenceEncoder->encode(frame, referenceEncoded);
+        QCOMPARE(encoded.left(encodedSize), referenceEncoded);
+
+        int decodedSize = decoder->decodeInto(encoded.constData(), encodedSize, decodedBuffer);
+        QCOMPARE(decodedSize, FRAME_BYTES);
+        QByteArray referenceDecoded;
+        referenceDecoder->decode(referenceEncoded, referenceDecoded);
+        QCOMPARE(decodedBuffer.left(decodedSize), referenceDecoded);
+    }
+
+    codec.releaseEncoder(encoder);
+    codec.releaseEncoder(referenceEncoder);
+    codec.releaseDecoder(decoder);
+    codec.releaseDecoder(referenceDecoder);
+}
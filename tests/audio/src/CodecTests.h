@@ -0,0 +1,25 @@
+//
+//  CodecTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CodecTests_h
+#define hifi_CodecTests_h
+
+#include <QtTest/QtTest>
+
+class CodecTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testDecodeIntoGrowsBuffer();
+    void testEncodeIntoCapacity();
+    void testPCMCodec();
+    void testHiFiCodec();
+};
+
+#endif // hifi_CodecTests_h
@@ -0,0 +1,156 @@
+//
+//  BakeCacheTests.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCacheTests.h"
+
+#include <QtCore/QTemporaryDir>
+
+#include <baking/BakeCache.h>
+
+QTEST_MAIN(BakeCacheTests)
+
+static void writeFile(const QString& path, const QByteArray& content) {
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QFile file { path };
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(content), (qint64)content.size());
+}
+
+static QByteArray readFile(const QString& path) {
+    QFile file { path };
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+void BakeCacheTests::testKeyCoversEveryInput() {
+    auto key = BakeCache::makeKey("texture", 1, "options", "source");
+    QCOMPARE(BakeCache::makeKey("texture", 1, "options", "source"), key);
+    QVERIFY(BakeCache::makeKey("model", 1, "options", "source") != key);
+    QVERIFY(BakeCache::makeKey("texture", 2, "options", "source") != key);
+    QVERIFY(BakeCache::makeKey("texture", 1, "other options", "source") != key);
+    QVERIFY(BakeCache::makeKey("texture", 1, "options", "other source") != key);
+
+    // parts can't run together
+    QVERIFY(BakeCache::makeKey("texture", 1, "optionss", "ource") != key);
+}
+
+void BakeCacheTests::testRestoreUnderAnotherBaseName() {
+    QTemporaryDir cacheDir, bakedDir, restoredDir;
+    BakeCache cache { cacheDir.path() };
+    QDir bakedOutput { bakedDir.path() };
+    QDir restoredOutput { restoredDir.path() };
+
+    writeFile(bakedOutput.absoluteFilePath("albedo_COMPRESSED_RGBA.ktx"), "compressed");
+    writeFile(bakedOutput.absoluteFilePath("albedo.ktx"), "uncompressed");
+    writeFile(bakedOutput.absoluteFilePath("shared/readme.txt"), "readme");
+
+    BakeCache::Artifact artifact;
+    artifact.files << "albedo_COMPRESSED_RGBA.ktx" << "albedo.ktx" << "shared/readme.txt";
+    artifact.metadata["uncompressed"] = ".ktx";
+    auto key = BakeCache::makeKey("texture", 1, QByteArray(), "pixels");
+    QVERIFY(cache.store(key, bakedOutput, "albedo", artifact));
+    QCOMPARE(cache.getNumStored(), 1);
+
+    BakeCache::Artifact restored;
+    QVERIFY(cache.restore(key, restoredOutput, "wall", restored));
+    QCOMPARE(cache.getNumRestored(), 1);
+    QCOMPARE(restored.files, QStringList() << "wall_COMPRESSED_RGBA.ktx" << "wall.ktx" << "shared/readme.txt");
+    QCOMPARE(restored.metadata["uncompressed"].toString(), QString(".ktx"));
+    QCOMPARE(readFile(restoredOutput.absoluteFilePath("wall_COMPRESSED_RGBA.ktx")), QByteArray("compressed"));
+    QCOMPARE(readFile(restoredOutput.absoluteFilePath("wall.ktx")), QByteArray("uncompressed"));
+    QCOMPARE(readFile(restoredOutput.absoluteFilePath("shared/readme.txt")), QByteArray("readme"));
+
+    // a cache opened later on the same folder has the entry too
+    BakeCache reopenedCache { cacheDir.path() };
+    QVERIFY(reopenedCache.restore(key, restoredOutput, "floor", restored));
+    QCOMPARE(readFile(restoredOutput.absoluteFilePath("floor.ktx")), QByteArray("uncompressed"));
+}
+
+void BakeCacheTests::testMissingEntryIsNotRestored() {
+    QTemporaryDir cacheDir, outputDir;
+    BakeCache cache { cacheDir.path() };
+
+    BakeCache::Artifact artifact;
+    QVERIFY(!cache.restore(BakeCache::makeKey("js", 1, QByteArray(), "print();"), QDir(outputDir.path()), "script", artifact));
+    QCOMPARE(cache.getNumRestored(), 0);
+}
+
+void BakeCacheTests::testChangedDependencyIsRebaked() {
+    QTemporaryDir cacheDir, sourceDir, outputDir;
+    BakeCache cache { cacheDir.path() };
+    QDir output { outputDir.path() };
+
+    auto texturePath = QDir(sourceDir.path()).absoluteFilePath("texture.png");
+    writeFile(texturePath, "first texture");
+    writeFile(output.absoluteFilePath("material.baked.json"), "first material");
+
+    BakeCache::Artifact artifact;
+    artifact.files << "material.baked.json";
+    artifact.dependencies << texturePath;
+    auto key = BakeCache::makeKey("material", 1, QByteArray(), "material");
+    QVERIFY(cache.store(key, output, QString(), artifact));
+
+    BakeCache::Artifact restored;
+    QVERIFY(cache.restore(key, output, QString(), restored));
+    QCOMPARE(restored.dependencies, QStringList() << texturePath);
+
+    writeFile(texturePath, "second texture");
+    QVERIFY(!cache.restore(key, output, QString(), restored));
+
+    // baking again replaces the out of date entry
+    writeFile(output.absoluteFilePath("material.baked.json"), "second material");
+    QVERIFY(cache.store(key, output, QString(), artifact));
+    writeFile(output.absoluteFilePath("material.baked.json"), QByteArray());
+    QVERIFY(cache.restore(key, output, QString(), restored));
+    QCOMPARE(readFile(output.absoluteFilePath("material.baked.json")), QByteArray("second material"));
+
+    QFile::remove(texturePath);
+    QVERIFY(!cache.restore(key, output, QString(), restored));
+}
+
+void BakeCacheTests::testTrimRemovesLeastRecentlyUsed() {
+    QTemporaryDir cacheDir, outputDir;
+    BakeCache cache { cacheDir.path() };
+    QDir output { outputDir.path() };
+
+    const int ENTRY_SIZE = 1000;
+    writeFile(output.absoluteFilePath("baked"), QByteArray(ENTRY_SIZE, 'x'));
+    BakeCache::Artifact artifact;
+    artifact.files << "baked";
+
+    auto oldKey = BakeCache::makeKey("js", 1, QByteArray(), "old");
+    auto newKey = BakeCache::makeKey("js", 1, QByteArray(), "new");
+    QVERIFY(cache.store(oldKey, output, QString(), artifact));
+    QVERIFY(cache.store(newKey, output, QString(), artifact));
+
+    {
+        QFile manifest { QDir(cacheDir.path()).absoluteFilePath(oldKey + "/" + BakeCache::MANIFEST_FILENAME) };
+        QVERIFY(manifest.open(QIODevice::ReadOnly));
+        QVERIFY(manifest.setFileTime(QDateTime::currentDateTimeUtc().addDays(-1), QFileDevice::FileModificationTime));
+    }
+
+    cache.trim(2 * ENTRY_SIZE);
+    BakeCache::Artifact restored;
+    QVERIFY(cache.restore(oldKey, output, QString(), restored));
+    QVERIFY(cache.restore(newKey, output, QString(), restored));
+
+    // trimming further drops whichever entry was used least recently
+    {
+        QFile manifest { QDir(cacheDir.path()).absoluteFilePath(newKey + "/" + BakeCache::MANIFEST_FILENAME) };
+        QVERIFY(manifest.open(QIODevice::ReadOnly));
+        QVERIFY(manifest.setFileTime(QDateTime::currentDateTimeUtc().addDays(-1), QFileDevice::FileModificationTime));
+    }
+
+    cache.trim(ENTRY_SIZE);
+    QVERIFY(cache.restore(oldKey, output, QString(), restored));
+    QVERIFY(!cache.restore(newKey, output, QString(), restored));
+}
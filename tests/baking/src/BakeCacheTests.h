@@ -0,0 +1,27 @@
+//
+//  BakeCacheTests.h
+//  tests/baking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeCacheTests_h
+#define hifi_BakeCacheTests_h
+
+#include <QtTest/QtTest>
+
+class BakeCacheTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testKeyCoversEveryInput();
+    void testRestoreUnderAnotherBaseName();
+    void testMissingEntryIsNotRestored();
+    void testChangedDependencyIsRebaked();
+    void testTrimRemovesLeastRecentlyUsed();
+};
+
+#endif // hifi_BakeCacheTests_h
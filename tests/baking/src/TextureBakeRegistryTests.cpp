@@ -0,0 +1,120 @@
+//
+//  TextureBakeRegistryTests.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureBakeRegistryTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <baking/TextureBakeRegistry.h>
+
+QTEST_MAIN(TextureBakeRegistryTests)
+
+static TextureBakeRegistry::BakedTexture createBakedTexture(bool succeeded) {
+    TextureBakeRegistry::BakedTexture bakedTexture;
+    bakedTexture.succeeded = succeeded;
+    bakedTexture.outputDirectory = QDir("/baked/model");
+    bakedTexture.baseFilename = "albedo";
+    bakedTexture.meta.original = QUrl("albedo.png");
+    bakedTexture.meta.uncompressed = QUrl("albedo.ktx");
+    return bakedTexture;
+}
+
+void TextureBakeRegistryTests::testIdenticalContentIsBakedOnce() {
+    TextureBakeRegistry registry;
+    int first = 0, second = 0, third = 0;
+    std::vector<TextureBakeRegistry::BakedTexture> received;
+    auto handler = [&](const TextureBakeRegistry::BakedTexture& bakedTexture) {
+        received.push_back(bakedTexture);
+    };
+
+    QVERIFY(registry.claim("hash", &first, handler));
+    QVERIFY(!registry.claim("hash", &second, handler));
+    QVERIFY(received.empty());
+
+    // other content is baked on its own
+    QVERIFY(registry.claim("other hash", &first, handler));
+
+    registry.finish("hash", createBakedTexture(true));
+    QCOMPARE(received.size(), (size_t)1);
+    QVERIFY(received[0].succeeded);
+    QCOMPARE(received[0].baseFilename, QString("albedo"));
+    QCOMPARE(received[0].meta.uncompressed, QUrl("albedo.ktx"));
+
+    // late claimants get the finished bake right away
+    QVERIFY(!registry.claim("hash", &third, handler));
+    QCOMPARE(received.size(), (size_t)2);
+
+    QCOMPARE(registry.getNumBakedTextures(), 1);
+    QCOMPARE(registry.getNumSharedTextures(), 2);
+}
+
+void TextureBakeRegistryTests::testFailedBakeIsRetried() {
+    TextureBakeRegistry registry;
+    int first = 0, second = 0, third = 0;
+    int numFailures = 0;
+    auto handler = [&](const TextureBakeRegistry::BakedTexture& bakedTexture) {
+        numFailures += bakedTexture.succeeded ? 0 : 1;
+    };
+
+    QVERIFY(registry.claim("hash", &first, handler));
+    QVERIFY(!registry.claim("hash", &second, handler));
+    registry.finish("hash", createBakedTexture(false));
+    QCOMPARE(numFailures, 1);
+
+    QVERIFY(registry.claim("hash", &third, handler));
+    QCOMPARE(registry.getNumBakedTextures(), 0);
+    QCOMPARE(registry.getNumSharedTextures(), 0);
+}
+
+void TextureBakeRegistryTests::testReleasedClaimantIsNotCalled() {
+    TextureBakeRegistry registry;
+    int first = 0, second = 0, third = 0;
+    std::vector<const void*> called;
+
+    QVERIFY(registry.claim("hash", &first, [&](const TextureBakeRegistry::BakedTexture&) { called.push_back(&first); }));
+    QVERIFY(!registry.claim("hash", &second, [&](const TextureBakeRegistry::BakedTexture&) { called.push_back(&second); }));
+    QVERIFY(!registry.claim("hash", &third, [&](const TextureBakeRegistry::BakedTexture&) { called.push_back(&third); }));
+
+    registry.release("hash", &second);
+    registry.finish("hash", createBakedTexture(true));
+    QCOMPARE(called.size(), (size_t)1);
+    QVERIFY(called[0] == &third);
+}
+
+void TextureBakeRegistryTests::testConcurrentClaims() {
+    TextureBakeRegistry registry;
+    const int NUM_THREADS = 8;
+    const int NUM_HASHES = 100;
+    std::atomic<int> numOwners { 0 };
+    std::atomic<int> numShared { 0 };
+
+    // every thread claims every hash; whoever gets one first finishes it straight away
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < NUM_HASHES; i++) {
+                std::string hash = std::to_string((i + t) % NUM_HASHES);
+                if (registry.claim(hash, &threads, [&](const TextureBakeRegistry::BakedTexture&) { ++numShared; })) {
+                    ++numOwners;
+                    registry.finish(hash, createBakedTexture(true));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    QCOMPARE(numOwners.load(), NUM_HASHES);
+    QCOMPARE(numShared.load(), (NUM_THREADS - 1) * NUM_HASHES);
+    QCOMPARE(registry.getNumBakedTextures(), NUM_HASHES);
+    QCOMPARE(registry.getNumSharedTextures(), (NUM_THREADS - 1) * NUM_HASHES);
+}
@@ -0,0 +1,26 @@
+//
+//  TextureBakeRegistryTests.h
+//  tests/baking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TextureBakeRegistryTests_h
+#define hifi_TextureBakeRegistryTests_h
+
+#include <QtTest/QtTest>
+
+class TextureBakeRegistryTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testIdenticalContentIsBakedOnce();
+    void testFailedBakeIsRetried();
+    void testReleasedClaimantIsNotCalled();
+    void testConcurrentClaims();
+};
+
+#endif // hifi_TextureBakeRegistryTests_h
@@ -0,0 +1,207 @@
+//
+//  FBXParserTests.cpp
+//  tests/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FBXParserTests.h"
+
+#include <SharedUtil.h>
+
+#include <FBXSerializer.h>
+#include <FBXWriter.h>
+
+QTEST_GUILESS_MAIN(FBXParserTests)
+
+static const int LARGE_ARRAY_LENGTH = 100000;
+
+static QString getSamplesPath() {
+    return QDir::cleanPath(QFileInfo(__FILE__).absolutePath() + "/../../../unpublishedScripts/marketplace/shortbow");
+}
+
+// A mesh-like document: FBXWriter compresses the large arrays and stores the small ones as they are.
+static FBXNode createDocument(int arrayLength) {
+    QVector<double> vertices;
+    QVector<qint32> indices;
+    QVector<float> weights;
+    QVector<qint64> ids;
+    QVector<bool> flags;
+    for (int i = 0; i < arrayLength; i++) {
+        vertices.append(i * 0.25);
+        indices.append((i % 3 == 2) ? -(i + 1) : i);
+        weights.append(1.0f / (float)(i + 1));
+        ids.append((qint64)i << 33);
+        flags.append(i % 5 == 0);
+    }
+
+    FBXNode geometry;
+    geometry.name = "Geometry";
+    geometry.properties << QVariant::fromValue((qint64)1234567890123LL) << QVariant::fromValue(QByteArray("Geometry::Mesh"))
+        << QVariant::fromValue(QByteArray("Mesh"));
+
+    FBXNode verticesNode;
+    verticesNode.name = "Vertices";
+    verticesNode.properties << QVariant::fromValue(vertices);
+    FBXNode indicesNode;
+    indicesNode.name = "PolygonVertexIndex";
+    indicesNode.properties << QVariant::fromValue(indices);
+    FBXNode weightsNode;
+    weightsNode.name = "Weights";
+    weightsNode.properties << QVariant::fromValue(weights);
+    FBXNode idsNode;
+    idsNode.name = "Ids";
+    idsNode.properties << QVariant::fromValue(ids);
+    FBXNode flagsNode;
+    flagsNode.name = "Flags";
+    flagsNode.properties << QVariant::fromValue(flags);
+    FBXNode scalarsNode;
+    scalarsNode.name = "Scalars";
+    scalarsNode.properties << QVariant::fromValue((int16_t)-7) << QVariant::fromValue(true) << QVariant::fromValue(42)
+        << QVariant::fromValue(1.5f) << QVariant::fromValue(2.25) << QVariant::fromValue((qint64)-3);
+    geometry.children << verticesNode << indicesNode << weightsNode << idsNode << flagsNode << scalarsNode;
+
+    FBXNode objects;
+    objects.name = "Objects";
+    objects.children << geometry;
+    FBXNode root;
+    root.children << objects;
+    return root;
+}
+
+// QVariant has no comparator for the array types, so compare their contents directly
+template <typename T>
+static bool compareArrays(const QVariant& actual, const QVariant& expected, bool& equal) {
+    if (expected.userType() != qMetaTypeId<QVector<T>>()) {
+        return false;
+    }
+    equal = (actual.value<QVector<T>>() == expected.value<QVector<T>>());
+    return true;
+}
+
+static bool compareProperties(const QVariant& actual, const QVariant& expected) {
+    bool equal = false;
+    if (compareArrays<double>(actual, expected, equal) || compareArrays<float>(actual, expected, equal) ||
+        compareArrays<qint64>(actual, expected, equal) || compareArrays<qint32>(actual, expected, equal) ||
+        compareArrays<bool>(actual, expected, equal)) {
+        return equal;
+    }
+    return actual == expected;
+}
+
+static void compareNodes(const FBXNode& actual, const FBXNode& expected) {
+    QCOMPARE(actual.name, expected.name);
+    QCOMPARE(actual.properties.size(), expected.properties.size());
+    for (int i = 0; i < expected.properties.size(); i++) {
+        QCOMPARE(actual.properties.at(i).userType(), expected.properties.at(i).userType());
+        QVERIFY(compareProperties(actual.properties.at(i), expected.properties.at(i)));
+    }
+    QCOMPARE(actual.children.size(), expected.children.size());
+    for (int i = 0; i < expected.children.size(); i++) {
+        compareNodes(actual.children.at(i), expected.children.at(i));
+    }
+}
+
+static size_t getArrayBytes(const FBXNode& node) {
+    size_t bytes = 0;
+    for (const auto& property : node.properties) {
+        if (property.userType() == qMetaTypeId<QVector<double>>()) {
+            bytes += property.value<QVector<double>>().size() * sizeof(double);
+        } else if (property.userType() == qMetaTypeId<QVector<float>>()) {
+            bytes += property.value<QVector<float>>().size() * sizeof(float);
+        } else if (property.userType() == qMetaTypeId<QVector<qint64>>()) {
+            bytes += property.value<QVector<qint64>>().size() * sizeof(qint64);
+        } else if (property.userType() == qMetaTypeId<QVector<qint32>>()) {
+            bytes += property.value<QVector<qint32>>().size() * sizeof(qint32);
+        }
+    }
+    for (const auto& child : node.children) {
+        bytes += getArrayBytes(child);
+    }
+    return bytes;
+}
+
+void FBXParserTests::testBinaryRoundTrip() {
+    // large arrays are written compressed, small ones uncompressed
+    for (int arrayLength : { 0, 4, LARGE_ARRAY_LENGTH }) {
+        FBXNode document = createDocument(arrayLength);
+        QByteArray data = FBXWriter::encodeFBX(document);
+
+        FBXNode parsed = FBXSerializer::parseFBX(data);
+        compareNodes(parsed, document);
+
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::ReadOnly);
+        compareNodes(FBXSerializer::parseFBX(&buffer), document);
+    }
+}
+
+void FBXParserTests::testTruncatedDataThrows() {
+    QByteArray data = FBXWriter::encodeFBX(createDocument(LARGE_ARRAY_LENGTH));
+    for (int length : { data.size() / 4, data.size() / 2, data.size() - 32 }) {
+        bool threw = false;
+        try {
+            FBXSerializer::parseFBX(data.left(length));
+        } catch (const QString&) {
+            threw = true;
+        }
+        QVERIFY(threw);
+    }
+}
+
+void FBXParserTests::testTextFallback() {
+    QByteArray data("; FBX 6.1.0 project file\n"
+                    "FBXHeaderExtension:  {\n"
+                    "    FBXHeaderVersion: 1003\n"
+                    "    Creator: \"test\"\n"
+                    "}\n");
+    FBXNode parsed = FBXSerializer::parseFBX(data);
+    QCOMPARE(parsed.children.size(), 1);
+    QCOMPARE(parsed.children.at(0).name, QByteArray("FBXHeaderExtension"));
+    QCOMPARE(parsed.children.at(0).children.size(), 2);
+    QCOMPARE(parsed.children.at(0).children.at(1).properties.at(0).toByteArray(), QByteArray("test"));
+}
+
+void FBXParserTests::benchmarkParse_data() {
+    QTest::addColumn<QString>("path");
+
+    QTest::newRow("synthetic mesh") << QString();
+    QTest::newRow("arrow") << getSamplesPath() + "/bow/models/arrow.fbx";
+    QTest::newRow("bow-deadly") << getSamplesPath() + "/bow/models/bow-deadly.fbx";
+    QTest::newRow("shortbow-button") << getSamplesPath() + "/models/shortbow-button.fbx";
+}
+
+void FBXParserTests::benchmarkParse() {
+    QFETCH(QString, path);
+
+    QByteArray data;
+    if (path.isEmpty()) {
+        data = FBXWriter::encodeFBX(createDocument(10 * LARGE_ARRAY_LENGTH));
+    } else {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            QSKIP("sample FBX file not found");
+        }
+        data = file.readAll();
+    }
+
+    MemoryInfo before;
+    bool hasMemoryInfo = getMemoryInfo(before);
+
+    FBXNode parsed;
+    QBENCHMARK {
+        parsed = FBXSerializer::parseFBX(data);
+    }
+    QVERIFY(!parsed.children.isEmpty());
+
+    MemoryInfo after;
+    if (hasMemoryInfo && getMemoryInfo(after)) {
+        qDebug() << "file bytes" << data.size() << "array bytes" << getArrayBytes(parsed)
+                 << "peak bytes added" << (after.processPeakUsedMemoryBytes - before.processPeakUsedMemoryBytes);
+    } else {
+        qDebug() << "file bytes" << data.size() << "array bytes" << getArrayBytes(parsed);
+    }
+}
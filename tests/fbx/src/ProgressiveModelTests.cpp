@@ -0,0 +1,57 @@
+//
+//  ProgressiveModelTests.cpp
+//  tests/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ProgressiveModelTests.h"
+
+#include <ProgressiveModel.h>
+
+QTEST_GUILESS_MAIN(ProgressiveModelTests)
+
+void ProgressiveModelTests::testRoundTrip() {
+    std::vector<QByteArray> chunks { QByteArray(10, 'a'), QByteArray(1000, 'b'), QByteArray(100000, 'c') };
+    auto data = ProgressiveModel::write(chunks);
+    QCOMPARE(data.size(), ProgressiveModel::HEADER_SIZE + 10 + 1000 + 100000);
+
+    // the header can be read on its own, as a client does with its first ranged request
+    std::vector<ProgressiveModel::Chunk> readChunks;
+    QVERIFY(ProgressiveModel::readHeader(data.left(ProgressiveModel::HEADER_SIZE), readChunks));
+    QCOMPARE(readChunks.size(), chunks.size());
+    for (size_t i = 0; i < chunks.size(); i++) {
+        QCOMPARE(data.mid(readChunks[i].offset, readChunks[i].size), chunks[i]);
+    }
+}
+
+void ProgressiveModelTests::testInvalidHeaders() {
+    std::vector<ProgressiveModel::Chunk> chunks;
+    QVERIFY(ProgressiveModel::write({}).isEmpty());
+    QVERIFY(ProgressiveModel::write({ QByteArray("a"), QByteArray() }).isEmpty());
+    QVERIFY(ProgressiveModel::write(std::vector<QByteArray>(ProgressiveModel::MAX_CHUNKS + 1, QByteArray("a"))).isEmpty());
+
+    auto data = ProgressiveModel::write({ QByteArray("coarse"), QByteArray("fine") });
+    QVERIFY(!ProgressiveModel::readHeader(data.left(ProgressiveModel::HEADER_SIZE - 1), chunks));
+
+    auto badMagic = data;
+    badMagic[0] = 'X';
+    QVERIFY(!ProgressiveModel::readHeader(badMagic, chunks));
+
+    // a chunk which doesn't start where the previous one ends
+    auto badOffset = data;
+    badOffset[16 + 16] = badOffset[16 + 16] + 1;
+    QVERIFY(!ProgressiveModel::readHeader(badOffset, chunks));
+
+    QVERIFY(chunks.empty());
+}
+
+void ProgressiveModelTests::testChunkURL() {
+    QUrl url("http://example.com/models/tree.baked.pfbx");
+    QVERIFY(ProgressiveModel::isProgressiveModelURL(url));
+    QVERIFY(!ProgressiveModel::isProgressiveModelURL(QUrl("http://example.com/models/tree.baked.fbx")));
+    QCOMPARE(ProgressiveModel::getChunkURL(url), QUrl("http://example.com/models/tree.baked.fbx"));
+}
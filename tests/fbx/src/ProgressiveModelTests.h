@@ -0,0 +1,25 @@
+//
+//  ProgressiveModelTests.h
+//  tests/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ProgressiveModelTests_h
+#define hifi_ProgressiveModelTests_h
+
+#include <QtTest/QtTest>
+
+class ProgressiveModelTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testRoundTrip();
+    void testInvalidHeaders();
+    void testChunkURL();
+};
+
+#endif // hifi_ProgressiveModelTests_h
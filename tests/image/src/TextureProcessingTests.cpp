@@ -0,0 +1,113 @@
+//
+//  TextureProcessingTests.cpp
+//  tests/image/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureProcessingTests.h"
+
+#include <QtCore/QThread>
+#include <QtGui/QImage>
+
+#include <gpu/Texture.h>
+#include <image/TextureProcessing.h>
+
+QTEST_GUILESS_MAIN(TextureProcessingTests)
+
+// Detailed enough that the compressors can't take shortcuts on flat blocks
+static QImage makeAlbedoImage(int size) {
+    QImage image(size, size, QImage::Format_ARGB32);
+    for (int y = 0; y < size; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < size; ++x) {
+            int noise = ((x * 7919) ^ (y * 104729)) & 0x3F;
+            line[x] = qRgb((x * 255 / size + noise) & 0xFF, (y * 255 / size + noise) & 0xFF, ((x ^ y) + noise) & 0xFF);
+        }
+    }
+    return image;
+}
+
+static QImage makeNormalImage(int size) {
+    QImage image(size, size, QImage::Format_ARGB32);
+    for (int y = 0; y < size; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < size; ++x) {
+            // bumps on a grid
+            glm::vec3 normal = glm::normalize(glm::vec3(sinf(0.05f * (float)x), cosf(0.07f * (float)y), 2.0f));
+            glm::ivec3 encoded = glm::ivec3((0.5f * normal + 0.5f) * 255.0f);
+            line[x] = qRgb(encoded.x, encoded.y, encoded.z);
+        }
+    }
+    return image;
+}
+
+static gpu::TexturePointer compress(const QImage& source, image::TextureUsage::Type type, const std::atomic<bool>& abortProcessing) {
+    auto loader = image::TextureUsage::getTextureLoaderForType(type);
+    return loader(image::Image(source), "test", true, gpu::BackendTarget::GL45, abortProcessing);
+}
+
+void TextureProcessingTests::cleanup() {
+    image::setCompressionThreadBudget(0);
+}
+
+void TextureProcessingTests::testThreadBudgetKeepsOutput() {
+    auto source = makeAlbedoImage(512);
+    std::atomic<bool> abortProcessing { false };
+
+    image::setCompressionThreadBudget(1);
+    auto sequential = compress(source, image::TextureUsage::ALBEDO_TEXTURE, abortProcessing);
+    image::setCompressionThreadBudget(0);
+    auto parallel = compress(source, image::TextureUsage::ALBEDO_TEXTURE, abortProcessing);
+
+    QVERIFY(sequential && parallel);
+    QCOMPARE(parallel->getStoredMipFormat(), sequential->getStoredMipFormat());
+    QCOMPARE(parallel->getNumMips(), sequential->getNumMips());
+    for (uint16_t level = 0; level < sequential->getNumMips(); ++level) {
+        QVERIFY(sequential->isStoredMipFaceAvailable(level));
+        QVERIFY(parallel->isStoredMipFaceAvailable(level));
+        auto expected = sequential->accessStoredMipFace(level);
+        auto actual = parallel->accessStoredMipFace(level);
+        QCOMPARE(actual->size(), expected->size());
+        QVERIFY(memcmp(actual->data(), expected->data(), expected->size()) == 0);
+    }
+}
+
+void TextureProcessingTests::testAbortSkipsMips() {
+    std::atomic<bool> abortProcessing { true };
+    auto texture = compress(makeAlbedoImage(512), image::TextureUsage::ALBEDO_TEXTURE, abortProcessing);
+
+    // the first level is still written out, with its blocks skipped, but no further mip gets built
+    QVERIFY(texture);
+    QVERIFY(!texture->isStoredMipFaceAvailable(texture->getNumMips() - 1));
+}
+
+void TextureProcessingTests::benchmarkCompression_data() {
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("budget");
+
+    const int NUM_CORES = QThread::idealThreadCount();
+    QTest::newRow("albedo 4K, 1 thread") << (int)image::TextureUsage::ALBEDO_TEXTURE << 1;
+    QTest::newRow("albedo 4K, all cores") << (int)image::TextureUsage::ALBEDO_TEXTURE << NUM_CORES;
+    QTest::newRow("normal 4K, 1 thread") << (int)image::TextureUsage::NORMAL_TEXTURE << 1;
+    QTest::newRow("normal 4K, all cores") << (int)image::TextureUsage::NORMAL_TEXTURE << NUM_CORES;
+}
+
+void TextureProcessingTests::benchmarkCompression() {
+    QFETCH(int, type);
+    QFETCH(int, budget);
+
+    const int SIZE = 4096;
+    auto textureType = (image::TextureUsage::Type)type;
+    auto source = (textureType == image::TextureUsage::NORMAL_TEXTURE) ? makeNormalImage(SIZE) : makeAlbedoImage(SIZE);
+    std::atomic<bool> abortProcessing { false };
+
+    image::setCompressionThreadBudget(budget);
+    QBENCHMARK_ONCE {
+        auto texture = compress(source, textureType, abortProcessing);
+        QVERIFY(texture);
+    }
+}
@@ -0,0 +1,78 @@
+//
+//  MeshDecimationTests.cpp
+//  tests/model-baker/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MeshDecimationTests.h"
+
+#include <model-baker/ModelMath.h>
+
+QTEST_GUILESS_MAIN(MeshDecimationTests)
+
+// A wavy grid of size x size quads, split into triangles, with a part for each of its numParts bands
+static hfm::Mesh createGridMesh(int size, int numParts) {
+    hfm::Mesh mesh;
+    for (int y = 0; y <= size; y++) {
+        for (int x = 0; x <= size; x++) {
+            mesh.vertices.append(glm::vec3(x, sinf(0.3f * x) * cosf(0.2f * y), y));
+        }
+    }
+    mesh.parts.resize(numParts);
+    for (int y = 0; y < size; y++) {
+        auto& part = mesh.parts[y * numParts / size];
+        for (int x = 0; x < size; x++) {
+            int corner = y * (size + 1) + x;
+            part.triangleIndices << corner << corner + 1 << corner + size + 1;
+            part.triangleIndices << corner + 1 << corner + size + 2 << corner + size + 1;
+        }
+    }
+    return mesh;
+}
+
+static int countTriangles(const hfm::Mesh& mesh) {
+    int triangleCount = 0;
+    for (const auto& part : mesh.parts) {
+        triangleCount += (part.quadTrianglesIndices.size() + part.triangleIndices.size()) / 3;
+    }
+    return triangleCount;
+}
+
+void MeshDecimationTests::testDecimationReachesTarget() {
+    auto mesh = createGridMesh(64, 1);
+    int triangleCount = countTriangles(mesh);
+
+    for (int divisor : { 4, 16 }) {
+        auto decimatedMesh = baker::decimateMesh(mesh, triangleCount / divisor);
+        int decimatedTriangleCount = countTriangles(decimatedMesh);
+        QVERIFY(decimatedTriangleCount <= triangleCount / divisor);
+        // vertex clustering can't hit the target exactly, but shouldn't undershoot it by much either
+        QVERIFY(decimatedTriangleCount > triangleCount / divisor / 4);
+
+        // the vertices are shared with the original mesh, and every index still points at one of them
+        QCOMPARE(decimatedMesh.vertices.size(), mesh.vertices.size());
+        for (int index : decimatedMesh.parts[0].triangleIndices) {
+            QVERIFY(index >= 0 && index < mesh.vertices.size());
+        }
+    }
+}
+
+void MeshDecimationTests::testPartsAreKept() {
+    auto mesh = createGridMesh(32, 8);
+    auto decimatedMesh = baker::decimateMesh(mesh, 1);
+    QCOMPARE(decimatedMesh.parts.size(), mesh.parts.size());
+    for (const auto& part : decimatedMesh.parts) {
+        QVERIFY(part.triangleIndices.size() >= 3);
+        QCOMPARE(part.triangleIndices.size() % 3, 0);
+    }
+}
+
+void MeshDecimationTests::testSmallMeshIsUnchanged() {
+    auto mesh = createGridMesh(4, 1);
+    auto decimatedMesh = baker::decimateMesh(mesh, countTriangles(mesh));
+    QCOMPARE(decimatedMesh.parts[0].triangleIndices, mesh.parts[0].triangleIndices);
+}
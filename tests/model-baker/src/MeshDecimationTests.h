@@ -0,0 +1,25 @@
+//
+//  MeshDecimationTests.h
+//  tests/model-baker/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MeshDecimationTests_h
+#define hifi_MeshDecimationTests_h
+
+#include <QtTest/QtTest>
+
+class MeshDecimationTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testDecimationReachesTarget();
+    void testPartsAreKept();
+    void testSmallMeshIsUnchanged();
+};
+
+#endif // hifi_MeshDecimationTests_h
@@ -0,0 +1,157 @@
+//
+//  MeshPreparationTests.cpp
+//  tests/model-baker/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MeshPreparationTests.h"
+
+#include <model-baker/CalculateMeshNormalsTask.h>
+#include <model-baker/CalculateMeshTangentsTask.h>
+#include <model-baker/CalculateBlendshapeNormalsTask.h>
+#include <model-baker/CalculateBlendshapeTangentsTask.h>
+
+QTEST_GUILESS_MAIN(MeshPreparationTests)
+
+// A wavy grid of size x size quads, split into triangles, with texcoords but no normals or tangents
+static hfm::Mesh createGridMesh(int size, float phase) {
+    hfm::Mesh mesh;
+    for (int y = 0; y <= size; y++) {
+        for (int x = 0; x <= size; x++) {
+            mesh.vertices.append(glm::vec3(x, sinf(phase + 0.3f * x) * cosf(0.2f * y), y));
+            mesh.texCoords.append(glm::vec2(x, y) / (float)size);
+        }
+    }
+    hfm::MeshPart part;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            int corner = y * (size + 1) + x;
+            part.triangleIndices << corner << corner + 1 << corner + size + 1;
+            part.triangleIndices << corner + 1 << corner + size + 2 << corner + size + 1;
+        }
+    }
+    mesh.parts.push_back(part);
+
+    // every other vertex of the first rows moves in each blendshape
+    for (int b = 0; b < 3; b++) {
+        hfm::Blendshape blendshape;
+        for (int i = 0; i < std::min(mesh.vertices.size(), 4 * (size + 1)); i += 2) {
+            blendshape.indices.append(i);
+            blendshape.vertices.append(mesh.vertices[i] + glm::vec3(0.0f, 0.1f * (b + 1), 0.0f));
+        }
+        mesh.blendshapes.append(blendshape);
+    }
+    return mesh;
+}
+
+static std::vector<hfm::Mesh> createMeshes(int numMeshes, int size) {
+    std::vector<hfm::Mesh> meshes;
+    for (int i = 0; i < numMeshes; i++) {
+        meshes.push_back(createGridMesh(size + (i % 7), 0.1f * i));
+    }
+    return meshes;
+}
+
+static baker::NormalsPerMesh calculateNormals(const std::vector<hfm::Mesh>& meshes) {
+    baker::NormalsPerMesh normalsPerMesh;
+    CalculateMeshNormalsTask().run(nullptr, meshes, normalsPerMesh);
+    return normalsPerMesh;
+}
+
+static baker::TangentsPerMesh calculateTangents(const std::vector<hfm::Mesh>& meshes, const baker::NormalsPerMesh& normalsPerMesh) {
+    CalculateMeshTangentsTask::Input input;
+    input.edit0() = normalsPerMesh;
+    input.edit1() = meshes;
+    baker::TangentsPerMesh tangentsPerMesh;
+    CalculateMeshTangentsTask().run(nullptr, input, tangentsPerMesh);
+    return tangentsPerMesh;
+}
+
+static baker::BlendshapesPerMesh getBlendshapes(const std::vector<hfm::Mesh>& meshes) {
+    baker::BlendshapesPerMesh blendshapesPerMesh;
+    for (const auto& mesh : meshes) {
+        blendshapesPerMesh.push_back(mesh.blendshapes.toStdVector());
+    }
+    return blendshapesPerMesh;
+}
+
+void MeshPreparationTests::testNormalsAndTangentsMatchPerMesh() {
+    auto meshes = createMeshes(64, 8);
+    auto normalsPerMesh = calculateNormals(meshes);
+    auto tangentsPerMesh = calculateTangents(meshes, normalsPerMesh);
+    QCOMPARE(normalsPerMesh.size(), meshes.size());
+    QCOMPARE(tangentsPerMesh.size(), meshes.size());
+
+    // each mesh prepared on its own must give exactly what it got as part of the batch, in the same slot
+    for (size_t i = 0; i < meshes.size(); i++) {
+        std::vector<hfm::Mesh> single { meshes[i] };
+        auto normals = calculateNormals(single);
+        QVERIFY(normals[0] == normalsPerMesh[i]);
+        QVERIFY(calculateTangents(single, normals)[0] == tangentsPerMesh[i]);
+    }
+}
+
+void MeshPreparationTests::testBlendshapesMatchPerMesh() {
+    auto meshes = createMeshes(16, 6);
+
+    CalculateBlendshapeNormalsTask::Input normalsInput;
+    normalsInput.edit0() = getBlendshapes(meshes);
+    normalsInput.edit1() = meshes;
+    CalculateBlendshapeNormalsTask::Output normalsPerBlendshapePerMesh;
+    CalculateBlendshapeNormalsTask().run(nullptr, normalsInput, normalsPerBlendshapePerMesh);
+
+    CalculateBlendshapeTangentsTask::Input tangentsInput;
+    tangentsInput.edit0() = normalsPerBlendshapePerMesh;
+    tangentsInput.edit1() = getBlendshapes(meshes);
+    tangentsInput.edit2() = meshes;
+    CalculateBlendshapeTangentsTask::Output tangentsPerBlendshapePerMesh;
+    CalculateBlendshapeTangentsTask().run(nullptr, tangentsInput, tangentsPerBlendshapePerMesh);
+
+    QCOMPARE(normalsPerBlendshapePerMesh.size(), meshes.size());
+    QCOMPARE(tangentsPerBlendshapePerMesh.size(), meshes.size());
+    for (size_t i = 0; i < meshes.size(); i++) {
+        std::vector<hfm::Mesh> single { meshes[i] };
+        CalculateBlendshapeNormalsTask::Input singleNormalsInput;
+        singleNormalsInput.edit0() = getBlendshapes(single);
+        singleNormalsInput.edit1() = single;
+        CalculateBlendshapeNormalsTask::Output singleNormals;
+        CalculateBlendshapeNormalsTask().run(nullptr, singleNormalsInput, singleNormals);
+
+        CalculateBlendshapeTangentsTask::Input singleTangentsInput;
+        singleTangentsInput.edit0() = singleNormals;
+        singleTangentsInput.edit1() = getBlendshapes(single);
+        singleTangentsInput.edit2() = single;
+        CalculateBlendshapeTangentsTask::Output singleTangents;
+        CalculateBlendshapeTangentsTask().run(nullptr, singleTangentsInput, singleTangents);
+
+        QCOMPARE(normalsPerBlendshapePerMesh[i].size(), (size_t)meshes[i].blendshapes.size());
+        QVERIFY(singleNormals[0] == normalsPerBlendshapePerMesh[i]);
+        QVERIFY(singleTangents[0] == tangentsPerBlendshapePerMesh[i]);
+    }
+}
+
+void MeshPreparationTests::benchmarkMeshPreparation_data() {
+    QTest::addColumn<int>("numMeshes");
+
+    QTest::newRow("1 mesh") << 1;
+    QTest::newRow("16 meshes") << 16;
+    QTest::newRow("64 meshes") << 64;
+}
+
+void MeshPreparationTests::benchmarkMeshPreparation() {
+    QFETCH(int, numMeshes);
+
+    // the same total vertex count however it is split
+    const int TOTAL_QUADS = 256 * 256;
+    int size = (int)sqrtf((float)(TOTAL_QUADS / numMeshes));
+    auto meshes = createMeshes(numMeshes, size);
+
+    QBENCHMARK {
+        auto normalsPerMesh = calculateNormals(meshes);
+        calculateTangents(meshes, normalsPerMesh);
+    }
+}
@@ -0,0 +1,26 @@
+//
+//  MeshPreparationTests.h
+//  tests/model-baker/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MeshPreparationTests_h
+#define hifi_MeshPreparationTests_h
+
+#include <QtTest/QtTest>
+
+class MeshPreparationTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testNormalsAndTangentsMatchPerMesh();
+    void testBlendshapesMatchPerMesh();
+    void benchmarkMeshPreparation_data();
+    void benchmarkMeshPreparation();
+};
+
+#endif // hifi_MeshPreparationTests_h
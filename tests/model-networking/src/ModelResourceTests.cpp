@@ -0,0 +1,144 @@
+//
+//  ModelResourceTests.cpp
+//  tests/model-networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ModelResourceTests.h"
+
+#include <vector>
+
+#include <QtCore/QSemaphore>
+
+#include <DependencyManager.h>
+#include <ResourceScheduler.h>
+#include <StatTracker.h>
+#include <model-networking/ModelCache.h>
+
+QTEST_GUILESS_MAIN(ModelResourceTests)
+
+namespace {
+
+HFMModel::Pointer makeModel() {
+    auto hfmModel = std::make_shared<HFMModel>();
+    hfmModel->meshes.resize(1);
+    return hfmModel;
+}
+
+QSharedPointer<Resource> makeResource(QObject* owner, float priority) {
+    auto resource = QSharedPointer<Resource>::create();
+    resource->setLoadPriority(owner, priority);
+    return resource;
+}
+
+}
+
+void ModelResourceTests::initTestCase() {
+    DependencyManager::set<StatTracker>();
+}
+
+// A progressive model loaded through an FST, as the oven bakes them: the collision shapes built from the render
+// geometry wait for isRefining() to turn false, so it must do so once the finest LOD has been taken on.
+void ModelResourceTests::testRefiningEndsWithFinestLOD() {
+    ModelResource::Pointer model(new ModelResource(QUrl("file:///test/model.pfbx"), ModelLoader()));
+    model->_hfmModel = makeModel();
+    model->_loaded = true;
+    // the coarsest LOD has loaded, and the finest is on its way
+    model->_progressiveChunks = { ProgressiveModel::Chunk(), ProgressiveModel::Chunk() };
+    model->_progressiveChunkIndex = 1;
+
+    ModelResource::Pointer mapping(new ModelResource(QUrl("file:///test/model.fst"), ModelLoader()));
+    mapping->_modelResource = model;
+    mapping->_hfmModel = model->_hfmModel;
+    mapping->_loaded = true;
+    mapping->_connection = QObject::connect(model.data(), &ModelResource::refined,
+                                            mapping.data(), &ModelResource::onGeometryMappingRefined);
+
+    NetworkModel::Pointer networkModel;
+    ModelResourceWatcher watcher(networkModel);
+    watcher.setResource(mapping);
+    QVERIFY(networkModel);
+    QVERIFY(mapping->isRefining());
+    QVERIFY(watcher.isRefining());
+
+    QSignalSpy refinedSpy(&watcher, &ModelResourceWatcher::refined);
+    auto finest = makeModel();
+    model->refineGeometry(finest);
+
+    QCOMPARE(refinedSpy.count(), 1);
+    QVERIFY(!model->isRefining());
+    QVERIFY(!mapping->isRefining());
+    QVERIFY(!watcher.isRefining());
+    QVERIFY(networkModel->getConstHFMModelPointer() == finest);
+}
+
+// a finer LOD that fails to parse leaves the current one in place for good, so there is nothing left to wait for
+void ModelResourceTests::testFailedRefinementEndsRefining() {
+    ModelResource::Pointer model(new ModelResource(QUrl("file:///test/model.pfbx"), ModelLoader()));
+    auto coarsest = makeModel();
+    model->_hfmModel = coarsest;
+    model->_loaded = true;
+    model->_progressiveChunks = { ProgressiveModel::Chunk(), ProgressiveModel::Chunk(), ProgressiveModel::Chunk() };
+    model->_progressiveChunkIndex = 1;
+
+    NetworkModel::Pointer networkModel;
+    ModelResourceWatcher watcher(networkModel);
+    watcher.setResource(model);
+    QVERIFY(watcher.isRefining());
+
+    QSignalSpy refinedSpy(&watcher, &ModelResourceWatcher::refined);
+    model->failedToParseGeometry();
+
+    QCOMPARE(refinedSpy.count(), 0);
+    QVERIFY(model->isLoaded());
+    QVERIFY(!watcher.isRefining());
+    QVERIFY(networkModel->getConstHFMModelPointer() == coarsest);
+}
+
+// A model requested through an FST loads through the nested resource of the model file, which must follow the priorities
+// of the owners of the FST: those set before it was created, and the updates after.
+void ModelResourceTests::testNestedModelFollowsOwnerPriority() {
+    QObject owner;
+    QObject otherOwner;
+    ModelResource::Pointer mapping(new ModelResource(QUrl("file:///test/model.fst"), ModelLoader()));
+    ModelResource::Pointer model(new ModelResource(QUrl("file:///test/model.fbx"), ModelLoader()));
+
+    mapping->setLoadPriority(&owner, 2.0f);
+    mapping->setModelResource(model);
+    QCOMPARE(model->getLoadPriority(), 2.0f);
+
+    mapping->setLoadPriority(&otherOwner, 5.0f);
+    QCOMPARE(model->getLoadPriority(), 5.0f);
+    mapping->clearLoadPriority(&otherOwner);
+    QCOMPARE(model->getLoadPriority(), 2.0f);
+
+    // and so its decode jobs are ordered by them
+    ResourceScheduler scheduler;
+    scheduler.setMaxDecodeJobs(1);
+
+    // holds the only worker until released, so that the jobs queued meanwhile wait together
+    QSemaphore blockerStarted;
+    QSemaphore blockerReleased;
+    auto blocker = makeResource(&owner, 0.0f);
+    scheduler.schedule(ResourceScheduler::DECODE, blocker, [&] {
+        blockerStarted.release();
+        blockerReleased.acquire();
+    });
+    blockerStarted.acquire();
+
+    std::vector<int> order;
+    auto other = makeResource(&owner, 3.0f);
+    scheduler.schedule(ResourceScheduler::DECODE, other, [&order] { order.push_back(1); });
+    scheduler.schedule(ResourceScheduler::DECODE, model, [&order] { order.push_back(2); });
+
+    // the model came closer to the viewer
+    mapping->setLoadPriority(&owner, 4.0f);
+
+    blockerReleased.release();
+    scheduler.waitForDecodeJobs();
+    QCOMPARE(order, (std::vector<int> { 2, 1 }));
+}
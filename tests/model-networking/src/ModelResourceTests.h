@@ -0,0 +1,25 @@
+//
+//  ModelResourceTests.h
+//  tests/model-networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ModelResourceTests_h
+#define hifi_ModelResourceTests_h
+
+#include <QtTest/QtTest>
+
+class ModelResourceTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testRefiningEndsWithFinestLOD();
+    void testFailedRefinementEndsRefining();
+    void testNestedModelFollowsOwnerPriority();
+};
+
+#endif // hifi_ModelResourceTests_h
@@ -0,0 +1,163 @@
+//
+//  ResourceSchedulerTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceSchedulerTests.h"
+
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QSemaphore>
+
+#include <DependencyManager.h>
+#include <ResourceCache.h>
+#include <ResourceScheduler.h>
+#include <StatTracker.h>
+
+QTEST_MAIN(ResourceSchedulerTests)
+
+namespace {
+
+QSharedPointer<Resource> makeResource(QObject* owner, float priority) {
+    auto resource = QSharedPointer<Resource>::create();
+    resource->setLoadPriority(owner, priority);
+    return resource;
+}
+
+// runs a decode job that holds the only worker until released, so that the jobs queued meanwhile wait together
+class BlockingJob {
+public:
+    void schedule(ResourceScheduler& scheduler, const QSharedPointer<Resource>& resource) {
+        scheduler.schedule(ResourceScheduler::DECODE, resource, [this] {
+            _started.release();
+            _release.acquire();
+        });
+        _started.acquire();
+    }
+    void release() { _release.release(); }
+
+private:
+    QSemaphore _started;
+    QSemaphore _release;
+};
+
+}
+
+void ResourceSchedulerTests::initTestCase() {
+    DependencyManager::set<StatTracker>();
+}
+
+void ResourceSchedulerTests::testDecodeFollowsPriority() {
+    ResourceScheduler scheduler;
+    scheduler.setMaxDecodeJobs(1);
+    QObject owner;
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    auto record = [&](int id) {
+        return [&order, &orderMutex, id] {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(id);
+        };
+    };
+
+    auto blocker = makeResource(&owner, 0.0f);
+    BlockingJob blockingJob;
+    blockingJob.schedule(scheduler, blocker);
+
+    auto low = makeResource(&owner, 1.0f);
+    auto high = makeResource(&owner, 3.0f);
+    auto middle = makeResource(&owner, 2.0f);
+    auto middleToo = makeResource(&owner, 2.0f);
+    scheduler.schedule(ResourceScheduler::DECODE, low, record(1));
+    scheduler.schedule(ResourceScheduler::DECODE, high, record(3));
+    scheduler.schedule(ResourceScheduler::DECODE, middle, record(2));
+    scheduler.schedule(ResourceScheduler::DECODE, middleToo, record(4));
+    QCOMPARE(scheduler.getStats(ResourceScheduler::DECODE).queueDepth, (uint32_t)4);
+
+    blockingJob.release();
+    scheduler.waitForDecodeJobs();
+
+    // jobs of the same priority keep the order they were queued in
+    QCOMPARE(order, (std::vector<int> { 3, 2, 4, 1 }));
+
+    auto stats = scheduler.getStats(ResourceScheduler::DECODE);
+    QCOMPARE(stats.queueDepth, (uint32_t)0);
+    QCOMPARE(stats.active, (uint32_t)0);
+    QCOMPARE(stats.numStarted, (uint64_t)5);
+    QCOMPARE(stats.numCancelled, (uint64_t)0);
+    QVERIFY(stats.maxWaitMsecs >= stats.averageWaitMsecs);
+    QCOMPARE(DependencyManager::get<StatTracker>()->getStat("PendingProcessing").toInt(), 0);
+}
+
+void ResourceSchedulerTests::testPriorityChangesWhileQueued() {
+    ResourceScheduler scheduler;
+    scheduler.setMaxDecodeJobs(1);
+    QObject owner;
+
+    std::vector<int> order;
+    auto blocker = makeResource(&owner, 0.0f);
+    BlockingJob blockingJob;
+    blockingJob.schedule(scheduler, blocker);
+
+    auto near = makeResource(&owner, 2.0f);
+    auto far = makeResource(&owner, 1.0f);
+    scheduler.schedule(ResourceScheduler::DECODE, near, [&order] { order.push_back(1); });
+    scheduler.schedule(ResourceScheduler::DECODE, far, [&order] { order.push_back(2); });
+
+    // the viewer moved: what was far is now the closest
+    far->setLoadPriority(&owner, 3.0f);
+
+    blockingJob.release();
+    scheduler.waitForDecodeJobs();
+    QCOMPARE(order, (std::vector<int> { 2, 1 }));
+}
+
+void ResourceSchedulerTests::testReleasedResourceIsCancelled() {
+    ResourceScheduler scheduler;
+    scheduler.setMaxDecodeJobs(1);
+    QObject owner;
+
+    auto blocker = makeResource(&owner, 0.0f);
+    BlockingJob blockingJob;
+    blockingJob.schedule(scheduler, blocker);
+
+    bool releasedRan = false;
+    bool keptRan = false;
+    auto released = makeResource(&owner, 1.0f);
+    auto kept = makeResource(&owner, 1.0f);
+    scheduler.schedule(ResourceScheduler::DECODE, released, [&releasedRan] { releasedRan = true; });
+    scheduler.schedule(ResourceScheduler::DECODE, kept, [&keptRan] { keptRan = true; });
+    released.reset();
+
+    blockingJob.release();
+    scheduler.waitForDecodeJobs();
+
+    QVERIFY(!releasedRan);
+    QVERIFY(keptRan);
+    QCOMPARE(scheduler.getStats(ResourceScheduler::DECODE).numCancelled, (uint64_t)1);
+    QCOMPARE(DependencyManager::get<StatTracker>()->getStat("PendingProcessing").toInt(), 0);
+}
+
+void ResourceSchedulerTests::testUploadFollowsPriority() {
+    ResourceScheduler scheduler;
+    QObject owner;
+
+    std::vector<int> order;
+    auto low = makeResource(&owner, 1.0f);
+    auto high = makeResource(&owner, 2.0f);
+    scheduler.schedule(ResourceScheduler::UPLOAD, low, [&order] { order.push_back(1); });
+    scheduler.schedule(ResourceScheduler::UPLOAD, high, [&order] { order.push_back(2); });
+
+    // uploads run from the event loop of the thread the scheduler lives on
+    QVERIFY(order.empty());
+    QTRY_COMPARE(order.size(), (size_t)2);
+    QCOMPARE(order, (std::vector<int> { 2, 1 }));
+    QCOMPARE(scheduler.getStats(ResourceScheduler::UPLOAD).numStarted, (uint64_t)2);
+}
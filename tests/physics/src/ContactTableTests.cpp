@@ -0,0 +1,170 @@
+//
+//  ContactTableTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactTableTests.h"
+
+#include <map>
+
+#include <ContactTable.h>
+
+QTEST_MAIN(ContactTableTests)
+
+// fake ObjectMotionState pointers, aligned like the real ones
+static void* objectPointer(int i) {
+    return reinterpret_cast<void*>((uintptr_t)(i + 1) * 16);
+}
+
+static btManifoldPoint pointWithDistance(float distance) {
+    return btManifoldPoint(btVector3(0.0f, 0.0f, 0.0f), btVector3(0.0f, 0.0f, 0.0f), btVector3(0.0f, 1.0f, 0.0f), distance);
+}
+
+void ContactTableTests::testInsertFindErase() {
+    const int NUM_OBJECTS = 1000;
+    ContactTable table;
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        table[ContactKey(objectPointer(i), objectPointer(i + 1))].update(1, pointWithDistance((float)i));
+    }
+    QCOMPARE((int)table.size(), NUM_OBJECTS);
+
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        auto itr = table.find(ContactKey(objectPointer(i), objectPointer(i + 1)));
+        QVERIFY(itr != table.end());
+        QCOMPARE(itr->second.distance, (btScalar)i);
+
+        // the key is ordered: (b, a) is a different contact
+        QVERIFY(table.find(ContactKey(objectPointer(i + 1), objectPointer(i))) == table.end());
+    }
+
+    // updating an existing contact does not add another
+    table[ContactKey(objectPointer(0), objectPointer(1))].update(2, pointWithDistance(-1.0f));
+    QCOMPARE((int)table.size(), NUM_OBJECTS);
+    QCOMPARE(table.find(ContactKey(objectPointer(0), objectPointer(1)))->second.distance, (btScalar)-1.0f);
+
+    for (int i = 0; i < NUM_OBJECTS; i += 2) {
+        table.erase(table.find(ContactKey(objectPointer(i), objectPointer(i + 1))));
+    }
+    QCOMPARE((int)table.size(), NUM_OBJECTS / 2);
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        bool found = table.find(ContactKey(objectPointer(i), objectPointer(i + 1))) != table.end();
+        QCOMPARE(found, (i % 2) == 1);
+    }
+
+    // reinserting an erased contact starts it afresh
+    ContactInfo& info = table[ContactKey(objectPointer(0), objectPointer(1))];
+    QCOMPARE(info.computeType(3), CONTACT_EVENT_TYPE_START);
+}
+
+void ContactTableTests::testEraseWhileIterating() {
+    // the same loop PhysicsEngine::removeContacts() runs, checked against std::map
+    const int NUM_OBJECTS = 500;
+    ContactTable table;
+    std::map<ContactKey, int> reference;
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        for (int j = 1; j <= 3; j++) {
+            ContactKey key(objectPointer(i), objectPointer((i + j * 7) % NUM_OBJECTS));
+            table[key].update(1, pointWithDistance(0.0f));
+            reference[key] = 1;
+        }
+    }
+    QCOMPARE(table.size(), reference.size());
+
+    for (int removed = 0; removed < NUM_OBJECTS; removed += 3) {
+        void* object = objectPointer(removed);
+        auto itr = table.begin();
+        while (itr != table.end()) {
+            if (itr->first._a == object || itr->first._b == object) {
+                QVERIFY(reference.erase(itr->first) == 1);
+                itr = table.erase(itr);
+            } else {
+                ++itr;
+            }
+        }
+        QCOMPARE(table.size(), reference.size());
+    }
+
+    size_t numVisited = 0;
+    for (auto& entry : table) {
+        QVERIFY(reference.find(entry.first) != reference.end());
+        ++numVisited;
+    }
+    QCOMPARE(numVisited, reference.size());
+}
+
+void ContactTableTests::testClear() {
+    ContactTable table;
+    for (int i = 0; i < 100; i++) {
+        table[ContactKey(objectPointer(i), nullptr)];
+    }
+    size_t capacity = table.capacity();
+    table.clear();
+    QVERIFY(table.empty());
+    QVERIFY(table.begin() == table.end());
+    QVERIFY(table.find(ContactKey(objectPointer(0), nullptr)) == table.end());
+
+    // the slots are reused rather than reallocated
+    QCOMPARE(table.capacity(), capacity);
+    table[ContactKey(objectPointer(0), nullptr)];
+    QCOMPARE((int)table.size(), 1);
+}
+
+void ContactTableTests::benchmarkUpdate_data() {
+    QTest::addColumn<bool>("useTable");
+    QTest::newRow("std::map") << false;
+    QTest::newRow("ContactTable") << true;
+}
+
+void ContactTableTests::benchmarkUpdate() {
+    // roughly the contacts of a settled pile of 2000 boxes: each touches the ones below and beside it
+    const int NUM_OBJECTS = 2000;
+    const int NUM_NEIGHBORS = 3;
+    std::vector<ContactKey> keys;
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        for (int j = 1; j <= NUM_NEIGHBORS; j++) {
+            keys.push_back(ContactKey(objectPointer(i), objectPointer((i + j * 37) % NUM_OBJECTS)));
+        }
+    }
+    btManifoldPoint point = pointWithDistance(-0.01f);
+
+    QFETCH(bool, useTable);
+    uint32_t step = 0;
+    if (useTable) {
+        ContactTable table;
+        QBENCHMARK {
+            ++step;
+            for (const auto& key : keys) {
+                table[key].update(step, point);
+            }
+            auto itr = table.begin();
+            while (itr != table.end()) {
+                if (itr->second.computeType(step) == CONTACT_EVENT_TYPE_END) {
+                    itr = table.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+        }
+    } else {
+        std::map<ContactKey, ContactInfo> map;
+        QBENCHMARK {
+            ++step;
+            for (const auto& key : keys) {
+                map[key].update(step, point);
+            }
+            auto itr = map.begin();
+            while (itr != map.end()) {
+                if (itr->second.computeType(step) == CONTACT_EVENT_TYPE_END) {
+                    itr = map.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+        }
+    }
+}
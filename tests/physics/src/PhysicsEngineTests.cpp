@@ -0,0 +1,241 @@
+//
+//  PhysicsEngineTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsEngineTests.h"
+
+#include <algorithm>
+#include <set>
+
+#include <BulletUtil.h>
+#include <ObjectMotionState.h>
+#include <PhysicsCollisionGroups.h>
+#include <PhysicsEngine.h>
+#include <PhysicsHelpers.h>
+#include <ShapeManager.h>
+
+QTEST_MAIN(PhysicsEngineTests)
+
+const float BODY_RADIUS = 0.25f;
+const float BODY_SPACING = 0.6f;
+const float FLOOR_HALF_EXTENT = 100.0f;
+const int NUM_SETTLING_STEPS = 30;
+
+// the smallest ObjectMotionState that PhysicsEngine will simulate: a dynamic body or static box that nothing else observes
+class TestMotionState : public ObjectMotionState {
+public:
+    TestMotionState(const btCollisionShape* shape, ShapeType shapeType, PhysicsMotionType motionType, const glm::vec3& position) :
+        ObjectMotionState(shape),
+        _shapeType(shapeType),
+        _motionType(motionType),
+        _position(position),
+        _id(QUuid::createUuid()) {
+        _type = MOTIONSTATE_TYPE_DETAILED;
+        setMass(motionType == MOTION_TYPE_DYNAMIC ? 1.0f : 0.0f);
+    }
+
+    void getWorldTransform(btTransform& worldTrans) const override {
+        worldTrans.setIdentity();
+        worldTrans.setOrigin(glmToBullet(_position - ObjectMotionState::getWorldOffset()));
+    }
+    void setWorldTransform(const btTransform& worldTrans) override {
+        _position = bulletToGLM(worldTrans.getOrigin()) + ObjectMotionState::getWorldOffset();
+    }
+
+    uint32_t getIncomingDirtyFlags() const override { return 0; }
+    void clearIncomingDirtyFlags(uint32_t mask) override {}
+    PhysicsMotionType computePhysicsMotionType() const override { return _motionType; }
+    bool isMoving() const override { return _motionType == MOTION_TYPE_DYNAMIC; }
+
+    float getObjectRestitution() const override { return 0.2f; }
+    float getObjectFriction() const override { return 0.5f; }
+    float getObjectLinearDamping() const override { return 0.0f; }
+    float getObjectAngularDamping() const override { return 0.0f; }
+
+    glm::vec3 getObjectPosition() const override { return _position; }
+    glm::quat getObjectRotation() const override { return glm::quat(); }
+    glm::vec3 getObjectLinearVelocity() const override { return glm::vec3(0.0f); }
+    glm::vec3 getObjectAngularVelocity() const override { return glm::vec3(0.0f); }
+    glm::vec3 getObjectGravity() const override { return glm::vec3(0.0f, -9.8f, 0.0f); }
+
+    const QUuid getObjectID() const override { return _id; }
+    QUuid getSimulatorID() const override { return QUuid(); }
+    ShapeType getShapeType() const override { return _shapeType; }
+
+    // dynamic bodies report their contacts, as owned entities do
+    bool isLocallyOwnedOrShouldBe() const override { return _motionType == MOTION_TYPE_DYNAMIC; }
+
+    void computeCollisionGroupAndMask(int32_t& group, int32_t& mask) const override {
+        if (_motionType == MOTION_TYPE_DYNAMIC) {
+            group = BULLET_COLLISION_GROUP_DYNAMIC;
+            mask = BULLET_COLLISION_MASK_DYNAMIC;
+        } else {
+            group = BULLET_COLLISION_GROUP_STATIC;
+            mask = BULLET_COLLISION_MASK_STATIC;
+        }
+    }
+
+    const glm::vec3& getPosition() const { return _position; }
+
+private:
+    ShapeType _shapeType;
+    PhysicsMotionType _motionType;
+    glm::vec3 _position;
+    QUuid _id;
+};
+
+// a floor with numBodies spheres or boxes stacked in columns above it, so the bodies fall, collide and form islands
+class TestScene {
+public:
+    TestScene(int numBodies, int numThreads, ShapeType bodyType = SHAPE_TYPE_SPHERE) : _engine(glm::vec3(0.0f)) {
+        ObjectMotionState::setShapeManager(&_shapeManager);
+        _engine.init(numThreads);
+
+        ShapeInfo floorInfo;
+        floorInfo.setBox(glm::vec3(FLOOR_HALF_EXTENT, 0.5f, FLOOR_HALF_EXTENT));
+        _objects.push_back(new TestMotionState(_shapeManager.getShape(floorInfo), SHAPE_TYPE_BOX, MOTION_TYPE_STATIC,
+                                               glm::vec3(0.0f, -0.5f, 0.0f)));
+
+        ShapeInfo bodyInfo;
+        if (bodyType == SHAPE_TYPE_BOX) {
+            bodyInfo.setBox(glm::vec3(BODY_RADIUS));
+        } else {
+            bodyInfo.setSphere(BODY_RADIUS);
+        }
+        int columnsPerSide = (int)ceilf(sqrtf((float)numBodies / 10.0f));
+        for (int i = 0; i < numBodies; i++) {
+            int column = i % (columnsPerSide * columnsPerSide);
+            int level = i / (columnsPerSide * columnsPerSide);
+            glm::vec3 position((float)(column % columnsPerSide) * BODY_SPACING, 1.0f + (float)level * BODY_SPACING,
+                               (float)(column / columnsPerSide) * BODY_SPACING);
+            _objects.push_back(new TestMotionState(_shapeManager.getShape(bodyInfo), bodyInfo.getType(), MOTION_TYPE_DYNAMIC, position));
+        }
+        _engine.addObjects(_objects);
+    }
+
+    ~TestScene() {
+        _engine.removeObjects(_objects);
+        for (auto object : _objects) {
+            delete object;
+        }
+    }
+
+    // one fixed substep, then harvest the changed motion states the way PhysicalEntitySimulation does
+    int step() {
+        ThreadSafeDynamicsWorld* world = static_cast<ThreadSafeDynamicsWorld*>(_engine.getDynamicsWorld());
+        world->stepSimulationWithSubstepCallback(PHYSICS_ENGINE_FIXED_SUBSTEP, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
+                                                 PHYSICS_ENGINE_FIXED_SUBSTEP, [this] { _engine.updateContactMap(); });
+        return _engine.getChangedMotionStates().size();
+    }
+
+    PhysicsEngine& getEngine() { return _engine; }
+    const VectorOfMotionStates& getObjects() const { return _objects; }
+
+private:
+    ShapeManager _shapeManager;
+    PhysicsEngine _engine;
+    VectorOfMotionStates _objects;
+};
+
+void PhysicsEngineTests::testMultithreadedHarvest() {
+    const int NUM_BODIES = 200;
+    const int NUM_THREADS = 4;
+    TestScene scene(NUM_BODIES, NUM_THREADS);
+#if BT_THREADSAFE
+    QVERIFY(scene.getEngine().isMultithreaded());
+#endif
+
+    // every dynamic body is active while it falls, and each one is harvested once per step
+    int numChanged = scene.step();
+    QCOMPARE(numChanged, NUM_BODIES);
+
+    for (int i = 0; i < NUM_SETTLING_STEPS; i++) {
+        scene.step();
+    }
+
+    // the spheres fell, but the floor stopped them
+    for (auto object : scene.getObjects()) {
+        TestMotionState* state = static_cast<TestMotionState*>(object);
+        if (state->isMoving()) {
+            QVERIFY(state->getPosition().y > BODY_RADIUS * 0.5f);
+            QVERIFY(state->getPosition().y < 1.0f + (float)NUM_BODIES * BODY_SPACING);
+        }
+    }
+}
+
+void PhysicsEngineTests::benchmarkStepSimulation_data() {
+    QTest::addColumn<int>("numBodies");
+    QTest::addColumn<int>("numThreads");
+
+    int maxThreads = std::max(QThread::idealThreadCount(), 2);
+    QTest::newRow("1k bodies, 1 thread") << 1000 << 1;
+    QTest::newRow("1k bodies, all threads") << 1000 << maxThreads;
+    QTest::newRow("5k bodies, 1 thread") << 5000 << 1;
+    QTest::newRow("5k bodies, all threads") << 5000 << maxThreads;
+}
+
+void PhysicsEngineTests::benchmarkStepSimulation() {
+    QFETCH(int, numBodies);
+    QFETCH(int, numThreads);
+
+    TestScene scene(numBodies, numThreads);
+
+    // let the stacks collapse, so the benchmark measures a frame full of contacts
+    for (int i = 0; i < NUM_SETTLING_STEPS; i++) {
+        scene.step();
+    }
+
+    QBENCHMARK {
+        scene.step();
+    }
+}
+
+void PhysicsEngineTests::testCollisionEvents() {
+    const int NUM_BODIES = 100;
+    TestScene scene(NUM_BODIES, 1, SHAPE_TYPE_BOX);
+
+    // give the top of the stacks time to land
+    const int NUM_LANDING_STEPS = 4 * NUM_SETTLING_STEPS;
+    for (int i = 0; i < NUM_LANDING_STEPS; i++) {
+        scene.step();
+    }
+
+    // the pile is resting on the floor, so each body starts at least one contact
+    const CollisionEvents& events = scene.getEngine().getCollisionEvents();
+    QVERIFY((int)events.size() >= NUM_BODIES);
+    std::set<QUuid> ids;
+    for (const auto& event : events) {
+        QCOMPARE(event.type, CONTACT_EVENT_TYPE_START);
+        QVERIFY(!event.idA.isNull());
+        ids.insert(event.idA);
+        ids.insert(event.idB);
+    }
+    QVERIFY((int)ids.size() >= NUM_BODIES);
+
+    // without another step every contact is already known: the ones that were updated continue quietly
+    // and only the stale ones report that they ended
+    for (const auto& event : scene.getEngine().getCollisionEvents()) {
+        QCOMPARE(event.type, CONTACT_EVENT_TYPE_END);
+    }
+}
+
+void PhysicsEngineTests::benchmarkBoxPile() {
+    // a pile of 2000 boxes: thousands of touching pairs whose contacts are updated every substep
+    const int NUM_BODIES = 2000;
+    TestScene scene(NUM_BODIES, 1, SHAPE_TYPE_BOX);
+    for (int i = 0; i < NUM_SETTLING_STEPS; i++) {
+        scene.step();
+        scene.getEngine().getCollisionEvents();
+    }
+
+    QBENCHMARK {
+        scene.getEngine().updateContactMap();
+        scene.getEngine().getCollisionEvents();
+    }
+}
@@ -0,0 +1,203 @@
+//
+//  ShapeCacheTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ShapeCacheTests.h"
+
+#include <QTemporaryDir>
+
+#include <ShapeCache.h>
+#include <ShapeFactory.h>
+
+QTEST_MAIN(ShapeCacheTests)
+
+static ShapeCachePointer makeCache(const QTemporaryDir& dir) {
+    auto cache = std::make_shared<ShapeCache>(dir.path().toStdString(), ShapeCache::EXT);
+    cache->initialize();
+    return cache;
+}
+
+static ShapeInfo makeCompoundShapeInfo(int numHulls) {
+    // each hull is a cube with a point poking out of one face, which the hull builder must keep
+    ShapeInfo::PointCollection pointCollection;
+    for (int i = 0; i < numHulls; ++i) {
+        glm::vec3 offset((float)(2 * i), 0.0f, 0.0f);
+        ShapeInfo::PointList pointList;
+        for (int j = 0; j < 8; ++j) {
+            glm::vec3 corner((j & 1) ? 0.5f : -0.5f, (j & 2) ? 0.5f : -0.5f, (j & 4) ? 0.5f : -0.5f);
+            pointList.push_back(corner + offset);
+        }
+        pointList.push_back(glm::vec3(0.0f, 1.0f, 0.0f) + offset);
+        pointCollection.push_back(pointList);
+    }
+
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_COMPOUND, glm::vec3((float)numHulls, 1.0f, 0.5f));
+    info.setPointCollection(pointCollection);
+    return info;
+}
+
+static ShapeInfo makeStaticMeshShapeInfo(int numCellsPerSide) {
+    // a bumpy square grid of triangles
+    int numVerticesPerSide = numCellsPerSide + 1;
+    ShapeInfo::PointCollection pointCollection(1);
+    ShapeInfo::PointList& vertices = pointCollection[0];
+    for (int i = 0; i < numVerticesPerSide; ++i) {
+        for (int j = 0; j < numVerticesPerSide; ++j) {
+            float height = 0.1f * (float)((i * 7 + j * 3) % 5);
+            vertices.push_back(glm::vec3((float)i, height, (float)j));
+        }
+    }
+
+    ShapeInfo info;
+    float halfSide = 0.5f * (float)numCellsPerSide;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(halfSide, 0.5f, halfSide), "http://example.com/grid.fbx");
+    info.setPointCollection(pointCollection);
+    ShapeInfo::TriangleIndices& triangleIndices = info.getTriangleIndices();
+    for (int i = 0; i < numCellsPerSide; ++i) {
+        for (int j = 0; j < numCellsPerSide; ++j) {
+            int32_t corner = i * numVerticesPerSide + j;
+            triangleIndices.push_back(corner);
+            triangleIndices.push_back(corner + 1);
+            triangleIndices.push_back(corner + numVerticesPerSide);
+            triangleIndices.push_back(corner + 1);
+            triangleIndices.push_back(corner + numVerticesPerSide + 1);
+            triangleIndices.push_back(corner + numVerticesPerSide);
+        }
+    }
+    return info;
+}
+
+static void compareHulls(const btConvexHullShape* hullA, const btConvexHullShape* hullB) {
+    QCOMPARE(hullA->getNumPoints(), hullB->getNumPoints());
+    QCOMPARE(hullA->getMargin(), hullB->getMargin());
+    for (int i = 0; i < hullA->getNumPoints(); ++i) {
+        QCOMPARE(hullA->getUnscaledPoints()[i], hullB->getUnscaledPoints()[i]);
+    }
+}
+
+void ShapeCacheTests::testHullsRoundTrip() {
+    QTemporaryDir dir;
+    auto cache = makeCache(dir);
+
+    const int numHulls = 3;
+    ShapeInfo info = makeCompoundShapeInfo(numHulls);
+
+    // the first build saves the hulls...
+    const btCollisionShape* builtShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(builtShape != nullptr);
+    QCOMPARE(builtShape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    const btCompoundShape* builtCompound = static_cast<const btCompoundShape*>(builtShape);
+    QCOMPARE(builtCompound->getNumChildShapes(), numHulls);
+
+    std::vector<btConvexHullShape*> hulls;
+    QVERIFY(cache->loadHulls(info, hulls));
+    QCOMPARE((int)hulls.size(), numHulls);
+    for (int i = 0; i < numHulls; ++i) {
+        compareHulls(hulls[i], static_cast<const btConvexHullShape*>(builtCompound->getChildShape(i)));
+        delete hulls[i];
+    }
+
+    // ...and the next build of the same shape is made from them
+    const btCollisionShape* cachedShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(cachedShape != nullptr);
+    QCOMPARE(cachedShape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    const btCompoundShape* cachedCompound = static_cast<const btCompoundShape*>(cachedShape);
+    QCOMPARE(cachedCompound->getNumChildShapes(), numHulls);
+    for (int i = 0; i < numHulls; ++i) {
+        compareHulls(static_cast<const btConvexHullShape*>(cachedCompound->getChildShape(i)),
+                     static_cast<const btConvexHullShape*>(builtCompound->getChildShape(i)));
+    }
+
+    ShapeFactory::deleteShape(builtShape);
+    ShapeFactory::deleteShape(cachedShape);
+}
+
+void ShapeCacheTests::testBvhRoundTrip() {
+    QTemporaryDir dir;
+    auto cache = makeCache(dir);
+    ShapeInfo info = makeStaticMeshShapeInfo(16);
+
+    const btCollisionShape* builtShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(builtShape != nullptr);
+    QCOMPARE(builtShape->getShapeType(), (int)TRIANGLE_MESH_SHAPE_PROXYTYPE);
+
+    void* bvhBuffer = nullptr;
+    btOptimizedBvh* bvh = cache->loadBvh(info, bvhBuffer);
+    QVERIFY(bvh != nullptr);
+    QVERIFY(bvhBuffer != nullptr);
+    const btOptimizedBvh* builtBvh = static_cast<const btBvhTriangleMeshShape*>(builtShape)->getOptimizedBvh();
+    QCOMPARE(bvh->isQuantized(), builtBvh->isQuantized());
+    QCOMPARE(bvh->getQuantizedNodeArray().size(), builtBvh->getQuantizedNodeArray().size());
+    btAlignedFree(bvhBuffer);
+
+    // the shape built around the cached bvh collides like the original
+    const btCollisionShape* cachedShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(cachedShape != nullptr);
+    QCOMPARE(cachedShape->getShapeType(), (int)TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    btTransform identity;
+    identity.setIdentity();
+    btVector3 builtMin, builtMax, cachedMin, cachedMax;
+    builtShape->getAabb(identity, builtMin, builtMax);
+    cachedShape->getAabb(identity, cachedMin, cachedMax);
+    QCOMPARE(cachedMin, builtMin);
+    QCOMPARE(cachedMax, builtMax);
+
+    ShapeFactory::deleteShape(builtShape);
+    ShapeFactory::deleteShape(cachedShape);
+}
+
+void ShapeCacheTests::testChangedSourceIsMiss() {
+    QTemporaryDir dir;
+    auto cache = makeCache(dir);
+
+    ShapeInfo hullInfo = makeCompoundShapeInfo(2);
+    ShapeFactory::deleteShape(ShapeFactory::createShapeFromInfo(hullInfo, cache.get()));
+    ShapeInfo meshInfo = makeStaticMeshShapeInfo(4);
+    ShapeFactory::deleteShape(ShapeFactory::createShapeFromInfo(meshInfo, cache.get()));
+
+    // move one point by less than a millimeter: the ShapeInfo hashes still match but the entries must not be used
+    ShapeInfo changedHullInfo = makeCompoundShapeInfo(2);
+    changedHullInfo.getPointCollection()[1][0].x += 0.0005f;
+    QCOMPARE(changedHullInfo.getHash(), hullInfo.getHash());
+    std::vector<btConvexHullShape*> hulls;
+    QVERIFY(!cache->loadHulls(changedHullInfo, hulls));
+    QVERIFY(hulls.empty());
+
+    ShapeInfo changedMeshInfo = makeStaticMeshShapeInfo(4);
+    std::swap(changedMeshInfo.getTriangleIndices()[0], changedMeshInfo.getTriangleIndices()[1]);
+    QCOMPARE(changedMeshInfo.getHash(), meshInfo.getHash());
+    void* bvhBuffer = nullptr;
+    QVERIFY(cache->loadBvh(changedMeshInfo, bvhBuffer) == nullptr);
+    QVERIFY(bvhBuffer == nullptr);
+
+    // nor may an entry of one kind be read as the other
+    QVERIFY(cache->loadBvh(hullInfo, bvhBuffer) == nullptr);
+}
+
+void ShapeCacheTests::benchmarkStaticMesh_data() {
+    QTest::addColumn<bool>("cached");
+    QTest::newRow("built") << false;
+    QTest::newRow("cached") << true;
+}
+
+void ShapeCacheTests::benchmarkStaticMesh() {
+    QFETCH(bool, cached);
+    QTemporaryDir dir;
+    auto cache = makeCache(dir);
+    ShapeInfo info = makeStaticMeshShapeInfo(256);
+    if (cached) {
+        ShapeFactory::deleteShape(ShapeFactory::createShapeFromInfo(info, cache.get()));
+    }
+
+    QBENCHMARK {
+        const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info, cached ? cache.get() : nullptr);
+        ShapeFactory::deleteShape(shape);
+    }
+}
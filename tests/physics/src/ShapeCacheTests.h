@@ -0,0 +1,27 @@
+//
+//  ShapeCacheTests.h
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ShapeCacheTests_h
+#define hifi_ShapeCacheTests_h
+
+#include <QtTest/QtTest>
+
+class ShapeCacheTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testHullsRoundTrip();
+    void testBvhRoundTrip();
+    void testChangedSourceIsMiss();
+    void benchmarkStaticMesh_data();
+    void benchmarkStaticMesh();
+};
+
+#endif // hifi_ShapeCacheTests_h
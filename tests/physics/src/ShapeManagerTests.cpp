@@ -186,7 +186,8 @@ void ShapeManagerTests::addCapsuleShape() {
     */
 }
 
-void ShapeManagerTests::addCompoundShape() {
+// a compound of numHulls tetrahedral convex hulls strung out along the x-axis
+static ShapeInfo makeCompoundShapeInfo(int numHulls) {
     // initialize some points for generating tetrahedral convex hulls
     QVector<glm::vec3> tetrahedron;
     tetrahedron.push_back(glm::vec3(1.0f, 1.0f, 1.0f));
@@ -197,7 +198,6 @@ void ShapeManagerTests::addCompoundShape() {
 
     // compute the points of the hulls
     ShapeInfo::PointCollection pointCollection;
-    int numHulls = 5;
     glm::vec3 offsetNormal(1.0f, 0.0f, 0.0f);
     Extents extents;
     for (int i = 0; i < numHulls; ++i) {
@@ -217,6 +217,12 @@ void ShapeManagerTests::addCompoundShape() {
     glm::vec3 halfExtents = 0.5f * (extents.maximum - extents.minimum);
     info.setParams(SHAPE_TYPE_COMPOUND, halfExtents);
     info.setPointCollection(pointCollection);
+    return info;
+}
+
+void ShapeManagerTests::addCompoundShape() {
+    int numHulls = 5;
+    ShapeInfo info = makeCompoundShapeInfo(numHulls);
 
     // create the shape
     ShapeManager shapeManager;
@@ -244,3 +250,55 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::addDeferredCompoundShape() {
+    int numHulls = 32;
+    ShapeInfo info = makeCompoundShapeInfo(numHulls);
+    ShapeManager shapeManager;
+
+    // cheap shapes are still built immediately
+    ShapeInfo boxInfo;
+    boxInfo.setBox(glm::vec3(1.0f));
+    const btCollisionShape* box = shapeManager.getShapeDeferred(boxInfo);
+    QVERIFY(box != nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)0);
+
+    // hulls are handed to a worker
+    const btCollisionShape* shape = shapeManager.getShapeDeferred(info);
+    QVERIFY(shape == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)1);
+
+    // asking again while the worker is busy does not start another one
+    shape = shapeManager.getShapeDeferred(info);
+    QVERIFY(shape == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)2);
+
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+    QVERIFY(shapeManager.hasShapeWithKey(info.getHash()));
+    shape = shapeManager.getShapeByKey(info.getHash());
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+
+    // the hulls were built in parallel but keep the order of their point lists
+    const btCompoundShape* compoundShape = static_cast<const btCompoundShape*>(shape);
+    QCOMPARE(compoundShape->getNumChildShapes(), numHulls);
+    btVector3 center;
+    btScalar previousRadius = 0.0f;
+    for (int i = 0; i < numHulls; ++i) {
+        btScalar radius;
+        compoundShape->getChildShape(i)->getBoundingSphere(center, radius);
+        QVERIFY(radius > previousRadius);
+        previousRadius = radius;
+    }
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+    shapeManager.releaseShape(shape);
+    shapeManager.releaseShape(box);
+}
+
+void ShapeManagerTests::benchmarkCompoundShape() {
+    ShapeInfo info = makeCompoundShapeInfo(256);
+    QBENCHMARK {
+        const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+        ShapeFactory::deleteShape(shape);
+    }
+}
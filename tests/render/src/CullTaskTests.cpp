@@ -0,0 +1,219 @@
+//
+//  CullTaskTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CullTaskTests.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <render/CullTask.h>
+#include <render/SortTask.h>
+
+QTEST_MAIN(CullTaskTests)
+
+using namespace render;
+
+// a box of a given size standing in for an entity
+class TestItem {
+public:
+    using Pointer = std::shared_ptr<TestItem>;
+    using Payload = render::Payload<TestItem>;
+
+    TestItem(const AABox& bound) : _bound(bound) {}
+
+    AABox _bound;
+};
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const TestItem::Pointer& item) {
+        return ItemKey::Builder::opaqueShape();
+    }
+    template <> const Item::Bound payloadGetBound(const TestItem::Pointer& item) {
+        return item->_bound;
+    }
+}
+
+const int NUM_ITEMS_PER_SIDE = 317; // about 100k items
+const float ITEM_SPACING = 1.5f;
+const float TREE_SCALE = 16384.0f;
+
+static bool shouldRender(const RenderArgs* args, const AABox& bounds) {
+    // the same apparent size test as the LOD manager's
+    auto pos = args->getViewFrustum().getPosition() - bounds.calcCenter();
+    auto dim = bounds.getDimensions();
+    return 0.25f * glm::dot(dim, dim) >= args->_lodAngleHalfTanSq * glm::dot(pos, pos);
+}
+
+void CullTaskTests::initTestCase() {
+    _scene = std::make_shared<Scene>(glm::vec3(-0.5f * TREE_SCALE), TREE_SCALE);
+
+    // a field of items of many sizes around the origin, so that the tree sorts them into cells of every level
+    Transaction transaction;
+    float halfSide = 0.5f * (float)NUM_ITEMS_PER_SIDE * ITEM_SPACING;
+    for (int i = 0; i < NUM_ITEMS_PER_SIDE; ++i) {
+        for (int j = 0; j < NUM_ITEMS_PER_SIDE; ++j) {
+            float size = 0.02f + 0.05f * (float)((i * 31 + j * 17) % 40);
+            glm::vec3 corner((float)i * ITEM_SPACING - halfSide, 0.0f, (float)j * ITEM_SPACING - halfSide);
+            auto item = std::make_shared<TestItem>(AABox(corner, size));
+            transaction.resetItem(_scene->allocateID(), std::make_shared<TestItem::Payload>(item));
+        }
+    }
+    _scene->enqueueTransaction(transaction);
+    _scene->enqueueFrame();
+    _scene->processTransactionQueue();
+
+    // look across the field from one side
+    ViewFrustum viewFrustum;
+    viewFrustum.setPosition(glm::vec3(0.0f, 2.0f, halfSide));
+    viewFrustum.setOrientation(glm::quat());
+    viewFrustum.setProjection(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f));
+    viewFrustum.calculate();
+    _args.setViewFrustum(viewFrustum);
+    _args._scene = _scene;
+
+    _renderContext = std::make_shared<RenderContext>();
+    _renderContext->args = &_args;
+    _renderContext->_scene = _scene;
+}
+
+void CullTaskTests::cleanupTestCase() {
+    _renderContext.reset();
+    _args = RenderArgs();
+    _scene.reset();
+}
+
+ItemBounds CullTaskTests::cull(bool multithreaded, RenderDetails::Item& details) {
+    auto filter = ItemFilter::Builder::visibleWorldItems().withTypeShape().build();
+
+    ItemSpatialTree::ItemSelection selection;
+    FetchSpatialTree fetch;
+    fetch.configure(FetchSpatialTree::Config());
+    fetch.run(_renderContext, FetchSpatialTree::Inputs(filter, glm::ivec2(1920, 1080)), selection);
+
+    auto config = std::make_shared<CullSpatialSelection::Config>();
+    config->multithreaded = multithreaded;
+    CullSpatialSelection cullSelection(shouldRender, RenderDetails::ITEM);
+    cullSelection.configure(*config);
+
+    _args._details = RenderDetails();
+    _renderContext->jobConfig = config;
+    ItemBounds culledItems;
+    cullSelection.run(_renderContext, CullSpatialSelection::Inputs(selection, filter), culledItems);
+    _renderContext->jobConfig.reset();
+    details = _args._details._item;
+    return culledItems;
+}
+
+void CullTaskTests::testParallelCullMatchesSerial() {
+    RenderDetails::Item serialDetails;
+    ItemBounds serialItems = cull(false, serialDetails);
+    RenderDetails::Item parallelDetails;
+    ItemBounds parallelItems = cull(true, parallelDetails);
+
+    // some but not all of the field is in view and big enough
+    QVERIFY(serialItems.size() > 1000);
+    QVERIFY(serialItems.size() < (size_t)(NUM_ITEMS_PER_SIDE * NUM_ITEMS_PER_SIDE));
+    QVERIFY(serialDetails._outOfView > 0);
+    QVERIFY(serialDetails._tooSmall > 0);
+
+    // chunks are merged back in order, so the parallel cull keeps exactly the same items in the same order
+    QCOMPARE(parallelItems.size(), serialItems.size());
+    for (size_t i = 0; i < serialItems.size(); ++i) {
+        QCOMPARE(parallelItems[i].id, serialItems[i].id);
+    }
+    QCOMPARE(parallelDetails._considered, serialDetails._considered);
+    QCOMPARE(parallelDetails._outOfView, serialDetails._outOfView);
+    QCOMPARE(parallelDetails._tooSmall, serialDetails._tooSmall);
+    QCOMPARE(parallelDetails._rendered, serialDetails._rendered);
+}
+
+void CullTaskTests::testDepthSort() {
+    RenderDetails::Item details;
+    ItemBounds culledItems = cull(true, details);
+    QVERIFY(culledItems.size() > 4096); // large enough to be sorted on the worker threads
+
+    ItemBounds sortedItems;
+    AABox bounds;
+    depthSortItems(_renderContext, true, culledItems, sortedItems, &bounds);
+    QCOMPARE(sortedItems.size(), culledItems.size());
+
+    const ViewFrustum& frustum = _args.getViewFrustum();
+    float previousDistance = 0.0f;
+    for (const auto& item : sortedItems) {
+        float distance = frustum.distanceToCameraSquared(item.bound.calcCenter());
+        QVERIFY(distance >= previousDistance);
+        previousDistance = distance;
+        QVERIFY(bounds.contains(item.bound));
+    }
+
+    ItemBounds backToFrontItems;
+    depthSortItems(_renderContext, false, culledItems, backToFrontItems);
+    QCOMPARE(backToFrontItems.size(), culledItems.size());
+    QCOMPARE(frustum.distanceToCameraSquared(backToFrontItems.front().bound.calcCenter()), previousDistance);
+}
+
+// counts itself in the render details of the args it sees, and leaves a view frustum pushed on them
+class CountJob {
+public:
+    using JobModel = Job::Model<CountJob>;
+
+    void run(const RenderContextPointer& renderContext) {
+        auto args = renderContext->args;
+        args->pushViewFrustum(args->getViewFrustum());
+        args->_details._item._considered++;
+    }
+};
+
+class ConcurrentCountTask {
+public:
+    using JobModel = Task::ConcurrentModel<ConcurrentCountTask>;
+
+    void build(JobModel& task, const Varying& inputs, Varying& outputs, int numJobs) {
+        for (int i = 0; i < numJobs; ++i) {
+            task.addJob<CountJob>("Count" + std::to_string(i));
+        }
+    }
+};
+
+void CullTaskTests::testConcurrentTask() {
+    const int NUM_JOBS = 16;
+    Task concurrentTask(ConcurrentCountTask::JobModel::create("ConcurrentCount", NUM_JOBS));
+
+    _args._details = RenderDetails();
+    size_t numViewFrustums = _args._viewFrustums.size();
+    concurrentTask.run(_renderContext);
+
+    // every job ran on its own args, whose details were summed back into ours
+    QCOMPARE(_renderContext->args, &_args);
+    QCOMPARE(_args._details._item._considered, NUM_JOBS);
+    QCOMPARE(_args._viewFrustums.size(), numViewFrustums);
+}
+
+void CullTaskTests::benchmarkCullSpatialSelection_data() {
+    QTest::addColumn<bool>("multithreaded");
+    QTest::newRow("serial") << false;
+    QTest::newRow("parallel") << true;
+}
+
+void CullTaskTests::benchmarkCullSpatialSelection() {
+    QFETCH(bool, multithreaded);
+    RenderDetails::Item details;
+    QBENCHMARK {
+        cull(multithreaded, details);
+    }
+}
+
+void CullTaskTests::benchmarkDepthSort() {
+    RenderDetails::Item details;
+    ItemBounds culledItems = cull(true, details);
+    ItemBounds sortedItems;
+    QBENCHMARK {
+        depthSortItems(_renderContext, true, culledItems, sortedItems);
+    }
+}
@@ -0,0 +1,40 @@
+//
+//  CullTaskTests.h
+//  tests/render/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CullTaskTests_h
+#define hifi_CullTaskTests_h
+
+#include <QtTest/QtTest>
+
+#include <render/Engine.h>
+
+class CullTaskTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void testParallelCullMatchesSerial();
+    void testDepthSort();
+    void testConcurrentTask();
+    void benchmarkCullSpatialSelection_data();
+    void benchmarkCullSpatialSelection();
+    void benchmarkDepthSort();
+
+private:
+    render::ItemBounds cull(bool multithreaded, render::RenderDetails::Item& details);
+
+    render::ScenePointer _scene;
+    RenderArgs _args;
+    render::RenderContextPointer _renderContext;
+};
+
+#endif // hifi_CullTaskTests_h
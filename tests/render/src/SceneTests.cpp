@@ -0,0 +1,268 @@
+//
+//  SceneTests.cpp
+//  tests/render/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SceneTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <render/Scene.h>
+
+QTEST_MAIN(SceneTests)
+
+using namespace render;
+
+// a box that remembers the updates it went through
+class SceneTestItem {
+public:
+    using Pointer = std::shared_ptr<SceneTestItem>;
+    using Payload = render::Payload<SceneTestItem>;
+
+    SceneTestItem(const AABox& bound) : _bound(bound) {}
+
+    AABox _bound;
+    std::vector<int> _updates;
+};
+
+namespace render {
+    template <> const ItemKey payloadGetKey(const SceneTestItem::Pointer& item) {
+        return ItemKey::Builder::opaqueShape();
+    }
+    template <> const Item::Bound payloadGetBound(const SceneTestItem::Pointer& item) {
+        return item->_bound;
+    }
+}
+
+const float TREE_SCALE = 16384.0f;
+
+static ScenePointer makeScene(size_t numItems, ItemIDs& ids, std::vector<SceneTestItem::Pointer>& items) {
+    auto scene = std::make_shared<Scene>(glm::vec3(-0.5f * TREE_SCALE), TREE_SCALE);
+    Transaction transaction;
+    for (size_t i = 0; i < numItems; ++i) {
+        auto item = std::make_shared<SceneTestItem>(AABox(glm::vec3((float)i, 0.0f, 0.0f), 1.0f));
+        auto id = scene->allocateID();
+        transaction.resetItem(id, std::make_shared<SceneTestItem::Payload>(item));
+        ids.push_back(id);
+        items.push_back(item);
+    }
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+    return scene;
+}
+
+// moves and resizes an item, so that it changes cell and sometimes level in the tree
+static void addMoves(Transaction& transaction, ItemID id, size_t index, int numMoves, bool parallel) {
+    for (int move = 1; move <= numMoves; ++move) {
+        std::function<void(SceneTestItem&)> func = [index, move](SceneTestItem& item) {
+            float size = 0.1f + (float)((index * 7 + move * 13) % 50);
+            item._bound = AABox(glm::vec3((float)index, (float)(move * 10), -(float)index), size);
+            item._updates.push_back(move);
+        };
+        if (parallel) {
+            transaction.updateItemParallel<SceneTestItem>(id, func);
+        } else {
+            transaction.updateItem<SceneTestItem>(id, func);
+        }
+    }
+}
+
+void SceneTests::testUpdatesCoalescedPerItem() {
+    ItemIDs ids;
+    std::vector<SceneTestItem::Pointer> items;
+    auto scene = makeScene(4, ids, items);
+
+    auto log = [](int value) {
+        return [value](SceneTestItem& item) { item._updates.push_back(value); };
+    };
+    Transaction first;
+    first.updateItem<SceneTestItem>(ids[0], log(1));
+    first.updateItem<SceneTestItem>(ids[1], log(1));
+    first.updateItem<SceneTestItem>(ids[0], log(2));
+    first.updateItem(Item::INVALID_ITEM_ID);
+    Transaction second;
+    second.updateItem<SceneTestItem>(ids[0], log(3));
+    second.updateItem<SceneTestItem>(ids[1], log(2));
+    scene->enqueueTransaction(first);
+    scene->enqueueTransaction(second);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    // every update applied, in the order it was enqueued
+    QCOMPARE(items[0]->_updates, std::vector<int>({ 1, 2, 3 }));
+    QCOMPARE(items[1]->_updates, std::vector<int>({ 1, 2 }));
+    QVERIFY(items[2]->_updates.empty());
+
+    auto stats = scene->getTransactionStats();
+    QCOMPARE(stats.numFrames, 1u);
+    QCOMPARE(stats.numTransactions, 2u);
+    QCOMPARE(stats.numUpdates, 6u);
+    QCOMPARE(stats.numUpdatedItems, 2u);
+    QCOMPARE(stats.numResets, 0u);
+}
+
+void SceneTests::testConcurrentEnqueue() {
+    const int NUM_THREADS = 8;
+    const int NUM_TRANSACTIONS_PER_THREAD = 2000;
+
+    auto scene = std::make_shared<Scene>(glm::vec3(-0.5f * TREE_SCALE), TREE_SCALE);
+    std::vector<SceneTestItem::Pointer> items(NUM_THREADS * NUM_TRANSACTIONS_PER_THREAD);
+    std::vector<ItemID> ids(items.size());
+
+    // the frames are closed and processed while the producers are still enqueueing
+    std::atomic<int> numRunning { NUM_THREADS };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < NUM_TRANSACTIONS_PER_THREAD; ++i) {
+                size_t index = t * NUM_TRANSACTIONS_PER_THREAD + i;
+                items[index] = std::make_shared<SceneTestItem>(AABox(glm::vec3((float)index, 0.0f, 0.0f), 1.0f));
+                ids[index] = scene->allocateID();
+
+                Transaction transaction;
+                transaction.resetItem(ids[index], std::make_shared<SceneTestItem::Payload>(items[index]));
+                addMoves(transaction, ids[index], index, 2);
+                scene->enqueueTransaction(std::move(transaction));
+            }
+            --numRunning;
+        });
+    }
+
+    uint32_t numTransactions = 0;
+    uint32_t numResets = 0;
+    uint32_t numUpdates = 0;
+    bool done = false;
+    while (!done) {
+        done = (numRunning == 0);
+        scene->enqueueFrame();
+        scene->processTransactionQueue();
+        auto stats = scene->getTransactionStats();
+        numTransactions += stats.numTransactions;
+        numResets += stats.numResets;
+        numUpdates += stats.numUpdates;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    QCOMPARE(numTransactions, (uint32_t)items.size());
+    QCOMPARE(numResets, (uint32_t)items.size());
+    QCOMPARE(numUpdates, 2 * (uint32_t)items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        QVERIFY(scene->getItem(ids[i]).exist());
+        QCOMPARE(items[i]->_updates, std::vector<int>({ 1, 2 }));
+    }
+}
+
+void SceneTests::testParallelUpdatesMatchSerial() {
+    const size_t NUM_ITEMS = 5000;
+
+    ItemIDs serialIDs, parallelIDs;
+    std::vector<SceneTestItem::Pointer> serialItems, parallelItems;
+    auto serialScene = makeScene(NUM_ITEMS, serialIDs, serialItems);
+    auto parallelScene = makeScene(NUM_ITEMS, parallelIDs, parallelItems);
+    serialScene->setParallelUpdatesEnabled(false);
+    parallelScene->setParallelUpdatesEnabled(true);
+
+    // a few moves per item, interleaved between the items
+    for (int round = 0; round < 2; ++round) {
+        Transaction serialTransaction, parallelTransaction;
+        for (size_t i = 0; i < NUM_ITEMS; ++i) {
+            int numMoves = 1 + (int)((i + round) % 3);
+            addMoves(serialTransaction, serialIDs[i], i + round, numMoves, false);
+            addMoves(parallelTransaction, parallelIDs[i], i + round, numMoves, true);
+        }
+        serialScene->enqueueTransaction(serialTransaction);
+        parallelScene->enqueueTransaction(parallelTransaction);
+        serialScene->enqueueFrame();
+        parallelScene->enqueueFrame();
+        serialScene->processTransactionQueue();
+        parallelScene->processTransactionQueue();
+        QCOMPARE(parallelScene->getTransactionStats().numUpdatedItems, (uint32_t)NUM_ITEMS);
+    }
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i) {
+        const auto& serialItem = serialScene->getItem(serialIDs[i]);
+        const auto& parallelItem = parallelScene->getItem(parallelIDs[i]);
+        QCOMPARE(parallelItem.getCell(), serialItem.getCell());
+        QCOMPARE(parallelItem.getKey()._flags, serialItem.getKey()._flags);
+        QCOMPARE(parallelItems[i]->_updates, serialItems[i]->_updates);
+    }
+}
+
+void SceneTests::testUpdatesAreSerialByDefault() {
+    const size_t NUM_ITEMS = 5000;
+
+    ItemIDs ids;
+    std::vector<SceneTestItem::Pointer> items;
+    auto scene = makeScene(NUM_ITEMS, ids, items);
+    scene->setParallelUpdatesEnabled(true);
+
+    // a functor that isn't reentrant, like the ones touching state shared between entities, and one item that opted in
+    int numUpdates = 0;
+    std::atomic<int> numRunning { 0 };
+    std::atomic<bool> overlapped { false };
+    std::atomic<bool> leftThread { false };
+    auto callingThread = std::this_thread::get_id();
+    Transaction transaction;
+    for (size_t i = 0; i < NUM_ITEMS; ++i) {
+        transaction.updateItem<SceneTestItem>(ids[i], [&](SceneTestItem& item) {
+            if (++numRunning > 1) {
+                overlapped = true;
+            }
+            if (std::this_thread::get_id() != callingThread) {
+                leftThread = true;
+            }
+            ++numUpdates;
+            --numRunning;
+        });
+    }
+    addMoves(transaction, ids[0], 0, 1, true);
+    scene->enqueueTransaction(transaction);
+    scene->enqueueFrame();
+    scene->processTransactionQueue();
+
+    QVERIFY(!overlapped);
+    QVERIFY(!leftThread);
+    QCOMPARE(numUpdates, (int)NUM_ITEMS);
+    QCOMPARE(items[0]->_updates, std::vector<int>({ 1 }));
+}
+
+void SceneTests::benchmarkApplyUpdates_data() {
+    QTest::addColumn<bool>("parallel");
+    QTest::newRow("serial") << false;
+    QTest::newRow("parallel") << true;
+}
+
+void SceneTests::benchmarkApplyUpdates() {
+    QFETCH(bool, parallel);
+    const size_t NUM_ITEMS = 100000;
+
+    ItemIDs ids;
+    std::vector<SceneTestItem::Pointer> items;
+    auto scene = makeScene(NUM_ITEMS, ids, items);
+    scene->setParallelUpdatesEnabled(parallel);
+
+    // the per frame flood of entity updates, two per item
+    Transaction transaction;
+    for (size_t i = 0; i < NUM_ITEMS; ++i) {
+        for (int move = 1; move <= 2; ++move) {
+            transaction.updateItemParallel<SceneTestItem>(ids[i], [i, move](SceneTestItem& item) {
+                item._bound = AABox(glm::vec3((float)i, (float)(move * 10), 0.0f), 1.0f);
+            });
+        }
+    }
+
+    QBENCHMARK {
+        scene->enqueueTransaction(transaction);
+        scene->enqueueFrame();
+        scene->processTransactionQueue();
+    }
+}
@@ -0,0 +1,28 @@
+//
+//  SceneTests.h
+//  tests/render/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SceneTests_h
+#define hifi_SceneTests_h
+
+#include <QtTest/QtTest>
+
+class SceneTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testUpdatesCoalescedPerItem();
+    void testConcurrentEnqueue();
+    void testParallelUpdatesMatchSerial();
+    void testUpdatesAreSerialByDefault();
+    void benchmarkApplyUpdates_data();
+    void benchmarkApplyUpdates();
+};
+
+#endif // hifi_SceneTests_h
@@ -156,6 +156,61 @@ void FileCacheTests::testWipe() {
     QCOMPARE(getCacheDirectorySize(), (size_t)0);
 }
 
+void FileCacheTests::testWriteInPlace() {
+    QDir dir(_testDir.path());
+    QVERIFY(dir.mkpath("inPlace"));
+    auto cache = makeFileCache(dir.absoluteFilePath("inPlace"));
+
+    // The writer only fills in the start of the file, the rest must read back as zeroes
+    static const size_t WRITTEN_SIZE { 16 };
+    auto file = cache->writeFile([&](uint8_t* data, size_t size) {
+        if (size != (size_t)TEST_DATA.size()) {
+            return false;
+        }
+        memset(data, 'x', WRITTEN_SIZE);
+        return true;
+    }, FileCache::Metadata(getFileKey(0), TEST_DATA.size()));
+    QVERIFY(file.get());
+    QVERIFY(file->_locked);
+
+    QFile written(QString::fromStdString(file->getFilepath()));
+    QVERIFY(written.open(QIODevice::ReadOnly));
+    auto content = written.readAll();
+    QCOMPARE(content.size(), TEST_DATA.size());
+    QCOMPARE(content.left(WRITTEN_SIZE), QByteArray(WRITTEN_SIZE, 'x'));
+    QCOMPARE(content.mid(WRITTEN_SIZE), QByteArray(TEST_DATA.size() - WRITTEN_SIZE, '\0'));
+
+    // A failed write leaves neither an entry nor a file behind
+    file = cache->writeFile([](uint8_t* data, size_t size) {
+        return false;
+    }, FileCache::Metadata(getFileKey(1), TEST_DATA.size()));
+    QVERIFY(!file);
+    QVERIFY(!cache->getFile(getFileKey(1)));
+    QCOMPARE(QDir(dir.absoluteFilePath("inPlace")).entryList(QDir::Files).size(), 1);
+}
+
+void FileCacheTests::testRemoveFile() {
+    QDir dir(_testDir.path());
+    QVERIFY(dir.mkpath("remove"));
+    auto cache = makeFileCache(dir.absoluteFilePath("remove"));
+
+    auto stale = cache->writeFile(TEST_DATA.data(), FileCache::Metadata(getFileKey(0), TEST_DATA.size()));
+    QVERIFY(stale.get());
+    cache->removeFile(getFileKey(0));
+    QVERIFY(!cache->getFile(getFileKey(0)));
+    QVERIFY(!QFile::exists(QString::fromStdString(stale->getFilepath())));
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)0);
+
+    // The replacement takes over the path, and releasing the removed entry must leave it alone
+    static const QByteArray REPLACEMENT_DATA { 1024, '1' };
+    auto replacement = cache->writeFile(REPLACEMENT_DATA.data(), FileCache::Metadata(getFileKey(0), REPLACEMENT_DATA.size()));
+    QVERIFY(replacement.get());
+    stale.reset();
+    QFile written(QString::fromStdString(replacement->getFilepath()));
+    QVERIFY(written.open(QIODevice::ReadOnly));
+    QCOMPARE(written.readAll(), REPLACEMENT_DATA);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)1);
+}
 
 void FileCacheTests::cleanupTestCase() {
 }
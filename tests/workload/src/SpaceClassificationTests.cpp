@@ -0,0 +1,212 @@
+//
+//  SpaceClassificationTests.cpp
+//  tests/workload/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpaceClassificationTests.h"
+
+#include <random>
+#include <set>
+
+#include <glm/gtx/norm.hpp>
+
+#include <workload/Space.h>
+
+QTEST_MAIN(SpaceClassificationTests)
+
+using namespace workload;
+
+const float DOMAIN_SIZE = 1000.0f;
+
+static Sphere randomSphere(std::mt19937& generator) {
+    std::uniform_real_distribution<float> position(-0.5f * DOMAIN_SIZE, 0.5f * DOMAIN_SIZE);
+    std::uniform_real_distribution<float> radius(0.5f, 5.0f);
+    // a few zone-like proxies, larger than a grid cell
+    bool large = (generator() % 100) == 0;
+    return Sphere(position(generator), position(generator), position(generator), large ? 50.0f : radius(generator));
+}
+
+static View makeView(const glm::vec3& center) {
+    View view;
+    view.origin = center;
+    view.regions[Region::R1] = Sphere(center, 20.0f);
+    view.regions[Region::R2] = Sphere(center, 60.0f);
+    view.regions[Region::R3] = Sphere(center, 150.0f);
+    return view;
+}
+
+static void addProxies(Space& space, size_t numProxies, std::mt19937& generator, std::vector<ProxyID>& ids) {
+    Transaction transaction;
+    for (size_t i = 0; i < numProxies; ++i) {
+        auto id = space.allocateID();
+        transaction.reset(id, randomSphere(generator), Owner());
+        ids.push_back(id);
+    }
+    space.enqueueTransaction(transaction);
+}
+
+static void moveProxies(Space& space, size_t numMoves, std::mt19937& generator, const std::vector<ProxyID>& ids) {
+    Transaction transaction;
+    for (size_t i = 0; i < numMoves; ++i) {
+        transaction.update(ids[generator() % ids.size()], randomSphere(generator));
+    }
+    space.enqueueTransaction(transaction);
+}
+
+static Changes runFrame(Space& space, const Views& views) {
+    space.enqueueFrame();
+    space.processTransactionQueue();
+    space.setViews(views);
+    Changes changes;
+    space.categorizeAndGetChanges(changes);
+    return changes;
+}
+
+// the region every proxy would get from classifying them all from scratch
+static std::vector<uint8_t> classifyAll(const Space& space, const Views& views) {
+    Proxy::Vector proxies(space.getNumAllocatedProxies());
+    space.copyProxyValues(proxies.data(), (uint32_t)proxies.size());
+    std::vector<uint8_t> regions(proxies.size(), Region::INVALID);
+    for (size_t i = 0; i < proxies.size(); ++i) {
+        if (proxies[i].region >= Region::INVALID) {
+            continue;
+        }
+        uint8_t region = Region::R4;
+        for (const auto& view : views) {
+            for (uint8_t k = 0; k < region; ++k) {
+                float touchDistance = proxies[i].sphere.w + view.regions[k].w;
+                if (glm::distance2(glm::vec3(proxies[i].sphere), glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                    region = k;
+                    break;
+                }
+            }
+        }
+        regions[i] = region;
+    }
+    return regions;
+}
+
+void SpaceClassificationTests::testProxyGridSelection() {
+    std::mt19937 generator(7);
+    ProxyGrid grid;
+    std::vector<Sphere> spheres;
+    for (ProxyID id = 0; id < 5000; ++id) {
+        spheres.push_back(randomSphere(generator));
+        grid.reset(id, spheres.back());
+    }
+    // move some, drop some
+    for (ProxyID id = 0; id < 5000; id += 7) {
+        spheres[id] = randomSphere(generator);
+        grid.reset(id, spheres[id]);
+    }
+    for (ProxyID id = 3; id < 5000; id += 11) {
+        grid.remove(id);
+        spheres[id].w = -1.0f;
+    }
+
+    // small and huge query spheres take the two lookup paths
+    for (float queryRadius : { 10.0f, 100.0f, 10000.0f }) {
+        Sphere query(randomSphere(generator));
+        query.w = queryRadius;
+        IndexVector selected;
+        grid.selectProxies(query, selected);
+        std::set<ProxyID> selectedSet(selected.begin(), selected.end());
+        QCOMPARE(selectedSet.size(), selected.size());
+        for (ProxyID id = 0; id < (ProxyID)spheres.size(); ++id) {
+            const auto& sphere = spheres[id];
+            bool removed = sphere.w < 0.0f;
+            bool touches = glm::distance(glm::vec3(sphere), glm::vec3(query)) < sphere.w + query.w;
+            QVERIFY(!removed || selectedSet.count(id) == 0);
+            QVERIFY(removed || !touches || selectedSet.count(id) == 1);
+        }
+    }
+}
+
+void SpaceClassificationTests::testIncrementalMatchesFull() {
+    std::mt19937 generator(11);
+    Space space;
+    std::vector<ProxyID> ids;
+    addProxies(space, 20000, generator, ids);
+
+    Views views { makeView(glm::vec3(0.0f)), makeView(glm::vec3(30.0f, 0.0f, 0.0f)) };
+    std::vector<uint8_t> previousRegions;
+    for (int frame = 0; frame < 20; ++frame) {
+        // the avatar walks along, and some entities fly around
+        if (frame % 3 == 0) {
+            views[0] = makeView(glm::vec3(10.0f * frame, 0.0f, 0.0f));
+        }
+        moveProxies(space, 200, generator, ids);
+        if (frame == 10) {
+            Transaction transaction;
+            transaction.remove(ids[0]);
+            space.enqueueTransaction(transaction);
+        }
+        auto changes = runFrame(space, views);
+
+        Proxy::Vector proxies(space.getNumAllocatedProxies());
+        space.copyProxyValues(proxies.data(), (uint32_t)proxies.size());
+        auto regions = classifyAll(space, views);
+        size_t numChanges = 0;
+        for (size_t i = 0; i < regions.size(); ++i) {
+            QCOMPARE(proxies[i].region, regions[i]);
+            if (frame > 0 && regions[i] < Region::INVALID && previousRegions[i] != regions[i]) {
+                ++numChanges;
+            }
+        }
+        if (frame > 0) {
+            // every change reported once, in proxy order
+            QCOMPARE(changes.size(), numChanges);
+            for (size_t c = 1; c < changes.size(); ++c) {
+                QVERIFY(changes[c - 1].proxyId < changes[c].proxyId);
+            }
+        }
+        for (const auto& change : changes) {
+            QCOMPARE(change.region, regions[change.proxyId]);
+        }
+        previousRegions = regions;
+    }
+}
+
+void SpaceClassificationTests::testSmallViewChangeReclassifiesNothing() {
+    std::mt19937 generator(13);
+    Space space;
+    std::vector<ProxyID> ids;
+    addProxies(space, 5000, generator, ids);
+
+    Views views { makeView(glm::vec3(0.0f)) };
+    runFrame(space, views);
+    QVERIFY(space.getNumClassifiedProxies() >= space.getNumAllocatedProxies());
+
+    // a centimeter is well within the region tolerance
+    views[0] = makeView(glm::vec3(0.01f, 0.0f, 0.0f));
+    auto changes = runFrame(space, views);
+    QCOMPARE(space.getNumClassifiedProxies(), 0u);
+    QVERIFY(changes.empty());
+
+    // a moved proxy is still reclassified
+    moveProxies(space, 1, generator, ids);
+    runFrame(space, views);
+    QCOMPARE(space.getNumClassifiedProxies(), 1u);
+}
+
+void SpaceClassificationTests::benchmarkClassification() {
+    std::mt19937 generator(17);
+    Space space;
+    std::vector<ProxyID> ids;
+    addProxies(space, 100000, generator, ids);
+    Views views { makeView(glm::vec3(0.0f)), makeView(glm::vec3(30.0f, 0.0f, 0.0f)) };
+    runFrame(space, views);
+
+    // a typical frame: a walking avatar and a busy domain
+    int frame = 0;
+    QBENCHMARK {
+        views[0] = makeView(glm::vec3(0.5f * (float)(++frame), 0.0f, 0.0f));
+        moveProxies(space, 1000, generator, ids);
+        runFrame(space, views);
+    }
+}
@@ -0,0 +1,248 @@
+//
+//  ICELoadTestApp.cpp
+//  tools/ice-load-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ICELoadTestApp.h"
+
+#include <openssl/bn.h>
+#include <openssl/err.h>
+#include <openssl/x509.h>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QRegExp>
+
+#include <HTTPConnection.h>
+#include <NetworkLogging.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <UUID.h>
+#include <udt/PacketHeaders.h>
+
+const quint16 DEFAULT_API_PORT = 40180;
+const int SEND_INTERVAL_MSECS = 10;
+
+ICELoadTestApp::ICELoadTestApp(int argc, char* argv[]) :
+    QCoreApplication(argc, argv)
+{
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity ICE server load test\n\n"
+        "Run the ice-server with HIFI_METAVERSE_URL=http://127.0.0.1:<api-port> so that it accepts the simulated domains.");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption iceServerAddressOption("i", "ice-server address", "IP:PORT", "127.0.0.1");
+    parser.addOption(iceServerAddressOption);
+
+    const QCommandLineOption numDomainsOption("n", "number of simulated domains", "domains", "10000");
+    parser.addOption(numDomainsOption);
+
+    const QCommandLineOption intervalOption("interval", "heartbeat interval per domain", "msecs", "1000");
+    parser.addOption(intervalOption);
+
+    const QCommandLineOption variantsOption("variants",
+        "signed heartbeats per domain, sent in turn - 1 re-sends identical heartbeats that the ice-server verifies from its cache",
+        "count", "2");
+    parser.addOption(variantsOption);
+
+    const QCommandLineOption durationOption("duration", "seconds to run for, 0 to run until killed", "secs", "0");
+    parser.addOption(durationOption);
+
+    const QCommandLineOption apiPortOption("api-port", "port for the stub metaverse API", "port",
+                                           QString::number(DEFAULT_API_PORT));
+    parser.addOption(apiPortOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << endl;
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    const_cast<QLoggingCategory*>(&networking())->setEnabled(QtDebugMsg, false);
+
+    _numDomains = std::max(1, parser.value(numDomainsOption).toInt());
+    _heartbeatIntervalMsecs = std::max(1, parser.value(intervalOption).toInt());
+    _durationSecs = parser.value(durationOption).toInt();
+    _numVariants = std::max(1, parser.value(variantsOption).toInt());
+
+    QString hostnamePortString = parser.value(iceServerAddressOption);
+    int colonIndex = hostnamePortString.indexOf(':');
+    QHostAddress address { hostnamePortString.left(colonIndex) };
+    quint16 port = colonIndex >= 0 ? (quint16)hostnamePortString.mid(colonIndex + 1).toUInt() : 0;
+    if (port == 0) {
+        port = ICE_SERVER_DEFAULT_PORT;
+    }
+    _iceServerSockAddr = HifiSockAddr(address, port);
+
+    if (!generateKeypair()) {
+        QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+        return;
+    }
+
+    quint16 apiPort = (quint16)parser.value(apiPortOption).toUInt();
+    _apiServer.reset(new HTTPManager(QHostAddress::LocalHost, apiPort, QString(), this));
+
+    _socket.reset(new udt::Socket());
+    _socket->bind(QHostAddress::AnyIPv4, 0);
+    _socket->setPacketHandler([this](std::unique_ptr<udt::Packet> packet) { processPacket(std::move(packet)); });
+
+    qDebug() << "Signing" << _numVariants << "heartbeats for each of" << _numDomains << "domains";
+    createHeartbeats();
+
+    qDebug() << "Heartbeating" << _numDomains << "domains every" << _heartbeatIntervalMsecs << "ms against" << _iceServerSockAddr
+        << "- serving public keys on port" << apiPort;
+    qDebug() << "The ice-server logs how many of these heartbeats it verified and how many it took from its cache";
+
+    _startTime = _lastSendTime = usecTimestampNow();
+    connect(&_sendTimer, &QTimer::timeout, this, &ICELoadTestApp::sendHeartbeats);
+    _sendTimer.start(SEND_INTERVAL_MSECS);
+    connect(&_statsTimer, &QTimer::timeout, this, &ICELoadTestApp::printStats);
+    _statsTimer.start(MSECS_PER_SECOND);
+}
+
+bool ICELoadTestApp::generateKeypair() {
+    _keypair.reset(RSA_new());
+    BIGNUM* exponent = BN_new();
+    const unsigned long RSA_KEY_EXPONENT = 65537;
+    BN_set_word(exponent, RSA_KEY_EXPONENT);
+
+    // the same size as the keys domain-servers generate
+    const int RSA_KEY_BITS = 2048;
+    bool generated = RSA_generate_key_ex(_keypair.get(), RSA_KEY_BITS, exponent, NULL);
+    BN_free(exponent);
+    if (!generated) {
+        qCritical() << "Error generating RSA keypair -" << ERR_get_error();
+        return false;
+    }
+
+    unsigned char* publicKeyDER = NULL;
+    int publicKeyLength = i2d_RSA_PUBKEY(_keypair.get(), &publicKeyDER);
+    if (publicKeyLength <= 0) {
+        qCritical() << "Error getting DER public key from RSA struct -" << ERR_get_error();
+        return false;
+    }
+    _publicKey = QByteArray { reinterpret_cast<char*>(publicKeyDER), publicKeyLength };
+    OPENSSL_free(publicKeyDER);
+    return true;
+}
+
+void ICELoadTestApp::createHeartbeats() {
+    HifiSockAddr publicSockAddr(QHostAddress::LocalHost, _socket->localPort());
+
+    std::vector<QUuid> domainIDs(_numDomains);
+    for (auto& domainID : domainIDs) {
+        domainID = QUuid::createUuid();
+    }
+
+    // the ice-server only remembers the last heartbeat it verified for a domain, so a domain that sends its variants
+    // in turn never repeats that heartbeat and every one of them costs an RSA verification
+    _heartbeats.reserve(_numVariants * _numDomains);
+    for (int variant = 0; variant < _numVariants; ++variant) {
+        // the variants differ in the local socket port, the ice-server only hands it out to peers that connect
+        HifiSockAddr localSockAddr(QHostAddress::LocalHost, (quint16)(_socket->localPort() + variant));
+
+        for (const auto& domainID : domainIDs) {
+            _heartbeats.push_back(createHeartbeat(domainID, publicSockAddr, localSockAddr));
+        }
+    }
+}
+
+std::unique_ptr<NLPacket> ICELoadTestApp::createHeartbeat(const QUuid& domainID, const HifiSockAddr& publicSockAddr,
+                                                          const HifiSockAddr& localSockAddr) {
+    auto heartbeat = NLPacket::create(PacketType::ICEServerHeartbeat);
+
+    // write the plaintext the same way a domain-server does, then sign it
+    QDataStream heartbeatDataStream(heartbeat.get());
+    heartbeatDataStream << domainID << publicSockAddr << localSockAddr;
+
+    auto plaintext = QByteArray::fromRawData(heartbeat->getPayload(), heartbeat->getPayloadSize());
+    QByteArray hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
+
+    QByteArray signature(RSA_size(_keypair.get()), 0);
+    unsigned int signatureBytes = 0;
+    RSA_sign(NID_sha256, reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()), hashedPlaintext.size(),
+             reinterpret_cast<unsigned char*>(signature.data()), &signatureBytes, _keypair.get());
+    signature.resize(signatureBytes);
+
+    heartbeatDataStream << signature;
+    return heartbeat;
+}
+
+bool ICELoadTestApp::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
+    // the stub of /api/v1/domains/<domain-id>/public_key, every simulated domain shares the same key
+    const QString PUBLIC_KEY_PATH_REGEX_STRING = "^/api/v1/domains/([^/]+)/public_key$";
+    QRegExp publicKeyPathRegex { PUBLIC_KEY_PATH_REGEX_STRING };
+    if (publicKeyPathRegex.indexIn(url.path()) == -1) {
+        connection->respond(HTTPConnection::StatusCode404);
+        return true;
+    }
+
+    ++_numPublicKeyRequests;
+
+    QJsonObject dataObject;
+    dataObject["public_key"] = QString::fromUtf8(_publicKey.toBase64());
+    QJsonObject responseObject;
+    responseObject["status"] = "success";
+    responseObject["data"] = dataObject;
+
+    connection->respond(HTTPConnection::StatusCode200, QJsonDocument(responseObject).toJson(), "application/json");
+    return true;
+}
+
+void ICELoadTestApp::sendHeartbeats() {
+    if (_durationSecs > 0 && usecTimestampNow() - _startTime > (quint64)_durationSecs * USECS_PER_SECOND) {
+        printStats();
+        quit();
+        return;
+    }
+
+    // spread the heartbeats evenly, each domain heartbeats once per interval
+    quint64 now = usecTimestampNow();
+    _heartbeatsOwed += (double)(now - _lastSendTime) * _numDomains / (_heartbeatIntervalMsecs * USECS_PER_MSEC);
+    _lastSendTime = now;
+
+    while (_heartbeatsOwed >= 1.0) {
+        _socket->writePacket(*_heartbeats[_nextHeartbeat], _iceServerSockAddr);
+        _nextHeartbeat = (_nextHeartbeat + 1) % _heartbeats.size();
+        _heartbeatsOwed -= 1.0;
+        ++_numSent;
+    }
+}
+
+void ICELoadTestApp::processPacket(std::unique_ptr<udt::Packet> packet) {
+    auto nlPacket = NLPacket::fromBase(std::move(packet));
+    if (nlPacket->getType() == PacketType::ICEServerHeartbeatACK) {
+        ++_numAcked;
+    } else if (nlPacket->getType() == PacketType::ICEServerHeartbeatDenied) {
+        ++_numDenied;
+    }
+}
+
+void ICELoadTestApp::printStats() {
+    // one line per second, in a form that is easy to pull into a spreadsheet
+    static quint64 lastSent = 0, lastAcked = 0, lastDenied = 0;
+    qDebug().noquote() << QString("sent/s: %1 acked/s: %2 denied/s: %3 unanswered: %4 key requests: %5")
+        .arg(_numSent - lastSent)
+        .arg(_numAcked - lastAcked)
+        .arg(_numDenied - lastDenied)
+        .arg((qint64)_numSent - (qint64)(_numAcked + _numDenied))
+        .arg(_numPublicKeyRequests);
+    lastSent = _numSent;
+    lastAcked = _numAcked;
+    lastDenied = _numDenied;
+}
@@ -0,0 +1,79 @@
+//
+//  ICELoadTestApp.h
+//  tools/ice-load-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ICELoadTestApp_h
+#define hifi_ICELoadTestApp_h
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTimer>
+
+#include <openssl/rsa.h>
+
+#include <HTTPManager.h>
+#include <NLPacket.h>
+#include <udt/Socket.h>
+
+// Simulates many domain-servers heartbeating against a local ice-server.
+//
+// Every simulated domain signs its heartbeat with the same keypair, and this app serves that public key
+// from a stub of the metaverse API public key endpoint. Run the ice-server with
+// HIFI_METAVERSE_URL=http://127.0.0.1:<api-port> so that it fetches the keys from here.
+//
+// Each domain sends several differently signed heartbeats in turn so that the ice-server verifies every one of
+// them, the ice-server logs how many heartbeats it verified and how many it answered from its cache.
+class ICELoadTestApp : public QCoreApplication, public HTTPRequestHandler {
+    Q_OBJECT
+public:
+    ICELoadTestApp(int argc, char* argv[]);
+
+    bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler = false) override;
+
+private slots:
+    void sendHeartbeats();
+    void printStats();
+
+private:
+    bool generateKeypair();
+    void createHeartbeats();
+    std::unique_ptr<NLPacket> createHeartbeat(const QUuid& domainID, const HifiSockAddr& publicSockAddr,
+                                              const HifiSockAddr& localSockAddr);
+    void processPacket(std::unique_ptr<udt::Packet> packet);
+
+    int _numDomains { 10000 };
+    int _heartbeatIntervalMsecs { 1000 };
+    int _durationSecs { 0 };
+    int _numVariants { 2 };
+
+    HifiSockAddr _iceServerSockAddr;
+    std::unique_ptr<udt::Socket> _socket;
+    std::unique_ptr<HTTPManager> _apiServer;
+
+    std::unique_ptr<RSA, void(*)(RSA*)> _keypair { nullptr, RSA_free };
+    QByteArray _publicKey; // DER encoded SubjectPublicKeyInfo, as served by the metaverse API
+
+    std::vector<std::unique_ptr<NLPacket>> _heartbeats;
+    size_t _nextHeartbeat { 0 };
+    quint64 _lastSendTime { 0 };
+    double _heartbeatsOwed { 0.0 };
+
+    QTimer _sendTimer;
+    QTimer _statsTimer;
+    quint64 _startTime { 0 };
+
+    quint64 _numSent { 0 };
+    quint64 _numAcked { 0 };
+    quint64 _numDenied { 0 };
+    quint64 _numPublicKeyRequests { 0 };
+};
+
+#endif // hifi_ICELoadTestApp_h
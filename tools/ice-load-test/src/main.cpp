@@ -0,0 +1,19 @@
+//
+//  main.cpp
+//  tools/ice-load-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+
+#include <SharedUtil.h>
+
+#include "ICELoadTestApp.h"
+
+int main(int argc, char* argv[]) {
+    setupHifiApplication("ICE Load Test");
+
+    ICELoadTestApp app(argc, argv);
+    return app.exec();
+}
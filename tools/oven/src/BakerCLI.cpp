@@ -104,11 +104,11 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
         return;
     }
 
+    // make sure we hear about the results of this baker when it is done, which can be right away for cached bakes
+    connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
+
     // invoke the bake method on the baker thread
     QMetaObject::invokeMethod(_baker.get(), "bake");
-
-    // make sure we hear about the results of this baker when it is done
-    connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
 }
 
 void BakerCLI::handleFinishedBaker() {
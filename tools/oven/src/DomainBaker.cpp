@@ -11,6 +11,8 @@
 
 #include "DomainBaker.h"
 
+#include <algorithm>
+
 #include <QtConcurrent>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFile>
@@ -20,6 +22,8 @@
 #include "Gzip.h"
 #include "Oven.h"
 #include "baking/BakerLibrary.h"
+#include "baking/BakeCache.h"
+#include "baking/TextureBakeRegistry.h"
 
 DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainName,
                          const QString& baseOutputPath, const QUrl& destinationPath,
@@ -38,6 +42,13 @@ DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainNam
 }
 
 void DomainBaker::bake() {
+    _bakeTimer.start();
+    auto& textureBakeRegistry = Oven::instance().getTextureBakeRegistry();
+    _numBakedTexturesAtStart = textureBakeRegistry->getNumBakedTextures();
+    _numSharedTexturesAtStart = textureBakeRegistry->getNumSharedTextures();
+    auto& bakeCache = Oven::instance().getBakeCache();
+    _numRestoredBakesAtStart = bakeCache ? bakeCache->getNumRestored() : 0;
+
     setupOutputFolder();
 
     if (hasErrors()) {
@@ -169,8 +180,7 @@ void DomainBaker::addModelBaker(const QString& property, const QString& url, con
 
                 // move the baker to the baker thread
                 // and kickoff the bake
-                baker->moveToThread(Oven::instance().getNextWorkerThread());
-                QMetaObject::invokeMethod(baker.data(), "bake", Qt::QueuedConnection);
+                startSubBake(baker.data(), "model " + bakeableModelURL.toDisplayString());
 
                 // keep track of the total number of baking entities
                 ++_totalNumberOfSubBakes;
@@ -212,8 +222,7 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
             _textureBakers.insert(key, textureBaker);
 
             // move the baker to a worker thread and kickoff the bake
-            textureBaker->moveToThread(Oven::instance().getNextWorkerThread());
-            QMetaObject::invokeMethod(textureBaker.data(), "bake", Qt::QueuedConnection);
+            startSubBake(textureBaker.data(), "texture " + textureURL.toDisplayString());
 
             // keep track of the total number of baking entities
             ++_totalNumberOfSubBakes;
@@ -248,8 +257,7 @@ void DomainBaker::addScriptBaker(const QString& property, const QString& url, co
         _scriptBakers.insert(scriptURL, scriptBaker);
 
         // move the baker to a worker thread and kickoff the bake
-        scriptBaker->moveToThread(Oven::instance().getNextWorkerThread());
-        QMetaObject::invokeMethod(scriptBaker.data(), "bake", Qt::QueuedConnection);
+        startSubBake(scriptBaker.data(), "script " + scriptURL.toDisplayString());
 
         // keep track of the total number of baking entities
         ++_totalNumberOfSubBakes;
@@ -285,8 +293,7 @@ void DomainBaker::addMaterialBaker(const QString& property, const QString& data,
         _materialBakers.insert(materialData, materialBaker);
 
         // move the baker to a worker thread and kickoff the bake
-        materialBaker->moveToThread(Oven::instance().getNextWorkerThread());
-        QMetaObject::invokeMethod(materialBaker.data(), "bake", Qt::QueuedConnection);
+        startSubBake(materialBaker.data(), "material " + (isURL ? materialData : QString("data")));
 
         // keep track of the total number of baking entities
         ++_totalNumberOfSubBakes;
@@ -490,6 +497,8 @@ void DomainBaker::handleFinishedModelBaker() {
         // drop our shared pointer to this baker so that it gets cleaned up
         _modelBakers.remove(baker->getOriginalInputModelURL());
 
+        finishSubBake(baker);
+
         // emit progress to tell listeners how many models we have baked
         emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
 
@@ -566,6 +575,8 @@ void DomainBaker::handleFinishedTextureBaker() {
         // drop our shared pointer to this baker so that it gets cleaned up
         _textureBakers.remove({ baker->getTextureURL(), baker->getTextureType() });
 
+        finishSubBake(baker);
+
         // emit progress to tell listeners how many textures we have baked
         emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
 
@@ -640,6 +651,8 @@ void DomainBaker::handleFinishedScriptBaker() {
         // drop our shared pointer to this baker so that it gets cleaned up
         _scriptBakers.remove(baker->getJSPath());
 
+        finishSubBake(baker);
+
         // emit progress to tell listeners how many scripts we have baked
         emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
 
@@ -730,6 +743,8 @@ void DomainBaker::handleFinishedMaterialBaker() {
         // drop our shared pointer to this baker so that it gets cleaned up
         _materialBakers.remove(baker->getMaterialData());
 
+        finishSubBake(baker);
+
         // emit progress to tell listeners how many materials we have baked
         emit bakeProgress(++_completedSubBakes, _totalNumberOfSubBakes);
 
@@ -738,6 +753,74 @@ void DomainBaker::handleFinishedMaterialBaker() {
     }
 }
 
+void DomainBaker::startSubBake(Baker* baker, const QString& description) {
+    SubBakeTime subBakeTime;
+    subBakeTime.description = description;
+    subBakeTime.queuedMSecs = _bakeTimer.elapsed();
+    _runningSubBakes.insert(baker, subBakeTime);
+
+    baker->moveToThread(Oven::instance().getWorkerThreadForBaker(baker));
+    QMetaObject::invokeMethod(baker, "startBake", Qt::QueuedConnection);
+}
+
+void DomainBaker::finishSubBake(Baker* baker) {
+    auto it = _runningSubBakes.find(baker);
+    if (it != _runningSubBakes.end()) {
+        // the baker stamps its own start on its worker thread, the time before that was spent waiting for the thread
+        it->finishMSecs = _bakeTimer.elapsed();
+        it->startMSecs = baker->getBakeTimer().isValid() ? _bakeTimer.msecsTo(baker->getBakeTimer()) : it->queuedMSecs;
+        it->startMSecs = std::min(std::max(it->startMSecs, it->queuedMSecs), it->finishMSecs);
+        _finishedSubBakes.push_back(*it);
+        _runningSubBakes.erase(it);
+    }
+}
+
+void DomainBaker::reportCriticalPath() {
+    if (_finishedSubBakes.empty()) {
+        return;
+    }
+
+    qint64 totalMSecs = std::max(_bakeTimer.elapsed(), (qint64)1);
+    qint64 summedMSecs = 0;
+    qint64 summedQueuedMSecs = 0;
+    for (const auto& subBakeTime : _finishedSubBakes) {
+        summedMSecs += subBakeTime.getBakeMSecs();
+        summedQueuedMSecs += subBakeTime.getQueuedMSecs();
+    }
+
+    auto& textureBakeRegistry = Oven::instance().getTextureBakeRegistry();
+    qDebug() << "Baked" << _finishedSubBakes.size() << "models, textures, scripts and materials in" << totalMSecs << "ms,"
+             << "with an average of" << (float)summedMSecs / (float)totalMSecs << "in flight";
+    qDebug() << "Sub-bakes waited" << summedQueuedMSecs / (qint64)_finishedSubBakes.size() << "ms on average for a worker thread";
+    qDebug() << "Baked" << textureBakeRegistry->getNumBakedTextures() - _numBakedTexturesAtStart << "distinct textures, and reused them"
+             << textureBakeRegistry->getNumSharedTextures() - _numSharedTexturesAtStart << "times for identical sources";
+    auto& bakeCache = Oven::instance().getBakeCache();
+    if (bakeCache) {
+        qDebug() << "Restored" << bakeCache->getNumRestored() - _numRestoredBakesAtStart << "bakes of unchanged sources from the bake cache in"
+                 << bakeCache->getDirectory();
+    }
+
+    // The entities file is only written once every sub-bake is done, and a model or material bake only finishes after
+    // its own texture bakes, so the sub-bake that finishes last ends the critical path of the whole domain bake.
+    const auto& criticalPath = *std::max_element(_finishedSubBakes.begin(), _finishedSubBakes.end(),
+        [](const SubBakeTime& a, const SubBakeTime& b) {
+            return a.finishMSecs < b.finishMSecs;
+        });
+    qDebug() << "Critical path:" << criticalPath.description << "finished last at" << criticalPath.finishMSecs << "ms,"
+             << "after waiting" << criticalPath.getQueuedMSecs() << "ms from" << criticalPath.queuedMSecs << "ms"
+             << "and baking" << criticalPath.getBakeMSecs() << "ms from" << criticalPath.startMSecs << "ms";
+
+    std::sort(_finishedSubBakes.begin(), _finishedSubBakes.end(), [](const SubBakeTime& a, const SubBakeTime& b) {
+        return a.getBakeMSecs() > b.getBakeMSecs();
+    });
+    const size_t MAX_SLOWEST_SUB_BAKES_REPORTED = 5;
+    qDebug() << "Slowest sub-bakes:";
+    for (size_t i = 0; i < std::min(_finishedSubBakes.size(), MAX_SLOWEST_SUB_BAKES_REPORTED); ++i) {
+        qDebug() << "    " << _finishedSubBakes[i].description << "took" << _finishedSubBakes[i].getBakeMSecs() << "ms"
+                 << "after waiting" << _finishedSubBakes[i].getQueuedMSecs() << "ms";
+    }
+}
+
 void DomainBaker::checkIfRewritingComplete() {
     if (_entitiesNeedingRewrite.isEmpty()) {
         writeNewEntitiesFile();
@@ -746,6 +829,8 @@ void DomainBaker::checkIfRewritingComplete() {
             return;
         }
 
+        reportCriticalPath();
+
         // we've now written out our new models file - time to say that we are finished up
         emit finished();
     }
@@ -12,6 +12,7 @@
 #ifndef hifi_DomainBaker_h
 #define hifi_DomainBaker_h
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonArray>
 #include <QtCore/QObject>
@@ -51,6 +52,10 @@ private:
     void checkIfRewritingComplete();
     void writeNewEntitiesFile();
 
+    void startSubBake(Baker* baker, const QString& description);
+    void finishSubBake(Baker* baker);
+    void reportCriticalPath();
+
     QUrl _localEntitiesFileURL;
     QString _domainName;
     QString _baseOutputPath;
@@ -74,6 +79,22 @@ private:
     int _totalNumberOfSubBakes { 0 };
     int _completedSubBakes { 0 };
 
+    struct SubBakeTime {
+        QString description;
+        qint64 queuedMSecs { 0 };
+        qint64 startMSecs { 0 };
+        qint64 finishMSecs { 0 };
+
+        qint64 getQueuedMSecs() const { return startMSecs - queuedMSecs; }
+        qint64 getBakeMSecs() const { return finishMSecs - startMSecs; }
+    };
+    QElapsedTimer _bakeTimer;
+    QHash<Baker*, SubBakeTime> _runningSubBakes;
+    std::vector<SubBakeTime> _finishedSubBakes;
+    int _numBakedTexturesAtStart { 0 };
+    int _numSharedTexturesAtStart { 0 };
+    int _numRestoredBakesAtStart { 0 };
+
     bool _shouldRebakeOriginals { false };
 
     void addModelBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
@@ -21,6 +21,7 @@
 #include <ResourceManager.h>
 #include <ResourceRequestObserver.h>
 #include <ResourceCache.h>
+#include <PathUtils.h>
 #include <procedural/ProceduralMaterialCache.h>
 #include <material-networking/TextureCache.h>
 #include <hfm/ModelFormatRegistry.h>
@@ -28,10 +29,15 @@
 #include <OBJSerializer.h>
 
 #include "MaterialBaker.h"
+#include "TextureBaker.h"
+#include "baking/BakeCache.h"
+#include "baking/TextureBakeRegistry.h"
+
+static const QString BAKE_CACHE_FOLDER_NAME = "bake-cache";
 
 Oven* Oven::_staticInstance { nullptr };
 
-Oven::Oven() {
+Oven::Oven(const QString& bakeCacheDirectory) {
     _staticInstance = this;
 
     // setup our worker threads
@@ -45,10 +51,21 @@ Oven::Oven() {
     DependencyManager::set<TextureCache>();
     DependencyManager::set<MaterialCache>();
 
-    MaterialBaker::setNextOvenWorkerThreadOperator([] {
-        return Oven::instance().getNextWorkerThread();
+    MaterialBaker::setNextOvenWorkerThreadOperator([](Baker* baker) {
+        return Oven::instance().getWorkerThreadForBaker(baker);
     });
 
+    // textures with the same content are baked once, however many models and entities use them
+    _textureBakeRegistry = std::make_shared<TextureBakeRegistry>();
+    TextureBaker::setBakeRegistry(_textureBakeRegistry);
+
+    // re-running a bake only redoes the work for the sources that changed since
+    if (!bakeCacheDirectory.isEmpty()) {
+        _bakeCache = std::make_shared<BakeCache>(bakeCacheDirectory);
+        _bakeCache->trim();
+    }
+    Baker::setBakeCache(_bakeCache);
+
     {
         auto modelFormatRegistry = DependencyManager::set<ModelFormatRegistry>();
         modelFormatRegistry->addFormat(FBXSerializer());
@@ -59,6 +76,9 @@ Oven::Oven() {
 Oven::~Oven() {
     DependencyManager::get<ResourceManager>()->cleanup();
 
+    TextureBaker::setBakeRegistry(nullptr);
+    Baker::setBakeCache(nullptr);
+
     // quit all worker threads and wait on them
     for (auto& thread : _workerThreads) {
         thread->quit();
@@ -73,6 +93,7 @@ Oven::~Oven() {
 
 void Oven::setupWorkerThreads(int numWorkerThreads) {
     _workerThreads.reserve(numWorkerThreads);
+    _workerThreadLoads.resize(numWorkerThreads, 0);
 
     for (auto i = 0; i < numWorkerThreads; ++i) {
         // setup a worker thread yet and add it to our concurrent vector
@@ -83,18 +104,31 @@ void Oven::setupWorkerThreads(int numWorkerThreads) {
     }
 }
 
+size_t Oven::getLeastLoadedWorkerThreadIndex() {
+    // start the search after the last thread handed out, so that ties are spread over all the threads
+    size_t firstIndex = ++_nextWorkerThreadIndex;
+    size_t leastLoadedIndex = firstIndex % _workerThreads.size();
+    for (size_t i = 1; i < _workerThreads.size(); ++i) {
+        size_t index = (firstIndex + i) % _workerThreads.size();
+        if (_workerThreadLoads[index] < _workerThreadLoads[leastLoadedIndex]) {
+            leastLoadedIndex = index;
+        }
+    }
+    return leastLoadedIndex;
+}
+
 QThread* Oven::getNextWorkerThread() {
-    // FIXME: we assign these threads when we make the bakers, but if certain bakers finish quickly, we could end up
-    // in a situation where threads have finished and others have tons of work queued.  Instead of assigning them at initialization,
-    // we should build a queue of bakers, and when threads finish, they can take the next available baker.
+    // Bakers are assigned their thread when they are made, so a thread that was handed a few long bakes can end up with
+    // tons of work queued while others sit idle.  Bakers that go through getWorkerThreadForBaker are counted against their
+    // thread until they are done, and new bakers go to the thread with the least of them outstanding.
 
     // Here we replicate some of the functionality of QThreadPool by giving callers an available worker thread to use.
     // We can't use QThreadPool because we want to put QObjects with signals/slots on these threads.
     // So instead we setup our own list of threads, up to one less than the ideal thread count
-    // (for the FBX Baker Thread to have room), and cycle through them to hand a usable running thread back to our callers.
+    // (for the FBX Baker Thread to have room), and hand the least busy of them back to our callers as a usable running thread.
 
-    auto nextIndex = ++_nextWorkerThreadIndex;
-    auto& nextThread = _workerThreads[nextIndex % _workerThreads.size()];
+    std::lock_guard<std::mutex> lock(_workerThreadLoadsMutex);
+    auto& nextThread = _workerThreads[getLeastLoadedWorkerThreadIndex()];
 
     // start the thread if it isn't running yet
     if (!nextThread->isRunning()) {
@@ -104,3 +138,30 @@ QThread* Oven::getNextWorkerThread() {
     return nextThread.get();
 }
 
+QThread* Oven::getWorkerThreadForBaker(Baker* baker) {
+    std::lock_guard<std::mutex> lock(_workerThreadLoadsMutex);
+    size_t index = getLeastLoadedWorkerThreadIndex();
+    ++_workerThreadLoads[index];
+
+    // a baker is done once it finishes, aborts or goes away, whichever comes first
+    auto isDone = std::make_shared<std::atomic<bool>>(false);
+    auto onDone = [this, index, isDone] {
+        if (!isDone->exchange(true)) {
+            std::lock_guard<std::mutex> doneLock(_workerThreadLoadsMutex);
+            --_workerThreadLoads[index];
+        }
+    };
+    QObject::connect(baker, &Baker::finished, onDone);
+    QObject::connect(baker, &Baker::aborted, onDone);
+    QObject::connect(baker, &QObject::destroyed, onDone);
+
+    auto& thread = _workerThreads[index];
+    if (!thread->isRunning()) {
+        thread->start();
+    }
+    return thread.get();
+}
+
+QString Oven::getDefaultBakeCacheDirectory() {
+    return PathUtils::getAppLocalDataPath() + BAKE_CACHE_FOLDER_NAME;
+}
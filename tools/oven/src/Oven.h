@@ -14,25 +14,48 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 class QThread;
+class Baker;
+class TextureBakeRegistry;
+class BakeCache;
+class QString;
 
 class Oven {
 
 public:
-    Oven();
+    // Bakes of unchanged sources restore the results of earlier bakes from the cache in bakeCacheDirectory, or from none
+    // when it is empty; the cache is created and trimmed here, once for the process
+    Oven(const QString& bakeCacheDirectory);
     ~Oven();
 
+    static QString getDefaultBakeCacheDirectory();
+
     static Oven& instance() { return *_staticInstance; }
 
     QThread* getNextWorkerThread();
 
+    // Like getNextWorkerThread, but also counts baker against the thread it returns until baker is done,
+    // so that new bakers go to the threads with the least outstanding work
+    QThread* getWorkerThreadForBaker(Baker* baker);
+
+    const std::shared_ptr<TextureBakeRegistry>& getTextureBakeRegistry() const { return _textureBakeRegistry; }
+
+    const std::shared_ptr<BakeCache>& getBakeCache() const { return _bakeCache; }
+
 private:
     void setupWorkerThreads(int numWorkerThreads);
     void setupFBXBakerThread();
+    size_t getLeastLoadedWorkerThreadIndex();
 
     std::vector<std::unique_ptr<QThread>> _workerThreads;
+    std::vector<int> _workerThreadLoads;
+    std::mutex _workerThreadLoadsMutex;
+
+    std::shared_ptr<TextureBakeRegistry> _textureBakeRegistry;
+    std::shared_ptr<BakeCache> _bakeCache;
 
     std::atomic<uint32_t> _nextWorkerThreadIndex;
     int _numWorkerThreads;
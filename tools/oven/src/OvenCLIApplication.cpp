@@ -25,19 +25,32 @@ static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_TEXTURE_COMPRESSION_THREADS_PARAMETER = "texture-compression-threads";
+static const QString CLI_BAKE_CACHE_PARAMETER = "bake-cache";
+static const QString CLI_DISABLE_BAKE_CACHE_PARAMETER = "disable-bake-cache";
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QString OvenCLIApplication::_bakeCacheParameter;
+bool OvenCLIApplication::_disableBakeCacheParameter { false };
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
-    QCoreApplication(argc, argv)
+    QCoreApplication(argc, argv),
+    Oven(getBakeCacheDirectory())
 {
     BakerCLI* cli = new BakerCLI(this);
     QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
                               Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
 }
 
+QString OvenCLIApplication::getBakeCacheDirectory() {
+    if (_disableBakeCacheParameter) {
+        return QString();
+    }
+    return _bakeCacheParameter.isEmpty() ? getDefaultBakeCacheDirectory() : _bakeCacheParameter;
+}
+
 void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
     // parse the command line parameters
     QCommandLineParser parser;
@@ -47,7 +60,10 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
         { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_TEXTURE_COMPRESSION_THREADS_PARAMETER, "Threads shared by all texture compressions, all cores by default.", "threads" },
+        { CLI_BAKE_CACHE_PARAMETER, "Path to folder that keeps the results of earlier bakes, so that unchanged sources are not baked again.", "directory" },
+        { CLI_DISABLE_BAKE_CACHE_PARAMETER, "Bake every source, even when an earlier bake of it is cached." }
     });
 
     auto versionOption = parser.addVersionOption();
@@ -91,4 +107,13 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         qDebug() << "Disabling texture compression";
         TextureBaker::setCompressionEnabled(false);
     }
+
+    if (parser.isSet(CLI_TEXTURE_COMPRESSION_THREADS_PARAMETER)) {
+        image::setCompressionThreadBudget(parser.value(CLI_TEXTURE_COMPRESSION_THREADS_PARAMETER).toInt());
+    }
+
+    if (parser.isSet(CLI_BAKE_CACHE_PARAMETER)) {
+        _bakeCacheParameter = QDir::fromNativeSeparators(parser.value(CLI_BAKE_CACHE_PARAMETER));
+    }
+    _disableBakeCacheParameter = parser.isSet(CLI_DISABLE_BAKE_CACHE_PARAMETER);
 }
@@ -26,9 +26,14 @@ public:
     static OvenCLIApplication* instance() { return dynamic_cast<OvenCLIApplication*>(QCoreApplication::instance()); }
 
 private:
+    // the cache chosen on the command line, so that the default one isn't created or trimmed when another is used
+    static QString getBakeCacheDirectory();
+
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static QString _bakeCacheParameter;
+    static bool _disableBakeCacheParameter;
 };
 
 #endif // hifi_OvenCLIApplication_h
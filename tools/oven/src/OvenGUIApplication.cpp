@@ -12,7 +12,8 @@
 #include "OvenGUIApplication.h"
 
 OvenGUIApplication::OvenGUIApplication(int argc, char* argv[]) :
-    QApplication(argc, argv)
+    QApplication(argc, argv),
+    Oven(getDefaultBakeCacheDirectory())
 {
     // setup the GUI
     _mainWindow.show();
@@ -0,0 +1,137 @@
+//
+//  EmulatedLink.cpp
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EmulatedLink.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+
+#include <SharedUtil.h>
+
+// large enough that the kernel doesn't drop datagrams of its own while the link thread is busy, which would add to the
+// loss being emulated
+static const int LINK_SOCKET_BUFFER_BYTES = 4 * 1024 * 1024;
+
+// how long a reordered datagram is held back when there is no delay for the datagrams after it to skip ahead of
+static const quint64 REORDER_HOLD_USECS = USECS_PER_MSEC;
+
+EmulatedLink::EmulatedLink(const Conditions& conditions, const HifiSockAddr& destination, uint32_t seed) :
+    _conditions(conditions),
+    _destination(destination),
+    _generator(seed)
+{
+    connect(&_entrySocket, &QUdpSocket::readyRead, this, &EmulatedLink::readFromSource);
+    connect(&_exitSocket, &QUdpSocket::readyRead, this, &EmulatedLink::readFromDestination);
+
+    _releaseTimer.setTimerType(Qt::PreciseTimer);
+    _releaseTimer.setInterval(1);
+    connect(&_releaseTimer, &QTimer::timeout, this, &EmulatedLink::releaseHeldDatagrams);
+}
+
+EmulatedLink::Stats EmulatedLink::getStats() const {
+    Stats stats;
+    stats.forwarded = _numForwarded;
+    stats.dropped = _numDropped;
+    stats.reordered = _numReordered;
+    return stats;
+}
+
+void EmulatedLink::start() {
+    for (auto socket : { &_entrySocket, &_exitSocket }) {
+        if (!socket->bind(QHostAddress::LocalHost, 0)) {
+            qCritical() << "EmulatedLink could not bind a socket:" << socket->errorString();
+        }
+        socket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, LINK_SOCKET_BUFFER_BYTES);
+        socket->setSocketOption(QAbstractSocket::SendBufferSizeSocketOption, LINK_SOCKET_BUFFER_BYTES);
+    }
+    _entryPort = _entrySocket.localPort();
+    _exitPort = _exitSocket.localPort();
+}
+
+void EmulatedLink::readFromSource() {
+    while (_entrySocket.hasPendingDatagrams()) {
+        QByteArray datagram;
+        datagram.resize(_entrySocket.pendingDatagramSize());
+        HifiSockAddr sender;
+        auto sizeRead = _entrySocket.readDatagram(datagram.data(), datagram.size(),
+                                                  sender.getAddressPointer(), sender.getPortPointer());
+        if (sizeRead < 0) {
+            continue;
+        }
+        _source = sender;
+        relay(datagram, true);
+    }
+}
+
+void EmulatedLink::readFromDestination() {
+    while (_exitSocket.hasPendingDatagrams()) {
+        QByteArray datagram;
+        datagram.resize(_exitSocket.pendingDatagramSize());
+        auto sizeRead = _exitSocket.readDatagram(datagram.data(), datagram.size());
+        if (sizeRead < 0 || _source.isNull()) {
+            // nowhere to send it until the source has sent something
+            continue;
+        }
+        relay(datagram, false);
+    }
+}
+
+void EmulatedLink::relay(QByteArray datagram, bool toDestination) {
+    if (_conditions.loss > 0.0f && _distribution(_generator) < _conditions.loss) {
+        ++_numDropped;
+        return;
+    }
+
+    bool isDelayed = _conditions.delayMsecs > 0 || _conditions.jitterMsecs > 0;
+    bool isReordered = _conditions.reorder > 0.0f && _distribution(_generator) < _conditions.reorder;
+
+    quint64 delayUsecs = 0;
+    if (isReordered) {
+        // like netem, a reordered datagram goes out right away, ahead of the delayed ones; without a delay it is
+        // held back a little instead, so that the next ones get ahead of it
+        ++_numReordered;
+        delayUsecs = isDelayed ? 0 : REORDER_HOLD_USECS;
+    } else if (isDelayed) {
+        float jitter = (2.0f * _distribution(_generator) - 1.0f) * _conditions.jitterMsecs;
+        delayUsecs = (quint64)(std::max(0.0f, _conditions.delayMsecs + jitter) * USECS_PER_MSEC);
+    }
+
+    if (delayUsecs == 0) {
+        send(datagram, toDestination);
+        return;
+    }
+
+    _heldDatagrams.push({ usecTimestampNow() + delayUsecs, _numHeld++, std::move(datagram), toDestination });
+    if (!_releaseTimer.isActive()) {
+        _releaseTimer.start();
+    }
+}
+
+void EmulatedLink::releaseHeldDatagrams() {
+    auto now = usecTimestampNow();
+    while (!_heldDatagrams.empty() && _heldDatagrams.top().releaseUsecs <= now) {
+        const auto& held = _heldDatagrams.top();
+        send(held.data, held.toDestination);
+        _heldDatagrams.pop();
+    }
+    if (_heldDatagrams.empty()) {
+        _releaseTimer.stop();
+    }
+}
+
+void EmulatedLink::send(const QByteArray& datagram, bool toDestination) {
+    if (toDestination) {
+        _exitSocket.writeDatagram(datagram, _destination.getAddress(), _destination.getPort());
+    } else {
+        _entrySocket.writeDatagram(datagram, _source.getAddress(), _source.getPort());
+    }
+    ++_numForwarded;
+}
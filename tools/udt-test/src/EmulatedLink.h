@@ -0,0 +1,100 @@
+//
+//  EmulatedLink.h
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_EmulatedLink_h
+#define hifi_EmulatedLink_h
+
+#include <atomic>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtNetwork/QUdpSocket>
+
+#include <HifiSockAddr.h>
+
+// A UDP relay over loopback that stands in for the network between a sender and a receiver, in the way netem would:
+// datagrams are dropped, delayed and reordered in both directions according to its conditions.  The sender sends to
+// the entry address of the link, and the receiver sees its datagrams come from the exit address and answers there.
+//
+// The link lives on its own thread, so that the relaying doesn't wait on the event loop of the sockets under test.
+class EmulatedLink : public QObject {
+    Q_OBJECT
+public:
+    struct Conditions {
+        float loss { 0.0f }; // probability for each datagram to be dropped
+        int delayMsecs { 0 }; // one way delay
+        int jitterMsecs { 0 }; // the one way delay varies by up to this much either way
+        float reorder { 0.0f }; // probability for each datagram to skip ahead of the ones delayed before it
+    };
+
+    struct Stats {
+        uint64_t forwarded { 0 };
+        uint64_t dropped { 0 };
+        uint64_t reordered { 0 };
+    };
+
+    EmulatedLink(const Conditions& conditions, const HifiSockAddr& destination, uint32_t seed);
+
+    HifiSockAddr getEntryAddress() const { return HifiSockAddr(QHostAddress::LocalHost, _entryPort); }
+    HifiSockAddr getExitAddress() const { return HifiSockAddr(QHostAddress::LocalHost, _exitPort); }
+
+    Stats getStats() const;
+
+public slots:
+    // binds the sockets of the link, must be called on the thread of the link
+    void start();
+
+private slots:
+    void readFromSource();
+    void readFromDestination();
+    void releaseHeldDatagrams();
+
+private:
+    struct HeldDatagram {
+        quint64 releaseUsecs;
+        uint64_t order;
+        QByteArray data;
+        bool toDestination;
+
+        bool operator>(const HeldDatagram& other) const {
+            return releaseUsecs > other.releaseUsecs || (releaseUsecs == other.releaseUsecs && order > other.order);
+        }
+    };
+
+    void relay(QByteArray datagram, bool toDestination);
+    void send(const QByteArray& datagram, bool toDestination);
+
+    Conditions _conditions;
+    HifiSockAddr _destination;
+    HifiSockAddr _source; // learnt from the first datagram to reach the entry
+
+    QUdpSocket _entrySocket { this };
+    QUdpSocket _exitSocket { this };
+    std::atomic<quint16> _entryPort { 0 };
+    std::atomic<quint16> _exitPort { 0 };
+
+    std::mt19937 _generator;
+    std::uniform_real_distribution<float> _distribution { 0.0f, 1.0f };
+
+    std::priority_queue<HeldDatagram, std::vector<HeldDatagram>, std::greater<HeldDatagram>> _heldDatagrams;
+    uint64_t _numHeld { 0 };
+    QTimer _releaseTimer { this };
+
+    std::atomic<uint64_t> _numForwarded { 0 };
+    std::atomic<uint64_t> _numDropped { 0 };
+    std::atomic<uint64_t> _numReordered { 0 };
+};
+
+#endif // hifi_EmulatedLink_h
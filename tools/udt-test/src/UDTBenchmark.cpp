@@ -0,0 +1,597 @@
+//
+//  UDTBenchmark.cpp
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "UDTBenchmark.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QtCore/QDebug>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include <udt/Packet.h>
+#include <udt/PacketList.h>
+#include <udt/TCPVegasCC.h>
+
+#include <SharedUtil.h>
+
+const QCommandLineOption BENCHMARK_OPTION {
+    "benchmark", "run the benchmark suite over emulated links instead of a single sender or receiver"
+};
+const QCommandLineOption CONGESTION_CONTROLS_OPTION {
+    "cc", "comma separated congestion controls to benchmark (default is all of them)", "names"
+};
+const QCommandLineOption WORKLOADS_OPTION {
+    "workloads", "comma separated workloads among reliable, unreliable and ordered (default is all of them)", "names"
+};
+const QCommandLineOption CONNECTIONS_OPTION {
+    "connections", "number of concurrent connections per run (default is 8)", "count"
+};
+const QCommandLineOption DURATION_OPTION {
+    "duration", "length of each run (default is 10s)", "seconds"
+};
+const QCommandLineOption PACKET_SIZE_OPTION {
+    "packet-size", "size of the packets of the reliable and unreliable workloads (defaults to "
+        + QString::number(udt::MAX_PACKET_SIZE) + ")", "bytes"
+};
+const QCommandLineOption UNRELIABLE_RATE_OPTION {
+    "unreliable-rate", "packets per second sent on each connection by the unreliable workload (default is 1000)", "packets"
+};
+const QCommandLineOption MESSAGE_SIZE_OPTION {
+    "message-size", "size of the messages of the ordered workload (default is 1000000)", "bytes"
+};
+const QCommandLineOption LOSS_OPTION {
+    "loss", "percentage of datagrams the links drop in each direction (default is 0)", "percent"
+};
+const QCommandLineOption DELAY_OPTION {
+    "delay", "one way delay of the links (default is 0)", "milliseconds"
+};
+const QCommandLineOption JITTER_OPTION {
+    "jitter", "variation of the one way delay either way (default is 0)", "milliseconds"
+};
+const QCommandLineOption REORDER_OPTION {
+    "reorder", "percentage of datagrams the links send ahead of the ones delayed before them (default is 0)", "percent"
+};
+const QCommandLineOption SEED_OPTION {
+    "seed", "seed of the link randomness, so that runs can be repeated (default is 742272)", "integer"
+};
+const QCommandLineOption OUTPUT_OPTION {
+    "output", "file to write the results to, one JSON object per run and line (default is udt-benchmark.jsonl)", "path",
+    "udt-benchmark.jsonl"
+};
+const QCommandLineOption STATS_INTERVAL_OPTION {
+    "stats-interval", "connection stats sampling interval (default is 100ms)", "milliseconds"
+};
+
+// the congestion controls the benchmark knows about, by the name results are reported under
+static const std::vector<std::pair<QString, UDTBenchmark::CongestionControlFactoryCreator>> CONGESTION_CONTROLS {
+    { "vegas", [] {
+        return std::unique_ptr<udt::CongestionControlVirtualFactory>(new udt::CongestionControlFactory<udt::TCPVegasCC>());
+    } }
+};
+
+static const int NUM_INITIAL_PACKETS = 500; // reliable packets queued up front on each connection, as UDTTest does
+static const int NUM_MESSAGES_IN_FLIGHT = 2; // ordered messages queued on each connection at any time
+static const int MESSAGE_HEADER_BYTES = sizeof(uint64_t) + sizeof(quint64); // index and send time
+static const int RUN_GAP_MSECS = 500; // lets the connections of a run wind down before the next one starts
+
+static const double MEGABITS_PER_BYTE = 8.0 / 1000000.0;
+static const double PERCENT = 100.0;
+
+bool UDTBenchmark::isRequested(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (QString(argv[i]) == "--" + BENCHMARK_OPTION.names().first()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QString UDTBenchmark::getWorkloadName(Workload workload) {
+    switch (workload) {
+        case RELIABLE:
+            return "reliable";
+        case UNRELIABLE:
+            return "unreliable";
+        case ORDERED:
+            return "ordered";
+        default:
+            return "unknown";
+    }
+}
+
+UDTBenchmark::UDTBenchmark(int& argc, char** argv) :
+    QCoreApplication(argc, argv)
+{
+    if (!parseArguments()) {
+        QTimer::singleShot(0, this, [] { exit(1); });
+        return;
+    }
+
+    _linkThread.setObjectName("EmulatedLinks");
+    _linkThread.start();
+
+    _statsTimer.setInterval(_statsInterval);
+    connect(&_statsTimer, &QTimer::timeout, this, &UDTBenchmark::sampleStats);
+
+    QMetaObject::invokeMethod(this, "startNextRun", Qt::QueuedConnection);
+}
+
+UDTBenchmark::~UDTBenchmark() {
+    _senders.clear();
+    _receiver.reset();
+    for (auto link : _links) {
+        link->deleteLater();
+    }
+    _linkThread.quit();
+    _linkThread.wait();
+}
+
+bool UDTBenchmark::parseArguments() {
+    _argumentParser.setApplicationDescription("High Fidelity UDT Protocol Benchmark");
+    const QCommandLineOption helpOption = _argumentParser.addHelpOption();
+
+    _argumentParser.addOptions({
+        BENCHMARK_OPTION, CONGESTION_CONTROLS_OPTION, WORKLOADS_OPTION, CONNECTIONS_OPTION, DURATION_OPTION,
+        PACKET_SIZE_OPTION, UNRELIABLE_RATE_OPTION, MESSAGE_SIZE_OPTION, LOSS_OPTION, DELAY_OPTION, JITTER_OPTION,
+        REORDER_OPTION, SEED_OPTION, OUTPUT_OPTION, STATS_INTERVAL_OPTION
+    });
+
+    if (!_argumentParser.parse(arguments())) {
+        qCritical() << _argumentParser.errorText();
+        _argumentParser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (_argumentParser.isSet(helpOption)) {
+        _argumentParser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (_argumentParser.isSet(CONNECTIONS_OPTION)) {
+        _settings.numConnections = std::max(1, _argumentParser.value(CONNECTIONS_OPTION).toInt());
+    }
+    if (_argumentParser.isSet(DURATION_OPTION)) {
+        _settings.durationMsecs = (int)(_argumentParser.value(DURATION_OPTION).toDouble() * MSECS_PER_SECOND);
+    }
+    if (_argumentParser.isSet(PACKET_SIZE_OPTION)) {
+        _settings.packetSize = _argumentParser.value(PACKET_SIZE_OPTION).toInt();
+        if (_settings.packetSize <= udt::Packet::localHeaderSize(false) || _settings.packetSize > udt::MAX_PACKET_SIZE) {
+            qCritical() << "The packet size must be larger than the packet header and at most" << udt::MAX_PACKET_SIZE;
+            return false;
+        }
+    }
+    if (_argumentParser.isSet(UNRELIABLE_RATE_OPTION)) {
+        _settings.unreliablePacketsPerSecond = std::max(1, _argumentParser.value(UNRELIABLE_RATE_OPTION).toInt());
+    }
+    if (_argumentParser.isSet(MESSAGE_SIZE_OPTION)) {
+        _settings.messageSize = std::max(MESSAGE_HEADER_BYTES + 1, _argumentParser.value(MESSAGE_SIZE_OPTION).toInt());
+    }
+    if (_argumentParser.isSet(LOSS_OPTION)) {
+        _settings.conditions.loss = (float)(_argumentParser.value(LOSS_OPTION).toDouble() / PERCENT);
+    }
+    if (_argumentParser.isSet(DELAY_OPTION)) {
+        _settings.conditions.delayMsecs = std::max(0, _argumentParser.value(DELAY_OPTION).toInt());
+    }
+    if (_argumentParser.isSet(JITTER_OPTION)) {
+        _settings.conditions.jitterMsecs = std::max(0, _argumentParser.value(JITTER_OPTION).toInt());
+    }
+    if (_argumentParser.isSet(REORDER_OPTION)) {
+        _settings.conditions.reorder = (float)(_argumentParser.value(REORDER_OPTION).toDouble() / PERCENT);
+    }
+    if (_argumentParser.isSet(SEED_OPTION)) {
+        _settings.seed = _argumentParser.value(SEED_OPTION).toUInt();
+    }
+    if (_argumentParser.isSet(STATS_INTERVAL_OPTION)) {
+        _statsInterval = std::max(1, _argumentParser.value(STATS_INTERVAL_OPTION).toInt());
+    }
+
+    // select the congestion controls and workloads to run, in the order they are listed
+    QStringList ccNames;
+    if (_argumentParser.isSet(CONGESTION_CONTROLS_OPTION)) {
+        ccNames = _argumentParser.value(CONGESTION_CONTROLS_OPTION).split(',', QString::SkipEmptyParts);
+    } else {
+        for (const auto& congestionControl : CONGESTION_CONTROLS) {
+            ccNames << congestionControl.first;
+        }
+    }
+    for (const auto& name : ccNames) {
+        auto it = std::find_if(CONGESTION_CONTROLS.begin(), CONGESTION_CONTROLS.end(), [&](const auto& congestionControl) {
+            return congestionControl.first == name.trimmed();
+        });
+        if (it == CONGESTION_CONTROLS.end()) {
+            qCritical() << "Unknown congestion control" << name;
+            return false;
+        }
+        _congestionControls.push_back(*it);
+    }
+
+    std::vector<Workload> workloads;
+    if (_argumentParser.isSet(WORKLOADS_OPTION)) {
+        for (const auto& name : _argumentParser.value(WORKLOADS_OPTION).split(',', QString::SkipEmptyParts)) {
+            int workload = RELIABLE;
+            while (workload < NUM_WORKLOADS && getWorkloadName((Workload)workload) != name.trimmed()) {
+                ++workload;
+            }
+            if (workload == NUM_WORKLOADS) {
+                qCritical() << "Unknown workload" << name;
+                return false;
+            }
+            workloads.push_back((Workload)workload);
+        }
+    } else {
+        workloads = { RELIABLE, UNRELIABLE, ORDERED };
+    }
+
+    for (const auto& congestionControl : _congestionControls) {
+        for (auto workload : workloads) {
+            _runs.push_back({ congestionControl.first, workload });
+        }
+    }
+
+    // the log goes to stdout, so the results get a file of their own
+    _output.setFileName(_argumentParser.value(OUTPUT_OPTION));
+    if (!_output.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qCritical() << "Could not open" << _output.fileName() << "for writing";
+        return false;
+    }
+    qDebug() << "Writing benchmark results to" << _output.fileName();
+
+    return true;
+}
+
+void UDTBenchmark::startNextRun() {
+    if (_nextRun >= _runs.size()) {
+        _output.close();
+        exit(_hasFailures ? 1 : 0);
+        return;
+    }
+
+    setupRun(_runs[_nextRun]);
+
+    _runStartUsecs = usecTimestampNow();
+    _statsTimer.start();
+    QTimer::singleShot(_settings.durationMsecs, this, &UDTBenchmark::finishRun);
+}
+
+void UDTBenchmark::setupRun(const Run& run) {
+    const auto& ccFactoryCreator = std::find_if(_congestionControls.begin(), _congestionControls.end(),
+                                                [&](const auto& congestionControl) {
+        return congestionControl.first == run.congestionControl;
+    })->second;
+
+    qDebug() << "Running" << qPrintable(getWorkloadName(run.workload)) << "with" << qPrintable(run.congestionControl)
+        << "over" << _settings.numConnections << "connections for" << _settings.durationMsecs << "ms";
+
+    _receiver.reset(new udt::Socket());
+    _receiver->setCongestionControlFactory(ccFactoryCreator());
+    _receiver->bind(QHostAddress::LocalHost);
+    _receiver->setPacketHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handleReceivedPacket(std::move(packet));
+    });
+    _receiver->setMessageHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handleReceivedMessagePacket(std::move(packet));
+    });
+    _receiver->setMessageFailureHandler([this](HifiSockAddr from, udt::Packet::MessageNumber messageNumber) {
+        auto it = _connectionsByExitAddress.find(from);
+        if (it != _connectionsByExitAddress.end()) {
+            _pendingMessages.erase(std::make_pair(it->second, messageNumber));
+            ++_metrics[it->second].numFailedMessages;
+        }
+    });
+    HifiSockAddr receiverAddress { QHostAddress::LocalHost, _receiver->localPort() };
+
+    _metrics.assign(_settings.numConnections, ConnectionMetrics());
+    for (int i = 0; i < _settings.numConnections; ++i) {
+        auto link = new EmulatedLink(_settings.conditions, receiverAddress, _settings.seed + i);
+        link->moveToThread(&_linkThread);
+        QMetaObject::invokeMethod(link, "start", Qt::BlockingQueuedConnection);
+        _links.push_back(link);
+        _connectionsByExitAddress[link->getExitAddress()] = i;
+
+        auto sender = std::unique_ptr<BenchmarkSender>(new BenchmarkSender(run.workload, _settings,
+                                                                           link->getEntryAddress(), ccFactoryCreator()));
+        sender->start();
+        if (run.workload == RELIABLE) {
+            // the connection exists once the initial packets are queued, refill the queue as they go out
+            sender->getSocket().connectToSendSignal(sender->getTarget(), sender.get(), SLOT(refillPacket()));
+        }
+        _senders.push_back(std::move(sender));
+    }
+}
+
+void UDTBenchmark::sampleStats() {
+    static const double USECS_PER_MSEC_DOUBLE = (double)USECS_PER_MSEC;
+
+    for (size_t i = 0; i < _senders.size(); ++i) {
+        auto& metrics = _metrics[i];
+        auto& sender = _senders[i];
+
+        auto stats = sender->getSocket().sampleStatsForConnection(sender->getTarget());
+        metrics.sentPackets += stats.sentPackets + stats.sentUnreliablePackets;
+        metrics.retransmittedPackets += stats.retransmittedPackets;
+        if (stats.rtt > 0) {
+            double rttMsecs = stats.rtt / USECS_PER_MSEC_DOUBLE;
+            metrics.rttSumMsecs += rttMsecs;
+            metrics.maxRTTMsecs = std::max(metrics.maxRTTMsecs, rttMsecs);
+            metrics.congestionWindowSum += stats.congestionWindowSize;
+            ++metrics.numRTTSamples;
+        }
+
+        auto receiverStats = _receiver->sampleStatsForConnection(_links[i]->getExitAddress());
+        metrics.duplicatePackets += receiverStats.duplicatePackets;
+    }
+}
+
+void UDTBenchmark::finishRun() {
+    const auto& run = _runs[_nextRun++];
+    auto elapsedUsecs = usecTimestampNow() - _runStartUsecs;
+
+    _statsTimer.stop();
+    for (auto& sender : _senders) {
+        sender->stop();
+    }
+    sampleStats();
+
+    writeResult(run, elapsedUsecs);
+
+    _senders.clear();
+    _receiver.reset();
+    for (auto link : _links) {
+        link->deleteLater();
+    }
+    _links.clear();
+    _connectionsByExitAddress.clear();
+    _pendingMessages.clear();
+
+    QTimer::singleShot(RUN_GAP_MSECS, this, &UDTBenchmark::startNextRun);
+}
+
+void UDTBenchmark::writeResult(const Run& run, quint64 elapsedUsecs) {
+    double elapsedSecs = (double)elapsedUsecs / USECS_PER_SECOND;
+
+    ConnectionMetrics total;
+    double minConnectionMbps = 0.0;
+    double maxConnectionMbps = 0.0;
+    for (size_t i = 0; i < _metrics.size(); ++i) {
+        const auto& metrics = _metrics[i];
+        double connectionMbps = metrics.receivedBytes * MEGABITS_PER_BYTE / elapsedSecs;
+        minConnectionMbps = i == 0 ? connectionMbps : std::min(minConnectionMbps, connectionMbps);
+        maxConnectionMbps = std::max(maxConnectionMbps, connectionMbps);
+
+        total.receivedBytes += metrics.receivedBytes;
+        total.receivedPackets += metrics.receivedPackets;
+        total.sentPackets += metrics.sentPackets;
+        total.retransmittedPackets += metrics.retransmittedPackets;
+        total.duplicatePackets += metrics.duplicatePackets;
+        total.rttSumMsecs += metrics.rttSumMsecs;
+        total.numRTTSamples += metrics.numRTTSamples;
+        total.maxRTTMsecs = std::max(total.maxRTTMsecs, metrics.maxRTTMsecs);
+        total.congestionWindowSum += metrics.congestionWindowSum;
+        total.numMessages += metrics.numMessages;
+        total.numMessagesOutOfOrder += metrics.numMessagesOutOfOrder;
+        total.numCorruptMessages += metrics.numCorruptMessages;
+        total.numFailedMessages += metrics.numFailedMessages;
+        total.messageLatencySumMsecs += metrics.messageLatencySumMsecs;
+        total.maxMessageLatencyMsecs = std::max(total.maxMessageLatencyMsecs, metrics.maxMessageLatencyMsecs);
+    }
+
+    EmulatedLink::Stats linkTotal;
+    for (auto link : _links) {
+        auto linkStats = link->getStats();
+        linkTotal.forwarded += linkStats.forwarded;
+        linkTotal.dropped += linkStats.dropped;
+        linkTotal.reordered += linkStats.reordered;
+    }
+
+    QJsonObject result;
+    result["congestionControl"] = run.congestionControl;
+    result["workload"] = getWorkloadName(run.workload);
+    result["connections"] = _settings.numConnections;
+    result["durationSecs"] = elapsedSecs;
+    result["packetSize"] = _settings.packetSize;
+    result["lossPercent"] = _settings.conditions.loss * PERCENT;
+    result["delayMsecs"] = _settings.conditions.delayMsecs;
+    result["jitterMsecs"] = _settings.conditions.jitterMsecs;
+    result["reorderPercent"] = _settings.conditions.reorder * PERCENT;
+    result["seed"] = (double)_settings.seed;
+
+    result["throughputMbps"] = total.receivedBytes * MEGABITS_PER_BYTE / elapsedSecs;
+    result["minConnectionMbps"] = minConnectionMbps;
+    result["maxConnectionMbps"] = maxConnectionMbps;
+    result["receivedPackets"] = (double)total.receivedPackets;
+    result["sentPackets"] = (double)total.sentPackets;
+    result["retransmittedPackets"] = (double)total.retransmittedPackets;
+    result["retransmitRatio"] = total.sentPackets > 0 ? (double)total.retransmittedPackets / total.sentPackets : 0.0;
+    result["duplicatePackets"] = (double)total.duplicatePackets;
+
+    // unreliable connections have no acknowledgements to measure the RTT or to drive a congestion window with
+    if (total.numRTTSamples > 0) {
+        result["averageRTTMsecs"] = total.rttSumMsecs / total.numRTTSamples;
+        result["maxRTTMsecs"] = total.maxRTTMsecs;
+        result["averageCongestionWindow"] = total.congestionWindowSum / total.numRTTSamples;
+    }
+
+    if (run.workload == ORDERED) {
+        result["messages"] = (double)total.numMessages;
+        result["messagesOutOfOrder"] = (double)total.numMessagesOutOfOrder;
+        result["corruptMessages"] = (double)total.numCorruptMessages;
+        result["failedMessages"] = (double)total.numFailedMessages;
+        if (total.numMessages > 0) {
+            result["averageMessageLatencyMsecs"] = total.messageLatencySumMsecs / total.numMessages;
+            result["maxMessageLatencyMsecs"] = total.maxMessageLatencyMsecs;
+        }
+    }
+
+    result["linkForwarded"] = (double)linkTotal.forwarded;
+    result["linkDropped"] = (double)linkTotal.dropped;
+    result["linkReordered"] = (double)linkTotal.reordered;
+
+    _output.write(QJsonDocument(result).toJson(QJsonDocument::Compact));
+    _output.write("\n");
+    _output.flush();
+}
+
+void UDTBenchmark::handleReceivedPacket(std::unique_ptr<udt::Packet> packet) {
+    auto it = _connectionsByExitAddress.find(packet->getSenderSockAddr());
+    if (it == _connectionsByExitAddress.end()) {
+        return;
+    }
+    auto& metrics = _metrics[it->second];
+    metrics.receivedBytes += packet->getPayloadSize();
+    ++metrics.receivedPackets;
+}
+
+void UDTBenchmark::handleReceivedMessagePacket(std::unique_ptr<udt::Packet> packet) {
+    auto it = _connectionsByExitAddress.find(packet->getSenderSockAddr());
+    if (it == _connectionsByExitAddress.end()) {
+        return;
+    }
+    int connection = it->second;
+    auto& metrics = _metrics[connection];
+    metrics.receivedBytes += packet->getPayloadSize();
+    ++metrics.receivedPackets;
+
+    // the parts of a message arrive in order, but the parts of consecutive messages may interleave
+    auto key = std::make_pair(connection, packet->getMessageNumber());
+    auto position = packet->getPacketPosition();
+    if (position == udt::Packet::ONLY || position == udt::Packet::LAST) {
+        auto messageIt = _pendingMessages.find(key);
+        QByteArray message;
+        if (messageIt != _pendingMessages.end()) {
+            message = std::move(messageIt->second);
+            _pendingMessages.erase(messageIt);
+        }
+        message.append(packet->readAll());
+        handleMessage(connection, message);
+    } else {
+        _pendingMessages[key].append(packet->readAll());
+    }
+}
+
+void UDTBenchmark::handleMessage(int connection, const QByteArray& message) {
+    auto& metrics = _metrics[connection];
+
+    uint64_t index = 0;
+    quint64 sentUsecs = 0;
+    bool isCorrupt = message.size() != _settings.messageSize;
+    if (!isCorrupt) {
+        memcpy(&index, message.constData(), sizeof(index));
+        memcpy(&sentUsecs, message.constData() + sizeof(index), sizeof(sentUsecs));
+        char fill = (char)(index & 0xFF);
+        isCorrupt = !std::all_of(message.constBegin() + MESSAGE_HEADER_BYTES, message.constEnd(), [&](char byte) {
+            return byte == fill;
+        });
+    }
+    if (isCorrupt) {
+        qCritical() << "UDTBenchmark::handleMessage" << "received a corrupt message on connection" << connection;
+        ++metrics.numCorruptMessages;
+        _hasFailures = true;
+        return;
+    }
+
+    auto now = usecTimestampNow();
+    double latencyMsecs = (double)(now > sentUsecs ? now - sentUsecs : 0) / USECS_PER_MSEC;
+    ++metrics.numMessages;
+    metrics.messageLatencySumMsecs += latencyMsecs;
+    metrics.maxMessageLatencyMsecs = std::max(metrics.maxMessageLatencyMsecs, latencyMsecs);
+    if (index != metrics.nextMessageIndex) {
+        ++metrics.numMessagesOutOfOrder;
+    }
+    metrics.nextMessageIndex = std::max(metrics.nextMessageIndex, index + 1);
+
+    // keep the same number of messages in flight
+    _senders[connection]->sendMessage();
+}
+
+BenchmarkSender::BenchmarkSender(UDTBenchmark::Workload workload, const UDTBenchmark::Settings& settings,
+                                 const HifiSockAddr& target, std::unique_ptr<udt::CongestionControlVirtualFactory> ccFactory) :
+    _workload(workload),
+    _settings(settings),
+    _target(target)
+{
+    _socket.setCongestionControlFactory(std::move(ccFactory));
+    _socket.bind(QHostAddress::LocalHost);
+
+    _unreliableTimer.setTimerType(Qt::PreciseTimer);
+    _unreliableTimer.setInterval(1);
+    connect(&_unreliableTimer, &QTimer::timeout, this, &BenchmarkSender::sendUnreliablePackets);
+}
+
+void BenchmarkSender::start() {
+    _startUsecs = usecTimestampNow();
+
+    switch (_workload) {
+        case UDTBenchmark::RELIABLE:
+            for (int i = 0; i < NUM_INITIAL_PACKETS; ++i) {
+                sendPacket();
+            }
+            break;
+        case UDTBenchmark::UNRELIABLE:
+            _unreliableTimer.start();
+            break;
+        case UDTBenchmark::ORDERED:
+            for (int i = 0; i < NUM_MESSAGES_IN_FLIGHT; ++i) {
+                sendMessage();
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void BenchmarkSender::stop() {
+    _isStopped = true;
+    _unreliableTimer.stop();
+}
+
+void BenchmarkSender::sendPacket() {
+    if (_isStopped) {
+        return;
+    }
+
+    int payloadSize = _settings.packetSize - udt::Packet::localHeaderSize(false);
+    auto packet = udt::Packet::create(payloadSize, _workload != UDTBenchmark::UNRELIABLE);
+    packet->setPayloadSize(payloadSize);
+
+    if (packet->isReliable()) {
+        _socket.writePacket(std::move(packet), _target);
+    } else {
+        _socket.writePacket(*packet, _target);
+    }
+}
+
+void BenchmarkSender::sendUnreliablePackets() {
+    // catch up with the rate, timers don't fire often enough to send one packet per tick
+    auto elapsedUsecs = usecTimestampNow() - _startUsecs;
+    auto numDue = elapsedUsecs * _settings.unreliablePacketsPerSecond / USECS_PER_SECOND;
+    while (_numUnreliablePacketsSent < numDue && !_isStopped) {
+        sendPacket();
+        ++_numUnreliablePacketsSent;
+    }
+}
+
+void BenchmarkSender::sendMessage() {
+    if (_isStopped) {
+        return;
+    }
+
+    uint64_t index = _nextMessageIndex++;
+    quint64 sentUsecs = usecTimestampNow();
+
+    auto packetList = udt::PacketList::create(PacketType::BulkAvatarData, QByteArray(), true, true);
+    packetList->writePrimitive(index);
+    packetList->writePrimitive(sentUsecs);
+    packetList->write(QByteArray(_settings.messageSize - MESSAGE_HEADER_BYTES, (char)(index & 0xFF)));
+    packetList->closeCurrentPacket();
+
+    _socket.writePacketList(std::move(packetList), _target);
+}
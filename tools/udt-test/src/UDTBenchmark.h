@@ -0,0 +1,163 @@
+//
+//  UDTBenchmark.h
+//  tools/udt-test/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_UDTBenchmark_h
+#define hifi_UDTBenchmark_h
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFile>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <udt/CongestionControl.h>
+#include <udt/Packet.h>
+#include <udt/Socket.h>
+
+#include "EmulatedLink.h"
+
+class BenchmarkSender;
+
+// Runs each workload with each congestion control over many concurrent connections through emulated links, and writes
+// a JSON object of throughput, RTT and retransmit metrics per run, one per line, so that changes to SendQueue,
+// Connection or the congestion controls can be compared from one build to the next.
+class UDTBenchmark : public QCoreApplication {
+    Q_OBJECT
+public:
+    enum Workload {
+        RELIABLE = 0,
+        UNRELIABLE,
+        ORDERED,
+        NUM_WORKLOADS
+    };
+
+    struct Settings {
+        int numConnections { 8 };
+        int durationMsecs { 10000 };
+        int packetSize { udt::MAX_PACKET_SIZE };
+        int unreliablePacketsPerSecond { 1000 }; // per connection
+        int messageSize { 1000000 };
+        EmulatedLink::Conditions conditions;
+        uint32_t seed { 742272 };
+    };
+
+    using CongestionControlFactoryCreator = std::function<std::unique_ptr<udt::CongestionControlVirtualFactory>()>;
+
+    // whether the command line asks for the benchmark rather than for a single UDTTest sender or receiver
+    static bool isRequested(int argc, char** argv);
+
+    static QString getWorkloadName(Workload workload);
+
+    UDTBenchmark(int& argc, char** argv);
+    ~UDTBenchmark();
+
+private slots:
+    void startNextRun();
+    void sampleStats();
+    void finishRun();
+
+private:
+    struct Run {
+        QString congestionControl;
+        Workload workload;
+    };
+
+    // what a run measured on each connection, summed or averaged over the samples
+    struct ConnectionMetrics {
+        uint64_t receivedBytes { 0 };
+        uint64_t receivedPackets { 0 };
+        uint64_t sentPackets { 0 };
+        uint64_t retransmittedPackets { 0 };
+        uint64_t duplicatePackets { 0 };
+        double rttSumMsecs { 0.0 };
+        int numRTTSamples { 0 };
+        double maxRTTMsecs { 0.0 };
+        double congestionWindowSum { 0.0 };
+        uint64_t numMessages { 0 };
+        uint64_t nextMessageIndex { 0 };
+        uint64_t numMessagesOutOfOrder { 0 };
+        uint64_t numCorruptMessages { 0 };
+        uint64_t numFailedMessages { 0 };
+        double messageLatencySumMsecs { 0.0 };
+        double maxMessageLatencyMsecs { 0.0 };
+    };
+
+    bool parseArguments();
+    void setupRun(const Run& run);
+    void writeResult(const Run& run, quint64 elapsedUsecs);
+    void handleReceivedPacket(std::unique_ptr<udt::Packet> packet);
+    void handleReceivedMessagePacket(std::unique_ptr<udt::Packet> packet);
+    void handleMessage(int connection, const QByteArray& message);
+
+    QCommandLineParser _argumentParser;
+    Settings _settings;
+    std::vector<std::pair<QString, CongestionControlFactoryCreator>> _congestionControls;
+    std::vector<Run> _runs;
+    size_t _nextRun { 0 };
+    bool _hasFailures { false };
+
+    QFile _output;
+    QThread _linkThread;
+
+    // the state of the current run
+    std::unique_ptr<udt::Socket> _receiver;
+    std::vector<EmulatedLink*> _links;
+    std::vector<std::unique_ptr<BenchmarkSender>> _senders;
+    std::vector<ConnectionMetrics> _metrics;
+    std::unordered_map<HifiSockAddr, int> _connectionsByExitAddress;
+    std::map<std::pair<int, udt::Packet::MessageNumber>, QByteArray> _pendingMessages;
+    QTimer _statsTimer;
+    quint64 _runStartUsecs { 0 };
+    int _statsInterval { 100 };
+};
+
+// The sending side of one connection of a run, on a socket of its own
+class BenchmarkSender : public QObject {
+    Q_OBJECT
+public:
+    BenchmarkSender(UDTBenchmark::Workload workload, const UDTBenchmark::Settings& settings, const HifiSockAddr& target,
+                    std::unique_ptr<udt::CongestionControlVirtualFactory> ccFactory);
+
+    udt::Socket& getSocket() { return _socket; }
+    const HifiSockAddr& getTarget() const { return _target; }
+
+    void start();
+    void stop();
+
+public slots:
+    void refillPacket() { sendPacket(); } // adds a new packet to the queue when we are told one is sent
+    void sendMessage(); // queues the next ordered message
+
+private slots:
+    void sendUnreliablePackets();
+
+private:
+    void sendPacket();
+
+    UDTBenchmark::Workload _workload;
+    const UDTBenchmark::Settings& _settings;
+    HifiSockAddr _target;
+    udt::Socket _socket;
+    QTimer _unreliableTimer { this };
+    uint64_t _nextMessageIndex { 0 };
+    quint64 _numUnreliablePacketsSent { 0 };
+    quint64 _startUsecs { 0 };
+    bool _isStopped { false };
+};
+
+#endif // hifi_UDTBenchmark_h
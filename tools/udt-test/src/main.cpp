@@ -12,11 +12,17 @@
 
 #include <SharedUtil.h>
 
+#include "UDTBenchmark.h"
 #include "UDTTest.h"
 
 int main(int argc, char* argv[]) {
     setupHifiApplication("UDT Test");
 
+    if (UDTBenchmark::isRequested(argc, argv)) {
+        UDTBenchmark app(argc, argv);
+        return app.exec();
+    }
+
     UDTTest app(argc, argv);
     return app.exec();
 }
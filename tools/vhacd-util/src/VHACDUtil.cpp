@@ -42,14 +42,14 @@ bool vhacd::VHACDUtil::loadFBX(const QString filename, HFMModel& result) {
         return false;
     }
     try {
-        hifi::ByteArray fbxContents = fbx.readAll();
         HFMModel::Pointer hfmModel;
         hifi::VariantHash mapping;
         mapping["deduplicateIndices"] = true;
         if (filename.toLower().endsWith(".obj")) {
+            hifi::ByteArray fbxContents = fbx.readAll();
             hfmModel = OBJSerializer().read(fbxContents, mapping, filename);
         } else if (filename.toLower().endsWith(".fbx")) {
-            hfmModel = FBXSerializer().read(fbxContents, mapping, filename);
+            hfmModel = FBXSerializer().readFile(filename, mapping);
         } else {
             qWarning() << "file has unknown extension" << filename;
             return false;